@@ -67,6 +67,7 @@ class CCObjectPool : public std::enable_shared_from_this<CCObjectPool<T>> {
   std::atomic<Head> free_head_;
   Node *node_arena_ = nullptr;
   uint32_t capacity_ = 0;
+  bool constructed_ = false;
 };
 
 template <typename T>
@@ -83,10 +84,16 @@ void CCObjectPool<T>::ConstructAll(Args &&... args) {
   FOR_EACH(i, 0, capacity_) {
     new (node_arena_ + i) T(std::forward<Args>(args)...);
   }
+  constructed_ = true;
 }
 
 template <typename T>
 CCObjectPool<T>::~CCObjectPool() {
+  // every object handed out keeps the pool alive through the shared_ptr to
+  // the pool in its deleter, so all the objects are back when it is destroyed
+  if (constructed_) {
+    FOR_EACH(i, 0, capacity_) { node_arena_[i].object.~T(); }
+  }
   std::free(node_arena_);
 }
 
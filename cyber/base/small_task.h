@@ -0,0 +1,146 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_BASE_SMALL_TASK_H_
+#define CYBER_BASE_SMALL_TASK_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+/**
+ * @class SmallTask
+ * @brief A move-only void() callable. Unlike std::function, a callable of up
+ * to kInlineSize bytes, e.g. a lambda capturing a few references or a
+ * std::packaged_task, is stored in the task without a heap allocation.
+ * Larger callables are allocated on the heap.
+ */
+class SmallTask {
+ public:
+  static constexpr std::size_t kInlineSize = 64;
+
+  SmallTask() = default;
+
+  template <typename F,
+            typename = typename std::enable_if<!std::is_same<
+                typename std::decay<F>::type, SmallTask>::value>::type>
+  SmallTask(F&& f) {  // NOLINT
+    using Callable = typename std::decay<F>::type;
+    if constexpr (IsInline<Callable>()) {
+      new (storage_) Callable(std::forward<F>(f));
+      invoke_ = &InvokeInline<Callable>;
+      manage_ = &ManageInline<Callable>;
+    } else {
+      *reinterpret_cast<Callable**>(storage_) =
+          new Callable(std::forward<F>(f));
+      invoke_ = &InvokeHeap<Callable>;
+      manage_ = &ManageHeap<Callable>;
+    }
+  }
+
+  SmallTask(SmallTask&& other) noexcept { MoveFrom(&other); }
+
+  SmallTask& operator=(SmallTask&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(&other);
+    }
+    return *this;
+  }
+
+  SmallTask(const SmallTask&) = delete;
+  SmallTask& operator=(const SmallTask&) = delete;
+
+  ~SmallTask() { Reset(); }
+
+  explicit operator bool() const { return invoke_ != nullptr; }
+
+  void operator()() { invoke_(storage_); }
+
+  void Reset() {
+    if (manage_ != nullptr) {
+      manage_(Op::DESTROY, storage_, nullptr);
+      invoke_ = nullptr;
+      manage_ = nullptr;
+    }
+  }
+
+  template <typename Callable>
+  static constexpr bool IsInline() {
+    return sizeof(Callable) <= kInlineSize &&
+           alignof(Callable) <= alignof(std::max_align_t) &&
+           std::is_nothrow_move_constructible<Callable>::value;
+  }
+
+ private:
+  enum class Op { MOVE, DESTROY };
+  using Invoker = void (*)(void*);
+  using Manager = void (*)(Op, void*, void*);
+
+  void MoveFrom(SmallTask* other) {
+    if (other->manage_ != nullptr) {
+      other->manage_(Op::MOVE, other->storage_, storage_);
+      invoke_ = other->invoke_;
+      manage_ = other->manage_;
+      other->invoke_ = nullptr;
+      other->manage_ = nullptr;
+    }
+  }
+
+  template <typename Callable>
+  static void InvokeInline(void* storage) {
+    (*reinterpret_cast<Callable*>(storage))();
+  }
+
+  template <typename Callable>
+  static void ManageInline(Op op, void* src, void* dst) {
+    auto* callable = reinterpret_cast<Callable*>(src);
+    if (op == Op::MOVE) {
+      new (dst) Callable(std::move(*callable));
+    }
+    callable->~Callable();
+  }
+
+  template <typename Callable>
+  static void InvokeHeap(void* storage) {
+    (**reinterpret_cast<Callable**>(storage))();
+  }
+
+  template <typename Callable>
+  static void ManageHeap(Op op, void* src, void* dst) {
+    auto** callable = reinterpret_cast<Callable**>(src);
+    if (op == Op::MOVE) {
+      *reinterpret_cast<Callable**>(dst) = *callable;
+    } else {
+      delete *callable;
+    }
+  }
+
+  alignas(std::max_align_t) unsigned char storage_[kInlineSize];
+  Invoker invoke_ = nullptr;
+  Manager manage_ = nullptr;
+};
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_BASE_SMALL_TASK_H_
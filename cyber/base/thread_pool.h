@@ -17,17 +17,12 @@
 #ifndef CYBER_BASE_THREAD_POOL_H_
 #define CYBER_BASE_THREAD_POOL_H_
 
-#include <atomic>
-#include <functional>
+#include <algorithm>
+#include <cstddef>
 #include <future>
-#include <memory>
-#include <queue>
-#include <stdexcept>
-#include <thread>
 #include <utility>
-#include <vector>
 
-#include "cyber/base/bounded_queue.h"
+#include "cyber/base/work_stealing_executor.h"
 
 namespace apollo {
 namespace cyber {
@@ -41,62 +36,38 @@ class ThreadPool {
   auto Enqueue(F&& f, Args&&... args)
       -> std::future<typename std::result_of<F(Args...)>::type>;
 
+  // f(i) for i in [begin, end), in chunks of grain indices
+  template <typename F>
+  void ParallelFor(std::size_t begin, std::size_t end, std::size_t grain,
+                   F&& f);
+
   ~ThreadPool();
 
  private:
-  std::vector<std::thread> workers_;
-  BoundedQueue<std::function<void()>> task_queue_;
-  std::atomic_bool stop_;
+  WorkStealingExecutor executor_;
 };
 
+// the max_task_num tasks are shared by the queues of the workers
 inline ThreadPool::ThreadPool(std::size_t threads, std::size_t max_task_num)
-    : stop_(false) {
-  if (!task_queue_.Init(max_task_num, new BlockWaitStrategy())) {
-    throw std::runtime_error("Task queue init failed.");
-  }
-  workers_.reserve(threads);
-  for (size_t i = 0; i < threads; ++i) {
-    workers_.emplace_back([this] {
-      while (!stop_) {
-        std::function<void()> task;
-        if (task_queue_.WaitDequeue(&task)) {
-          task();
-        }
-      }
-    });
-  }
-}
+    : executor_(threads,
+                max_task_num / std::max<std::size_t>(threads, 1) + 1) {}
 
 // before using the return value, you should check value.valid()
 template <typename F, typename... Args>
 auto ThreadPool::Enqueue(F&& f, Args&&... args)
     -> std::future<typename std::result_of<F(Args...)>::type> {
-  using return_type = typename std::result_of<F(Args...)>::type;
-
-  auto task = std::make_shared<std::packaged_task<return_type()>>(
-      std::bind(std::forward<F>(f), std::forward<Args>(args)...));
-
-  std::future<return_type> res = task->get_future();
-
-  // don't allow enqueueing after stopping the pool
-  if (stop_) {
-    return std::future<return_type>();
-  }
-  task_queue_.Enqueue([task]() { (*task)(); });
-  return res;
-};
+  return executor_.Enqueue(std::forward<F>(f), std::forward<Args>(args)...);
+}
 
-// the destructor joins all threads
-inline ThreadPool::~ThreadPool() {
-  if (stop_.exchange(true)) {
-    return;
-  }
-  task_queue_.BreakAllWait();
-  for (std::thread& worker : workers_) {
-    worker.join();
-  }
+template <typename F>
+void ThreadPool::ParallelFor(std::size_t begin, std::size_t end,
+                             std::size_t grain, F&& f) {
+  executor_.ParallelFor(begin, end, grain, std::forward<F>(f));
 }
 
+// the destructor runs the tasks left and joins all threads
+inline ThreadPool::~ThreadPool() { executor_.Stop(); }
+
 }  // namespace base
 }  // namespace cyber
 }  // namespace apollo
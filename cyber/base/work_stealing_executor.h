@@ -0,0 +1,419 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_BASE_WORK_STEALING_EXECUTOR_H_
+#define CYBER_BASE_WORK_STEALING_EXECUTOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "cyber/base/macros.h"
+#include "cyber/base/small_task.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+/**
+ * @class TaskQueue
+ * @brief A bounded lock-free multi-producer multi-consumer queue of tasks.
+ * Every cell has a sequence number telling whether it is free for the push of
+ * a lap or holds a task for the pop of the lap, so the tasks are moved in and
+ * out of the cells without locks and without copies.
+ */
+class TaskQueue {
+ public:
+  explicit TaskQueue(std::size_t size) {
+    std::size_t capacity = 2;
+    while (capacity < size) {
+      capacity <<= 1;
+    }
+    mask_ = capacity - 1;
+    cells_.reset(new Cell[capacity]);
+    for (std::size_t i = 0; i < capacity; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  TaskQueue(const TaskQueue&) = delete;
+  TaskQueue& operator=(const TaskQueue&) = delete;
+
+  // the task is moved into the queue only if it is not full
+  bool Push(SmallTask* task) {
+    Cell* cell = nullptr;
+    std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+      const intptr_t diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    cell->task = std::move(*task);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool Pop(SmallTask* task) {
+    Cell* cell = nullptr;
+    std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+      const intptr_t diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    *task = std::move(cell->task);
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  struct Cell {
+    std::atomic<std::size_t> sequence;
+    SmallTask task;
+  };
+
+  std::unique_ptr<Cell[]> cells_;
+  std::size_t mask_ = 0;
+  alignas(CACHELINE_SIZE) std::atomic<std::size_t> enqueue_pos_ = {0};
+  alignas(CACHELINE_SIZE) std::atomic<std::size_t> dequeue_pos_ = {0};
+};
+
+/**
+ * @class WorkStealingExecutor
+ * @brief A thread pool with a task queue per worker. A task posted by a worker
+ * goes to its own queue, other tasks are spread over the queues, and an idle
+ * worker steals from the queues of the others before it sleeps. A thread
+ * waiting for a ParallelFor runs the tasks of the pool meanwhile, so nested
+ * parallel loops do not deadlock.
+ */
+class WorkStealingExecutor {
+ public:
+  /**
+   * @param thread_num the number of workers
+   * @param queue_size the capacity of the queue of each worker, a task posted
+   *        when all the queues are full is run by the caller
+   * @param worker_init called by each worker with its index before it runs
+   *        any task
+   */
+  explicit WorkStealingExecutor(
+      std::size_t thread_num, std::size_t queue_size = 1024,
+      const std::function<void(std::size_t)>& worker_init = nullptr);
+
+  ~WorkStealingExecutor() { Stop(); }
+
+  WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+  WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+  std::size_t thread_num() const { return workers_.size(); }
+
+  /**
+   * @brief The thread of a worker, e.g. to set its scheduling attributes.
+   */
+  std::thread* worker(std::size_t index) { return &workers_[index]; }
+
+  /**
+   * @brief Post a task without a result.
+   * @return false if the executor is stopped
+   */
+  template <typename F>
+  bool Execute(F&& f);
+
+  // before using the return value, you should check value.valid()
+  template <typename F, typename... Args>
+  auto Enqueue(F&& f, Args&&... args)
+      -> std::future<typename std::result_of<F(Args...)>::type>;
+
+  /**
+   * @brief Call f(i) for i in [begin, end), in chunks of grain indices taken
+   * by the caller and at most thread_num() workers, and wait for all of them.
+   * The first exception thrown by f is rethrown after all chunks are done.
+   */
+  template <typename F>
+  void ParallelFor(std::size_t begin, std::size_t end, std::size_t grain,
+                   F&& f);
+
+  /**
+   * @brief Run one task of the queues, if any.
+   */
+  bool RunOneTask();
+
+  /**
+   * @brief Stop the workers after they run the tasks left, and join them.
+   */
+  void Stop();
+
+ private:
+  struct WorkerSlot {
+    const WorkStealingExecutor* executor = nullptr;
+    std::size_t index = 0;
+  };
+
+  static WorkerSlot& CurrentWorker() {
+    static thread_local WorkerSlot slot;
+    return slot;
+  }
+
+  std::size_t QueueOfCaller() {
+    const WorkerSlot& slot = CurrentWorker();
+    if (slot.executor == this) {
+      return slot.index;
+    }
+    return next_queue_.fetch_add(1, std::memory_order_relaxed) %
+           queues_.size();
+  }
+
+  bool Push(SmallTask task);
+  bool PopTask(std::size_t start, SmallTask* task);
+  void WorkerLoop(std::size_t index);
+
+  std::vector<std::unique_ptr<TaskQueue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<std::size_t> next_queue_ = {0};
+  std::atomic<int64_t> pending_ = {0};
+  std::atomic<int> sleeping_ = {0};
+  std::atomic<bool> stop_ = {false};
+  std::mutex mutex_;
+  std::condition_variable cv_;
+};
+
+inline WorkStealingExecutor::WorkStealingExecutor(
+    std::size_t thread_num, std::size_t queue_size,
+    const std::function<void(std::size_t)>& worker_init) {
+  const std::size_t queue_num = std::max<std::size_t>(thread_num, 1);
+  queues_.reserve(queue_num);
+  for (std::size_t i = 0; i < queue_num; ++i) {
+    queues_.emplace_back(new TaskQueue(queue_size));
+  }
+  workers_.reserve(thread_num);
+  for (std::size_t i = 0; i < thread_num; ++i) {
+    workers_.emplace_back([this, i, worker_init] {
+      CurrentWorker() = {this, i};
+      if (worker_init) {
+        worker_init(i);
+      }
+      WorkerLoop(i);
+    });
+  }
+}
+
+template <typename F>
+bool WorkStealingExecutor::Execute(F&& f) {
+  if (stop_) {
+    return false;
+  }
+  return Push(SmallTask(std::forward<F>(f)));
+}
+
+template <typename F, typename... Args>
+auto WorkStealingExecutor::Enqueue(F&& f, Args&&... args)
+    -> std::future<typename std::result_of<F(Args...)>::type> {
+  using return_type = typename std::result_of<F(Args...)>::type;
+
+  std::packaged_task<return_type()> task(
+      std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+  std::future<return_type> res = task.get_future();
+
+  // don't allow enqueueing after stopping the pool
+  if (stop_) {
+    return std::future<return_type>();
+  }
+  Push(SmallTask(std::move(task)));
+  return res;
+}
+
+template <typename F>
+void WorkStealingExecutor::ParallelFor(std::size_t begin, std::size_t end,
+                                       std::size_t grain, F&& f) {
+  if (end <= begin) {
+    return;
+  }
+  grain = std::max<std::size_t>(grain, 1);
+  const std::size_t chunk_num = (end - begin + grain - 1) / grain;
+  const std::size_t helper_num = std::min(workers_.size(), chunk_num - 1);
+  if (helper_num == 0 || stop_) {
+    for (std::size_t i = begin; i < end; ++i) {
+      f(i);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next_chunk = {0};
+  std::atomic<std::size_t> running_helpers = {helper_num};
+  std::exception_ptr error = nullptr;
+  std::mutex error_mutex;
+  auto run_chunks = [&]() {
+    while (true) {
+      const std::size_t chunk = next_chunk.fetch_add(1);
+      if (chunk >= chunk_num) {
+        return;
+      }
+      const std::size_t chunk_begin = begin + chunk * grain;
+      const std::size_t chunk_end = std::min(chunk_begin + grain, end);
+      try {
+        for (std::size_t i = chunk_begin; i < chunk_end; ++i) {
+          f(i);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (error == nullptr) {
+          error = std::current_exception();
+        }
+      }
+    }
+  };
+  for (std::size_t i = 0; i < helper_num; ++i) {
+    // the helper must not touch the loop after it is counted out
+    auto helper = [&run_chunks, &running_helpers]() {
+      run_chunks();
+      running_helpers.fetch_sub(1, std::memory_order_release);
+    };
+    if (!Execute(helper)) {
+      running_helpers.fetch_sub(1, std::memory_order_release);
+    }
+  }
+  run_chunks();
+  while (running_helpers.load(std::memory_order_acquire) > 0) {
+    if (!RunOneTask()) {
+      std::this_thread::yield();
+    }
+  }
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+
+inline bool WorkStealingExecutor::Push(SmallTask task) {
+  const std::size_t start = QueueOfCaller();
+  pending_.fetch_add(1);
+  bool pushed = false;
+  for (std::size_t i = 0; i < queues_.size() && !pushed; ++i) {
+    pushed = queues_[(start + i) % queues_.size()]->Push(&task);
+  }
+  if (!pushed) {
+    // all the queues are full
+    pending_.fetch_sub(1);
+    task();
+    return true;
+  }
+  if (sleeping_.load() > 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cv_.notify_one();
+  }
+  return true;
+}
+
+inline bool WorkStealingExecutor::PopTask(std::size_t start, SmallTask* task) {
+  for (std::size_t i = 0; i < queues_.size(); ++i) {
+    if (queues_[(start + i) % queues_.size()]->Pop(task)) {
+      pending_.fetch_sub(1);
+      return true;
+    }
+  }
+  return false;
+}
+
+inline bool WorkStealingExecutor::RunOneTask() {
+  const WorkerSlot& slot = CurrentWorker();
+  const std::size_t start = slot.executor == this ? slot.index : 0;
+  SmallTask task;
+  if (!PopTask(start, &task)) {
+    return false;
+  }
+  task();
+  return true;
+}
+
+inline void WorkStealingExecutor::WorkerLoop(std::size_t index) {
+  // spins before sleeping, for the bursts of small tasks
+  constexpr int kSpinNum = 64;
+  SmallTask task;
+  while (true) {
+    bool found = false;
+    for (int spin = 0; spin < kSpinNum && !found; ++spin) {
+      found = PopTask(index, &task);
+      if (!found) {
+        std::this_thread::yield();
+      }
+    }
+    if (found) {
+      task();
+      task.Reset();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (stop_ && pending_.load() <= 0) {
+      return;
+    }
+    sleeping_.fetch_add(1);
+    cv_.wait(lock, [this] { return stop_ || pending_.load() > 0; });
+    sleeping_.fetch_sub(1);
+  }
+}
+
+// the tasks left are run before the workers are joined
+inline void WorkStealingExecutor::Stop() {
+  if (stop_.exchange(true)) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cv_.notify_all();
+  }
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+  SmallTask task;
+  while (PopTask(0, &task)) {
+    task();
+  }
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_BASE_WORK_STEALING_EXECUTOR_H_
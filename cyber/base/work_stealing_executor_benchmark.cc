@@ -0,0 +1,164 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Small tasks posted to a pool with a single BoundedQueue of std::function,
+// as ThreadPool and the prediction thread pool were before, or to the
+// WorkStealingExecutor, and parallel loops run as one posted task per
+// element or as a chunked ParallelFor. The element work is a few hundred
+// flops, as the per-obstacle and per-cell loops of prediction and planning
+// at the fine end.
+
+#include <cmath>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "cyber/base/bounded_queue.h"
+#include "cyber/base/work_stealing_executor.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+namespace {
+
+constexpr int kThreadNum = 4;
+constexpr int kElementNum = 1000;
+
+// the thread pool with a single queue
+class SingleQueuePool {
+ public:
+  explicit SingleQueuePool(int thread_num) {
+    task_queue_.Init(100000, new BlockWaitStrategy());
+    for (int i = 0; i < thread_num; ++i) {
+      workers_.emplace_back([this] {
+        while (!stop_) {
+          std::function<void()> task;
+          if (task_queue_.WaitDequeue(&task)) {
+            task();
+          }
+        }
+      });
+    }
+  }
+
+  ~SingleQueuePool() {
+    stop_ = true;
+    task_queue_.BreakAllWait();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  template <typename F>
+  std::future<void> Post(F&& f) {
+    auto task = std::make_shared<std::packaged_task<void()>>(std::move(f));
+    auto res = task->get_future();
+    task_queue_.Enqueue([task]() { (*task)(); });
+    return res;
+  }
+
+ private:
+  std::vector<std::thread> workers_;
+  BoundedQueue<std::function<void()>> task_queue_;
+  std::atomic<bool> stop_ = {false};
+};
+
+double Work(std::size_t i) {
+  double x = static_cast<double>(i);
+  for (int k = 0; k < 50; ++k) {
+    x = std::sqrt(x * x + 1.0);
+  }
+  return x;
+}
+
+void BM_SingleQueuePost(benchmark::State& state) {  // NOLINT
+  SingleQueuePool pool(kThreadNum);
+  std::vector<double> out(kElementNum);
+  for (auto _ : state) {
+    std::vector<std::future<void>> futures;
+    futures.reserve(kElementNum);
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      futures.push_back(pool.Post([&out, i] { out[i] = Work(i); }));
+    }
+    for (auto& future : futures) {
+      future.get();
+    }
+  }
+  state.counters["elements"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * kElementNum),
+      benchmark::Counter::kIsRate);
+}
+
+void BM_ExecutorEnqueue(benchmark::State& state) {  // NOLINT
+  WorkStealingExecutor executor(kThreadNum);
+  std::vector<double> out(kElementNum);
+  for (auto _ : state) {
+    std::vector<std::future<void>> futures;
+    futures.reserve(kElementNum);
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      futures.push_back(executor.Enqueue([&out, i] { out[i] = Work(i); }));
+    }
+    for (auto& future : futures) {
+      future.get();
+    }
+  }
+  state.counters["elements"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * kElementNum),
+      benchmark::Counter::kIsRate);
+}
+
+// args: grain
+void BM_ExecutorParallelFor(benchmark::State& state) {  // NOLINT
+  const auto grain = static_cast<std::size_t>(state.range(0));
+  WorkStealingExecutor executor(kThreadNum);
+  std::vector<double> out(kElementNum);
+  for (auto _ : state) {
+    executor.ParallelFor(0, out.size(), grain,
+                         [&out](std::size_t i) { out[i] = Work(i); });
+  }
+  state.counters["elements"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * kElementNum),
+      benchmark::Counter::kIsRate);
+}
+
+void BM_Serial(benchmark::State& state) {  // NOLINT
+  std::vector<double> out(kElementNum);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < out.size(); ++i) {
+      out[i] = Work(i);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.counters["elements"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * kElementNum),
+      benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_Serial);
+BENCHMARK(BM_SingleQueuePost)->UseRealTime();
+BENCHMARK(BM_ExecutorEnqueue)->UseRealTime();
+BENCHMARK(BM_ExecutorParallelFor)->Arg(1)->Arg(16)->Arg(64)->UseRealTime();
+
+}  // namespace
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+BENCHMARK_MAIN();
@@ -0,0 +1,164 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/work_stealing_executor.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "cyber/base/thread_pool.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+TEST(SmallTaskTest, inline_and_heap) {
+  int count = 0;
+  SmallTask small([&count] { ++count; });
+  small();
+  EXPECT_EQ(1, count);
+
+  // moves keep the callable
+  SmallTask moved(std::move(small));
+  EXPECT_FALSE(small);
+  moved();
+  EXPECT_EQ(2, count);
+
+  std::array<int, 64> big;
+  big.fill(1);
+  SmallTask large([&count, big] { count += big[63]; });
+  SmallTask other;
+  other = std::move(large);
+  other();
+  EXPECT_EQ(3, count);
+
+  auto owned = std::make_shared<int>(0);
+  {
+    SmallTask task([owned] {});
+    EXPECT_EQ(2, owned.use_count());
+  }
+  EXPECT_EQ(1, owned.use_count());
+}
+
+TEST(TaskQueueTest, bounded) {
+  TaskQueue queue(4);
+  int count = 0;
+  for (int i = 0; i < 4; ++i) {
+    SmallTask task([&count] { ++count; });
+    EXPECT_TRUE(queue.Push(&task));
+  }
+  SmallTask full([&count] { ++count; });
+  EXPECT_FALSE(queue.Push(&full));
+  EXPECT_TRUE(full);
+
+  SmallTask task;
+  while (queue.Pop(&task)) {
+    task();
+  }
+  EXPECT_EQ(4, count);
+}
+
+TEST(WorkStealingExecutorTest, enqueue) {
+  WorkStealingExecutor executor(4);
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 1000; ++i) {
+    results.push_back(executor.Enqueue([](int x) { return x * 2; }, i));
+  }
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(i * 2, results[i].get());
+  }
+
+  executor.Stop();
+  EXPECT_FALSE(executor.Enqueue([] { return 0; }).valid());
+  EXPECT_FALSE(executor.Execute([] {}));
+}
+
+TEST(WorkStealingExecutorTest, full_queues) {
+  // the tasks posted to full queues are run by the caller
+  WorkStealingExecutor executor(2, 2);
+  std::atomic<int> count = {0};
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_TRUE(executor.Execute([&count] { ++count; }));
+  }
+  executor.Stop();
+  EXPECT_EQ(1000, count.load());
+}
+
+TEST(WorkStealingExecutorTest, parallel_for) {
+  WorkStealingExecutor executor(4);
+  for (std::size_t grain : {1, 3, 64, 2000}) {
+    std::vector<int> visits(1000, 0);
+    executor.ParallelFor(0, visits.size(), grain,
+                         [&visits](std::size_t i) { ++visits[i]; });
+    EXPECT_EQ(std::vector<int>(1000, 1), visits);
+  }
+
+  std::vector<int> visits(10, 0);
+  executor.ParallelFor(5, 10, 1, [&visits](std::size_t i) { ++visits[i]; });
+  EXPECT_EQ(std::vector<int>({0, 0, 0, 0, 0, 1, 1, 1, 1, 1}), visits);
+  executor.ParallelFor(5, 5, 1, [&visits](std::size_t i) { ++visits[i]; });
+
+  EXPECT_THROW(executor.ParallelFor(0, 100, 1,
+                                    [](std::size_t i) {
+                                      if (i == 42) {
+                                        throw std::runtime_error("42");
+                                      }
+                                    }),
+               std::runtime_error);
+}
+
+TEST(WorkStealingExecutorTest, nested_parallel_for) {
+  // the workers waiting for the inner loops run the tasks of the others
+  WorkStealingExecutor executor(2);
+  std::vector<std::vector<int>> visits(16, std::vector<int>(16, 0));
+  executor.ParallelFor(0, visits.size(), 1, [&](std::size_t i) {
+    executor.ParallelFor(0, visits[i].size(), 1,
+                         [&](std::size_t j) { ++visits[i][j]; });
+  });
+  for (const auto& row : visits) {
+    EXPECT_EQ(std::vector<int>(16, 1), row);
+  }
+}
+
+TEST(WorkStealingExecutorTest, worker_init) {
+  std::atomic<int> inited = {0};
+  {
+    WorkStealingExecutor executor(3, 16,
+                                  [&inited](std::size_t) { ++inited; });
+  }
+  EXPECT_EQ(3, inited.load());
+}
+
+TEST(ThreadPoolTest, enqueue) {
+  ThreadPool pool(2, 10);
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 100; ++i) {
+    results.push_back(pool.Enqueue([i] { return i; }));
+  }
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(results[i].valid());
+    EXPECT_EQ(i, results[i].get());
+  }
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
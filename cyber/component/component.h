@@ -182,6 +182,7 @@ bool Component<M0, NullType, NullType, NullType>::Initialize(
   reader_cfg.channel_name = config.readers(0).channel();
   reader_cfg.qos_profile.CopyFrom(config.readers(0).qos_profile());
   reader_cfg.pending_queue_size = config.readers(0).pending_queue_size();
+  reader_cfg.message_pool_size = config.readers(0).message_pool_size();
 
   auto role_attr = std::make_shared<proto::RoleAttributes>();
   role_attr->set_node_name(config.name());
@@ -268,12 +269,14 @@ bool Component<M0, M1, NullType, NullType>::Initialize(
   reader_cfg.channel_name = config.readers(1).channel();
   reader_cfg.qos_profile.CopyFrom(config.readers(1).qos_profile());
   reader_cfg.pending_queue_size = config.readers(1).pending_queue_size();
+  reader_cfg.message_pool_size = config.readers(1).message_pool_size();
 
   auto reader1 = node_->template CreateReader<M1>(reader_cfg);
 
   reader_cfg.channel_name = config.readers(0).channel();
   reader_cfg.qos_profile.CopyFrom(config.readers(0).qos_profile());
   reader_cfg.pending_queue_size = config.readers(0).pending_queue_size();
+  reader_cfg.message_pool_size = config.readers(0).message_pool_size();
 
   auto role_attr = std::make_shared<proto::RoleAttributes>();
   role_attr->set_node_name(config.name());
@@ -393,18 +396,21 @@ bool Component<M0, M1, M2, NullType>::Initialize(
   reader_cfg.channel_name = config.readers(1).channel();
   reader_cfg.qos_profile.CopyFrom(config.readers(1).qos_profile());
   reader_cfg.pending_queue_size = config.readers(1).pending_queue_size();
+  reader_cfg.message_pool_size = config.readers(1).message_pool_size();
 
   auto reader1 = node_->template CreateReader<M1>(reader_cfg);
 
   reader_cfg.channel_name = config.readers(2).channel();
   reader_cfg.qos_profile.CopyFrom(config.readers(2).qos_profile());
   reader_cfg.pending_queue_size = config.readers(2).pending_queue_size();
+  reader_cfg.message_pool_size = config.readers(2).message_pool_size();
 
   auto reader2 = node_->template CreateReader<M2>(reader_cfg);
 
   reader_cfg.channel_name = config.readers(0).channel();
   reader_cfg.qos_profile.CopyFrom(config.readers(0).qos_profile());
   reader_cfg.pending_queue_size = config.readers(0).pending_queue_size();
+  reader_cfg.message_pool_size = config.readers(0).message_pool_size();
 
   auto role_attr = std::make_shared<proto::RoleAttributes>();
   role_attr->set_node_name(config.name());
@@ -533,24 +539,28 @@ bool Component<M0, M1, M2, M3>::Initialize(const ComponentConfig& config) {
   reader_cfg.channel_name = config.readers(1).channel();
   reader_cfg.qos_profile.CopyFrom(config.readers(1).qos_profile());
   reader_cfg.pending_queue_size = config.readers(1).pending_queue_size();
+  reader_cfg.message_pool_size = config.readers(1).message_pool_size();
 
   auto reader1 = node_->template CreateReader<M1>(reader_cfg);
 
   reader_cfg.channel_name = config.readers(2).channel();
   reader_cfg.qos_profile.CopyFrom(config.readers(2).qos_profile());
   reader_cfg.pending_queue_size = config.readers(2).pending_queue_size();
+  reader_cfg.message_pool_size = config.readers(2).message_pool_size();
 
   auto reader2 = node_->template CreateReader<M2>(reader_cfg);
 
   reader_cfg.channel_name = config.readers(3).channel();
   reader_cfg.qos_profile.CopyFrom(config.readers(3).qos_profile());
   reader_cfg.pending_queue_size = config.readers(3).pending_queue_size();
+  reader_cfg.message_pool_size = config.readers(3).message_pool_size();
 
   auto reader3 = node_->template CreateReader<M3>(reader_cfg);
 
   reader_cfg.channel_name = config.readers(0).channel();
   reader_cfg.qos_profile.CopyFrom(config.readers(0).qos_profile());
   reader_cfg.pending_queue_size = config.readers(0).pending_queue_size();
+  reader_cfg.message_pool_size = config.readers(0).message_pool_size();
 
   auto role_attr = std::make_shared<proto::RoleAttributes>();
   role_attr->set_node_name(config.name());
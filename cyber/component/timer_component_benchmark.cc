@@ -0,0 +1,126 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// The jitter of TimerComponent at 100 Hz to 1 kHz. Each iteration runs a
+// component for kProcNum periods, and the counters are the deviations of the
+// periods between the Procs from the interval and the drift of the last Proc
+// from its ideal time, in us. Set timer_conf.resolution_us in cyber.pb.conf
+// to compare the resolutions of the timing wheel.
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "cyber/component/timer_component.h"
+#include "cyber/init.h"
+#include "cyber/time/time.h"
+
+namespace apollo {
+namespace cyber {
+namespace {
+
+constexpr int kProcNum = 200;
+
+class JitterComponent : public TimerComponent {
+ public:
+  bool Init() override { return true; }
+
+  bool Proc() override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stamps_.size() < kProcNum) {
+      stamps_.push_back(Time::MonoTime().ToNanosecond());
+      if (stamps_.size() == kProcNum) {
+        cv_.notify_one();
+      }
+    }
+    return true;
+  }
+
+  std::vector<uint64_t> Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return stamps_.size() == kProcNum; });
+    return stamps_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<uint64_t> stamps_;
+};
+
+// args: interval in ms
+void BM_TimerComponentJitter(benchmark::State& state) {  // NOLINT
+  static std::atomic<int> component_id = {0};
+  const auto interval_ns = static_cast<double>(state.range(0)) * 1e6;
+  double square_sum = 0.0;
+  double max_jitter = 0.0;
+  double drift = 0.0;
+  for (auto _ : state) {
+    proto::TimerComponentConfig config;
+    config.set_name("timer_jitter_" + std::to_string(component_id++));
+    config.set_interval(static_cast<uint32_t>(state.range(0)));
+    auto component = std::make_shared<JitterComponent>();
+    if (!component->Initialize(config)) {
+      state.SkipWithError("failed to initialize the component");
+      return;
+    }
+    auto stamps = component->Wait();
+    component->Shutdown();
+
+    for (std::size_t i = 1; i < stamps.size(); ++i) {
+      double jitter =
+          static_cast<double>(stamps[i] - stamps[i - 1]) - interval_ns;
+      square_sum += jitter * jitter;
+      max_jitter = std::max(max_jitter, std::fabs(jitter));
+    }
+    drift += std::fabs(static_cast<double>(stamps.back() - stamps.front()) -
+                       interval_ns * (kProcNum - 1));
+  }
+  const auto iterations = static_cast<double>(state.iterations());
+  state.counters["rms_jitter_us"] =
+      std::sqrt(square_sum / (iterations * (kProcNum - 1))) / 1e3;
+  state.counters["max_jitter_us"] = max_jitter / 1e3;
+  state.counters["drift_us"] = drift / iterations / 1e3;
+}
+
+// 1 kHz, 500 Hz, 200 Hz and 100 Hz
+BENCHMARK(BM_TimerComponentJitter)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(5)
+    ->Arg(10)
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace cyber
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  apollo::cyber::Init(argv[0]);
+  benchmark::RunSpecifiedBenchmarks();
+  apollo::cyber::Clear();
+  return 0;
+}
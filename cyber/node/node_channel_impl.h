@@ -44,11 +44,13 @@ struct ReaderConfig {  ///< configurations for a Reader
     qos_profile.set_durability(proto::QosDurabilityPolicy::DURABILITY_VOLATILE);
 
     pending_queue_size = DEFAULT_PENDING_QUEUE_SIZE;
+    message_pool_size = 0;
   }
   ReaderConfig(const ReaderConfig& other)
       : channel_name(other.channel_name),
         qos_profile(other.qos_profile),
-        pending_queue_size(other.pending_queue_size) {}
+        pending_queue_size(other.pending_queue_size),
+        message_pool_size(other.message_pool_size) {}
 
   std::string channel_name;       //< channel reads
   proto::QosProfile qos_profile;  //< the qos configuration
@@ -57,6 +59,13 @@ struct ReaderConfig {  ///< configurations for a Reader
    * Older messages will dropped if you have no time to handle
    */
   uint32_t pending_queue_size;
+  /**
+   * @brief the number of messages recycled for the received messages of the
+   * channel, which keep the capacity of their fields. A message is allocated
+   * as before when all are in use, and 0 disables the pool.
+   * The first reader of the channel in the process decides the pool.
+   */
+  uint32_t message_pool_size;
 };
 
 /**
@@ -194,6 +203,7 @@ auto NodeChannelImpl::CreateReader(const ReaderConfig& config,
   proto::RoleAttributes role_attr;
   role_attr.set_channel_name(config.channel_name);
   role_attr.mutable_qos_profile()->CopyFrom(config.qos_profile);
+  role_attr.set_message_pool_size(config.message_pool_size);
   return this->template CreateReader<MessageT>(role_attr, reader_func,
                                                config.pending_queue_size);
 }
@@ -67,6 +67,17 @@ bool Statistics::RegisterChanVar(const proto::RoleAttributes& role_attr) {
                   role_attr.node_name() +
                   "-" + role_attr.channel_name() + "-recv-msgs-nums");
   }
+  if (role_attr.message_pool_size() > 0) {
+    for (bool recycled : {false, true}) {
+      const std::string prefix = role_attr.node_name() + "-" +
+                                 role_attr.channel_name() +
+                                 (recycled ? "-recycled" : "-alloc");
+      adder_map_[GetAllocCountKey(role_attr, recycled)] =
+            std::make_shared<::bvar::Adder<int32_t>>(prefix + "-msgs-nums");
+      bytes_adder_map_[GetAllocBytesKey(role_attr, recycled)] =
+            std::make_shared<::bvar::Adder<int64_t>>(prefix + "-bytes");
+    }
+  }
   return true;
 }
 
@@ -124,6 +135,24 @@ AdderVarPtr Statistics::GetAdderVar(
   return v->second;
 }
 
+AdderVarPtr Statistics::GetAllocCountVar(
+                      const proto::RoleAttributes& role_attr, bool recycled) {
+  auto v = adder_map_.find(GetAllocCountKey(role_attr, recycled));
+  if (v == adder_map_.end()) {
+    return nullptr;
+  }
+  return v->second;
+}
+
+BytesAdderVarPtr Statistics::GetAllocBytesVar(
+                      const proto::RoleAttributes& role_attr, bool recycled) {
+  auto v = bytes_adder_map_.find(GetAllocBytesKey(role_attr, recycled));
+  if (v == bytes_adder_map_.end()) {
+    return nullptr;
+  }
+  return v->second;
+}
+
 
 }  // namespace statistics
 }  // namespace cyber
@@ -41,6 +41,7 @@ namespace statistics {
 using LatencyVarPtr = std::shared_ptr<::bvar::LatencyRecorder>;
 using StatusVarPtr = std::shared_ptr<::bvar::Status<uint64_t>>;
 using AdderVarPtr = std::shared_ptr<::bvar::Adder<int32_t>>;
+using BytesAdderVarPtr = std::shared_ptr<::bvar::Adder<int64_t>>;
 
 struct SpanHandler {
   std::string name;
@@ -197,6 +198,21 @@ class Statistics {
     return true;
   }
 
+  bool AddMsgAlloc(const proto::RoleAttributes& role_attr, bool recycled,
+                   uint64_t msg_size) {
+    if (disable_chan_var_) {
+      return true;
+    }
+    auto count_ptr = GetAllocCountVar(role_attr, recycled);
+    auto bytes_ptr = GetAllocBytesVar(role_attr, recycled);
+    if (count_ptr == nullptr || bytes_ptr == nullptr) {
+      return false;
+    }
+    (*count_ptr) << 1;
+    (*bytes_ptr) << static_cast<int64_t>(msg_size);
+    return true;
+  }
+
  private:
   LatencyVarPtr GetChanProcVar(const proto::RoleAttributes& role_attr);
 
@@ -210,6 +226,12 @@ class Statistics {
 
   StatusVarPtr GetTotalMsgsStatusVar(const proto::RoleAttributes& role_attr);
 
+  AdderVarPtr GetAllocCountVar(const proto::RoleAttributes& role_attr,
+                               bool recycled);
+
+  BytesAdderVarPtr GetAllocBytesVar(const proto::RoleAttributes& role_attr,
+                                    bool recycled);
+
   inline uint64_t GetMicroTimeNow() const noexcept;
 
   inline const std::string GetProcLatencyKey(
@@ -244,9 +266,22 @@ class Statistics {
     return role_attr.node_name() + "-" + role_attr.channel_name() + "recv-msgs";
   }
 
+  inline const std::string GetAllocCountKey(
+                      const proto::RoleAttributes& role_attr, bool recycled) {
+    return role_attr.node_name() + "-" + role_attr.channel_name() +
+           (recycled ? "recycled-msgs" : "alloc-msgs");
+  }
+
+  inline const std::string GetAllocBytesKey(
+                      const proto::RoleAttributes& role_attr, bool recycled) {
+    return role_attr.node_name() + "-" + role_attr.channel_name() +
+           (recycled ? "recycled-bytes" : "alloc-bytes");
+  }
+
   std::unordered_map<std::string, LatencyVarPtr> latency_map_;
   std::unordered_map<std::string, StatusVarPtr> status_map_;
   std::unordered_map<std::string, AdderVarPtr> adder_map_;
+  std::unordered_map<std::string, BytesAdderVarPtr> bytes_adder_map_;
 
   std::unordered_map<std::string, std::shared_ptr<SpanHandler>> span_handlers_;
 
@@ -17,28 +17,34 @@
 #ifndef CYBER_TIMER_TIMER_BUCKET_H_
 #define CYBER_TIMER_TIMER_BUCKET_H_
 
-#include <list>
 #include <memory>
-#include <mutex>
+#include <vector>
 
 #include "cyber/timer/timer_task.h"
 
 namespace apollo {
 namespace cyber {
 
+/**
+ * @class TimerBucket
+ * @brief A slot of the TimingWheel. It is only accessed by the tick thread,
+ * so it has no lock.
+ */
 class TimerBucket {
  public:
-  void AddTask(const std::shared_ptr<TimerTask>& task) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    task_list_.push_back(task);
+  struct Entry {
+    std::weak_ptr<TimerTask> task;
+    uint64_t expire_tick;
+  };
+
+  void AddTask(const std::weak_ptr<TimerTask>& task, uint64_t expire_tick) {
+    task_list_.push_back({task, expire_tick});
   }
 
-  std::mutex& mutex() { return mutex_; }
-  std::list<std::weak_ptr<TimerTask>>& task_list() { return task_list_; }
+  std::vector<Entry>& task_list() { return task_list_; }
 
  private:
-  std::mutex mutex_;
-  std::list<std::weak_ptr<TimerTask>> task_list_;
+  std::vector<Entry> task_list_;
 };
 
 }  // namespace cyber
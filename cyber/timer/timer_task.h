@@ -29,11 +29,9 @@ struct TimerTask {
   explicit TimerTask(uint64_t timer_id) : timer_id_(timer_id) {}
   uint64_t timer_id_ = 0;
   std::function<void()> callback;
-  uint64_t interval_ms = 0;
-  uint64_t remainder_interval_ms = 0;
-  uint64_t next_fire_duration_ms = 0;
-  int64_t accumulated_error_ns = 0;
-  uint64_t last_execute_time_ns = 0;
+  uint64_t interval_ns = 0;
+  // the next time to fire, of Time::MonoTime()
+  uint64_t deadline_ns = 0;
   std::mutex mutex;
 };
 
@@ -18,6 +18,7 @@
 
 #include "cyber/timer/timer.h"
 
+#include <atomic>
 #include <memory>
 #include <utility>
 
@@ -48,6 +49,33 @@ TEST(TimerTest, one_shot) {
   timer.Stop();
 }
 
+TEST(TimerTest, long_one_shot) {
+  // beyond the first level of the timing wheel, cascaded from the upper ones
+  std::atomic<uint64_t> fire_time = {0};
+  auto start = Time::MonoTime().ToNanosecond();
+  Timer timer(
+      1000,
+      [&fire_time] { fire_time = Time::MonoTime().ToNanosecond(); }, true);
+  timer.Start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+  ASSERT_NE(0, fire_time.load());
+  EXPECT_GE(fire_time.load() - start, 1000000000UL);
+  timer.Stop();
+}
+
+TEST(TimerTest, no_drift) {
+  // the deadlines follow each other, so the number of fires keeps up with
+  // the period regardless of the dispatch delays
+  std::atomic<int> count = {0};
+  Timer timer(
+      10, [&count] { ++count; }, false);
+  timer.Start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(1005));
+  timer.Stop();
+  EXPECT_GE(count.load(), 95);
+  EXPECT_LE(count.load(), 100);
+}
+
 TEST(TimerTest, cycle) {
   using TimerPtr = std::shared_ptr<Timer>;
   int count = 0;
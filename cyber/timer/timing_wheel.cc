@@ -16,17 +16,50 @@
 
 #include "cyber/timer/timing_wheel.h"
 
-#include <cmath>
+#include <sys/prctl.h>
+#include <time.h>
 
+#include <cerrno>
+
+#include "cyber/common/global_data.h"
 #include "cyber/task/task.h"
+#include "cyber/time/time.h"
 
 namespace apollo {
 namespace cyber {
 
+namespace {
+
+void SleepUntil(uint64_t mono_time_ns) {
+  struct timespec ts;
+  ts.tv_sec = static_cast<time_t>(mono_time_ns / 1000000000UL);
+  ts.tv_nsec = static_cast<long>(mono_time_ns % 1000000000UL);  // NOLINT
+  // Time::MonoTime is steady_clock, i.e. CLOCK_MONOTONIC
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) ==
+         EINTR) {
+  }
+}
+
+}  // namespace
+
+TimingWheel::~TimingWheel() {
+  if (running_) {
+    Shutdown();
+  }
+  auto* pending = pending_tasks_.exchange(nullptr);
+  while (pending != nullptr) {
+    auto* next = pending->next;
+    delete pending;
+    pending = next;
+  }
+}
+
 void TimingWheel::Start() {
   std::lock_guard<std::mutex> lock(running_mutex_);
   if (!running_) {
     ADEBUG << "TimeWheel start ok";
+    // the tasks left by the last shutdown keep their ticks
+    start_ns_ = Time::MonoTime().ToNanosecond() - tick_count_ * resolution_ns_;
     running_ = true;
     tick_thread_ = std::thread([this]() { this->TickFunc(); });
     scheduler::Instance()->SetInnerThreadAttr("timer", &tick_thread_);
@@ -44,104 +77,126 @@ void TimingWheel::Shutdown() {
 }
 
 void TimingWheel::Tick() {
-  auto& bucket = work_wheel_[current_work_wheel_index_];
-  {
-    std::lock_guard<std::mutex> lock(bucket.mutex());
-    auto ite = bucket.task_list().begin();
-    while (ite != bucket.task_list().end()) {
-      auto task = ite->lock();
-      if (task) {
-        ADEBUG << "index: " << current_work_wheel_index_
-               << " timer id: " << task->timer_id_;
-        auto* callback =
-            reinterpret_cast<std::function<void()>*>(&(task->callback));
-        cyber::Async([this, callback] {
-          if (this->running_) {
-            (*callback)();
-          }
-        });
-      }
-      ite = bucket.task_list().erase(ite);
+  const uint64_t tick = tick_count_;
+  // a slot of a higher level turns when the levels below wrap around, from
+  // the top, as a cascaded task may land in a slot turning at this tick
+  for (uint64_t level = TIMER_WHEEL_LEVELS - 1; level > 0; --level) {
+    if ((tick & ((1ULL << (level * TIMER_WHEEL_SLOT_BITS)) - 1)) == 0) {
+      Cascade(level);
     }
   }
-}
 
-void TimingWheel::AddTask(const std::shared_ptr<TimerTask>& task) {
-  AddTask(task, current_work_wheel_index_);
+  auto& bucket = wheel_[0][GetSlotIndex(tick, 0)];
+  for (auto& entry : bucket.task_list()) {
+    if (entry.task.expired()) {
+      continue;
+    }
+    ADEBUG << "tick: " << tick;
+    // lock the task again when dispatched, a timer stopped in the meantime
+    // frees it
+    cyber::Async([this, task_weak_ptr = entry.task] {
+      auto task = task_weak_ptr.lock();
+      if (task && this->running_) {
+        task->callback();
+      }
+    });
+  }
+  bucket.task_list().clear();
 }
 
-void TimingWheel::AddTask(const std::shared_ptr<TimerTask>& task,
-                          const uint64_t current_work_wheel_index) {
+void TimingWheel::AddTask(const std::shared_ptr<TimerTask>& task) {
   if (!running_) {
     Start();
   }
-  auto work_wheel_index = current_work_wheel_index +
-                          static_cast<uint64_t>(std::ceil(
-                              static_cast<double>(task->next_fire_duration_ms) /
-                              TIMER_RESOLUTION_MS));
-  if (work_wheel_index >= WORK_WHEEL_SIZE) {
-    auto real_work_wheel_index = GetWorkWheelIndex(work_wheel_index);
-    task->remainder_interval_ms = real_work_wheel_index;
-    auto assistant_ticks = work_wheel_index / WORK_WHEEL_SIZE;
-    if (assistant_ticks == 1 &&
-        real_work_wheel_index < current_work_wheel_index_) {
-      work_wheel_[real_work_wheel_index].AddTask(task);
-      ADEBUG << "add task to work wheel. index :" << real_work_wheel_index;
-    } else {
-      auto assistant_wheel_index = 0;
-      {
-        std::lock_guard<std::mutex> lock(current_assistant_wheel_index_mutex_);
-        assistant_wheel_index = GetAssistantWheelIndex(
-            current_assistant_wheel_index_ + assistant_ticks);
-        assistant_wheel_[assistant_wheel_index].AddTask(task);
-      }
-      ADEBUG << "add task to assistant wheel. index : "
-             << assistant_wheel_index;
+  // lock-free push, the tick thread takes all of the list at once
+  auto* pending = new PendingTask{task, task->deadline_ns, nullptr};
+  pending->next = pending_tasks_.load(std::memory_order_relaxed);
+  while (!pending_tasks_.compare_exchange_weak(pending->next, pending,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed)) {
+  }
+}
+
+void TimingWheel::Cascade(const uint64_t level) {
+  auto& bucket = wheel_[level][GetSlotIndex(tick_count_, level)];
+  // swap out first, a task too far for the wheel goes back to the same slot
+  cascading_bucket_.task_list().swap(bucket.task_list());
+  for (auto& entry : cascading_bucket_.task_list()) {
+    if (!entry.task.expired()) {
+      PlaceTask(entry.task, entry.expire_tick);
     }
-  } else {
-    work_wheel_[work_wheel_index].AddTask(task);
-    ADEBUG << "add task [" << task->timer_id_
-           << "] to work wheel. index :" << work_wheel_index;
   }
+  cascading_bucket_.task_list().clear();
 }
 
-void TimingWheel::Cascade(const uint64_t assistant_wheel_index) {
-  auto& bucket = assistant_wheel_[assistant_wheel_index];
-  std::lock_guard<std::mutex> lock(bucket.mutex());
-  auto ite = bucket.task_list().begin();
-  while (ite != bucket.task_list().end()) {
-    auto task = ite->lock();
-    if (task) {
-      work_wheel_[task->remainder_interval_ms].AddTask(task);
+void TimingWheel::DrainPendingTasks() {
+  auto* pending = pending_tasks_.exchange(nullptr, std::memory_order_acquire);
+  // the list is pushed in reverse, keep the order the tasks are added
+  PendingTask* ordered = nullptr;
+  while (pending != nullptr) {
+    auto* next = pending->next;
+    pending->next = ordered;
+    ordered = pending;
+    pending = next;
+  }
+  while (ordered != nullptr) {
+    // the first tick not earlier than the deadline
+    uint64_t expire_tick = 0;
+    if (ordered->deadline_ns > start_ns_) {
+      expire_tick = (ordered->deadline_ns - start_ns_ + resolution_ns_ - 1) /
+                    resolution_ns_;
     }
-    ite = bucket.task_list().erase(ite);
+    PlaceTask(ordered->task, expire_tick);
+    auto* next = ordered->next;
+    delete ordered;
+    ordered = next;
+  }
+}
+
+void TimingWheel::PlaceTask(const std::weak_ptr<TimerTask>& task,
+                            uint64_t expire_tick) {
+  const uint64_t tick = tick_count_;
+  if (expire_tick < tick) {
+    expire_tick = tick;
+  }
+  // the lowest level whose turn covers the task
+  const uint64_t ticks = expire_tick - tick;
+  uint64_t level = 0;
+  while (level + 1 < TIMER_WHEEL_LEVELS &&
+         ticks >= (1ULL << ((level + 1) * TIMER_WHEEL_SLOT_BITS))) {
+    ++level;
   }
+  wheel_[level][GetSlotIndex(expire_tick, level)].AddTask(task, expire_tick);
+  ADEBUG << "add task to wheel level: " << level
+         << " index: " << GetSlotIndex(expire_tick, level);
 }
 
 void TimingWheel::TickFunc() {
-  Rate rate(TIMER_RESOLUTION_MS * 1000000);  // ms to ns
+  // the default timer slack of 50us is too coarse for sub-ms ticks
+  if (resolution_ns_ < 1000000) {
+    prctl(PR_SET_TIMERSLACK, resolution_ns_ / 100);
+  }
   while (running_) {
+    DrainPendingTasks();
     Tick();
-    // AINFO_EVERY(1000) << "Tick " << TickCount();
     tick_count_++;
-    rate.Sleep();
-    {
-      std::lock_guard<std::mutex> lock(current_work_wheel_index_mutex_);
-      current_work_wheel_index_ =
-          GetWorkWheelIndex(current_work_wheel_index_ + 1);
-    }
-    if (current_work_wheel_index_ == 0) {
-      {
-        std::lock_guard<std::mutex> lock(current_assistant_wheel_index_mutex_);
-        current_assistant_wheel_index_ =
-            GetAssistantWheelIndex(current_assistant_wheel_index_ + 1);
-      }
-      Cascade(current_assistant_wheel_index_);
-    }
+    // sleep until the time of the next tick rather than for a resolution, so
+    // the time spent in the ticks does not accumulate. when the thread is
+    // late, the ticks due are run at once.
+    SleepUntil(start_ns_ + tick_count_ * resolution_ns_);
   }
 }
 
-TimingWheel::TimingWheel() {}
+TimingWheel::TimingWheel() {
+  uint64_t resolution_us =
+      common::GlobalData::Instance()->Config().timer_conf().resolution_us();
+  if (resolution_us < TIMER_MIN_RESOLUTION_US) {
+    AWARN << "timer resolution " << resolution_us << "us is less than "
+          << TIMER_MIN_RESOLUTION_US << "us";
+    resolution_us = TIMER_MIN_RESOLUTION_US;
+  }
+  resolution_ns_ = resolution_us * 1000;
+}
 
 }  // namespace cyber
 }  // namespace apollo
@@ -17,15 +17,14 @@
 #ifndef CYBER_TIMER_TIMING_WHEEL_H_
 #define CYBER_TIMER_TIMING_WHEEL_H_
 
-#include <future>
-#include <list>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <thread>
 
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
 #include "cyber/scheduler/scheduler_factory.h"
-#include "cyber/time/rate.h"
 #include "cyber/timer/timer_bucket.h"
 
 namespace apollo {
@@ -33,54 +32,70 @@ namespace cyber {
 
 struct TimerTask;
 
-static const uint64_t WORK_WHEEL_SIZE = 512;
-static const uint64_t ASSISTANT_WHEEL_SIZE = 64;
-static const uint64_t TIMER_RESOLUTION_MS = 2;
-static const uint64_t TIMER_MAX_INTERVAL_MS =
-    WORK_WHEEL_SIZE * ASSISTANT_WHEEL_SIZE * TIMER_RESOLUTION_MS;
-
+static const uint64_t TIMER_WHEEL_LEVELS = 4;
+static const uint64_t TIMER_WHEEL_SLOT_BITS = 6;
+static const uint64_t TIMER_WHEEL_SIZE = 1ULL << TIMER_WHEEL_SLOT_BITS;
+static const uint64_t TIMER_MIN_RESOLUTION_US = 100;
+// the longest period accepted by Timer, independent of the range of the wheel
+static const uint64_t TIMER_MAX_INTERVAL_MS = 65536;
+
+/**
+ * @class TimingWheel
+ * @brief A hierarchical timing wheel of TIMER_WHEEL_LEVELS levels of
+ * TIMER_WHEEL_SIZE slots, ticking every timer_conf.resolution_us. The slots
+ * of a level cover a whole turn of the level below, and its tasks are
+ * cascaded down when their slot turns. The tasks are added to a lock-free
+ * list and placed into the wheel by the tick thread, which owns the buckets.
+ * The ticks are scheduled at absolute times of the monotonic clock, so the
+ * wheel does not drift with the time spent in the ticks.
+ */
 class TimingWheel {
  public:
-  ~TimingWheel() {
-    if (running_) {
-      Shutdown();
-    }
-  }
+  ~TimingWheel();
 
   void Start();
 
   void Shutdown();
 
-  void Tick();
-
+  /**
+   * @brief Add a task to fire at task->deadline_ns, a time of
+   * Time::MonoTime(). A task already due fires at the next tick.
+   */
   void AddTask(const std::shared_ptr<TimerTask>& task);
 
-  void AddTask(const std::shared_ptr<TimerTask>& task,
-               const uint64_t current_work_wheel_index);
-
-  void Cascade(const uint64_t assistant_wheel_index);
-
   void TickFunc();
 
   inline uint64_t TickCount() const { return tick_count_; }
 
+  inline uint64_t ResolutionNs() const { return resolution_ns_; }
+
  private:
-  inline uint64_t GetWorkWheelIndex(const uint64_t index) {
-    return index & (WORK_WHEEL_SIZE - 1);
-  }
-  inline uint64_t GetAssistantWheelIndex(const uint64_t index) {
-    return index & (ASSISTANT_WHEEL_SIZE - 1);
+  struct PendingTask {
+    std::weak_ptr<TimerTask> task;
+    uint64_t deadline_ns;
+    PendingTask* next;
+  };
+
+  void Tick();
+
+  void Cascade(const uint64_t level);
+
+  void DrainPendingTasks();
+
+  void PlaceTask(const std::weak_ptr<TimerTask>& task, uint64_t expire_tick);
+
+  inline uint64_t GetSlotIndex(const uint64_t tick, const uint64_t level) {
+    return (tick >> (level * TIMER_WHEEL_SLOT_BITS)) & (TIMER_WHEEL_SIZE - 1);
   }
 
-  bool running_ = false;
-  uint64_t tick_count_ = 0;
+  std::atomic<bool> running_ = {false};
+  std::atomic<uint64_t> tick_count_ = {0};
   std::mutex running_mutex_;
-  TimerBucket work_wheel_[WORK_WHEEL_SIZE];
-  TimerBucket assistant_wheel_[ASSISTANT_WHEEL_SIZE];
-  uint64_t current_work_wheel_index_ = 0;
-  std::mutex current_work_wheel_index_mutex_;
-  uint64_t current_assistant_wheel_index_ = 0;
-  std::mutex current_assistant_wheel_index_mutex_;
+  uint64_t resolution_ns_ = 0;
+  uint64_t start_ns_ = 0;
+  TimerBucket wheel_[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SIZE];
+  TimerBucket cascading_bucket_;
+  std::atomic<PendingTask*> pending_tasks_ = {nullptr};
   std::thread tick_thread_;
 
   DECLARE_SINGLETON(TimingWheel)
@@ -31,6 +31,7 @@
 #include "cyber/time/time.h"
 #include "cyber/transport/dispatcher/dispatcher.h"
 #include "cyber/transport/dispatcher/subscriber_listener.h"
+#include "cyber/transport/message/message_pool.h"
 #include "cyber/transport/qos/qos_filler.h"
 #include "cyber/transport/rtps/attributes_filler.h"
 #include "cyber/transport/rtps/participant.h"
@@ -84,10 +85,11 @@ class RtpsDispatcher : public Dispatcher {
 template <typename MessageT>
 void RtpsDispatcher::AddListener(const RoleAttributes& self_attr,
                                  const MessageListener<MessageT>& listener) {
-  auto listener_adapter = [listener, self_attr](
+  auto pool = MessagePool<MessageT>::Create(self_attr);
+  auto listener_adapter = [listener, self_attr, pool](
                               const std::shared_ptr<std::string>& msg_str,
                               const MessageInfo& msg_info) {
-    auto msg = std::make_shared<MessageT>();
+    auto msg = AcquireMessage(pool.get(), self_attr, msg_str->size());
     RETURN_IF(!message::ParseFromString(*msg_str, msg.get()));
     uint64_t recv_time = Time::Now().ToNanosecond();
     uint64_t send_time = msg_info.send_time();
@@ -112,10 +114,11 @@ template <typename MessageT>
 void RtpsDispatcher::AddListener(const RoleAttributes& self_attr,
                                  const RoleAttributes& opposite_attr,
                                  const MessageListener<MessageT>& listener) {
-  auto listener_adapter = [listener, self_attr](
+  auto pool = MessagePool<MessageT>::Create(self_attr);
+  auto listener_adapter = [listener, self_attr, pool](
                               const std::shared_ptr<std::string>& msg_str,
                               const MessageInfo& msg_info) {
-    auto msg = std::make_shared<MessageT>();
+    auto msg = AcquireMessage(pool.get(), self_attr, msg_str->size());
     RETURN_IF(!message::ParseFromString(*msg_str, msg.get()));
     uint64_t recv_time = Time::Now().ToNanosecond();
     uint64_t send_time = msg_info.send_time();
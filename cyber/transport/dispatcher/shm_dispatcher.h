@@ -33,6 +33,7 @@
 #include "cyber/statistics/statistics.h"
 #include "cyber/time/time.h"
 #include "cyber/transport/dispatcher/dispatcher.h"
+#include "cyber/transport/message/message_pool.h"
 #include "cyber/transport/shm/notifier_factory.h"
 #include "cyber/transport/shm/protobuf_arena_manager.h"
 #include "cyber/transport/shm/segment_factory.h"
@@ -235,10 +236,11 @@ void ShmDispatcher::AddListener(const RoleAttributes& self_attr,
 
     AddArenaListener<ReadableBlock>(self_attr, listener_adapter);
   } else {
-    auto listener_adapter = [listener, self_attr](
+    auto pool = MessagePool<MessageT>::Create(self_attr);
+    auto listener_adapter = [listener, self_attr, pool](
                                 const std::shared_ptr<ReadableBlock>& rb,
                                 const MessageInfo& msg_info) {
-      auto msg = std::make_shared<MessageT>();
+      auto msg = AcquireMessage(pool.get(), self_attr, rb->block->msg_size());
       // TODO(ALL): read config from msg_info
       RETURN_IF(!message::ParseFromArray(
           rb->buf, static_cast<int>(rb->block->msg_size()), msg.get()));
@@ -349,10 +351,11 @@ void ShmDispatcher::AddListener(const RoleAttributes& self_attr,
 
     AddArenaListener<ReadableBlock>(self_attr, opposite_attr, listener_adapter);
   } else {
-    auto listener_adapter = [listener, self_attr](
+    auto pool = MessagePool<MessageT>::Create(self_attr);
+    auto listener_adapter = [listener, self_attr, pool](
                                 const std::shared_ptr<ReadableBlock>& rb,
                                 const MessageInfo& msg_info) {
-      auto msg = std::make_shared<MessageT>();
+      auto msg = AcquireMessage(pool.get(), self_attr, rb->block->msg_size());
       RETURN_IF(!message::ParseFromArray(
           rb->buf, static_cast<int>(rb->block->msg_size()), msg.get()));
 
@@ -0,0 +1,98 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TRANSPORT_MESSAGE_MESSAGE_POOL_H_
+#define CYBER_TRANSPORT_MESSAGE_MESSAGE_POOL_H_
+
+#include <cstdint>
+#include <memory>
+
+#include "cyber/base/concurrent_object_pool.h"
+#include "cyber/proto/role_attributes.pb.h"
+#include "cyber/statistics/statistics.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+using apollo::cyber::proto::RoleAttributes;
+
+/**
+ * @class MessagePool
+ * @brief The messages of a channel received by the dispatchers. A message is
+ * back in the pool when its last reference is dropped, without being
+ * destroyed, so the next message parsed into it reuses the capacity of its
+ * strings and repeated fields. The parse clears the message before.
+ */
+template <typename MessageT>
+class MessagePool {
+ public:
+  explicit MessagePool(uint32_t size)
+      : pool_(std::make_shared<base::CCObjectPool<MessageT>>(size)) {
+    pool_->ConstructAll();
+  }
+
+  /**
+   * @brief Create the pool of the reader, nullptr if it has no pool.
+   */
+  static std::shared_ptr<MessagePool> Create(const RoleAttributes& attr) {
+    if (attr.message_pool_size() == 0) {
+      return nullptr;
+    }
+    return std::make_shared<MessagePool>(attr.message_pool_size());
+  }
+
+  /**
+   * @brief Get a message, a recycled one if any is free or else a new one.
+   * @param recycled whether the message is recycled
+   */
+  std::shared_ptr<MessageT> Acquire(bool* recycled) {
+    auto msg = pool_->GetObject();
+    *recycled = msg != nullptr;
+    if (msg == nullptr) {
+      msg = std::make_shared<MessageT>();
+    }
+    return msg;
+  }
+
+ private:
+  std::shared_ptr<base::CCObjectPool<MessageT>> pool_;
+};
+
+/**
+ * @brief Get a message to parse a received message of msg_size bytes into,
+ * from the pool if there is one, and count the allocation in the statistics
+ * of the reader.
+ */
+template <typename MessageT>
+std::shared_ptr<MessageT> AcquireMessage(MessagePool<MessageT>* pool,
+                                         const RoleAttributes& self_attr,
+                                         uint64_t msg_size) {
+  if (pool == nullptr) {
+    return std::make_shared<MessageT>();
+  }
+  bool recycled = false;
+  auto msg = pool->Acquire(&recycled);
+  statistics::Statistics::Instance()->AddMsgAlloc(self_attr, recycled,
+                                                  msg_size);
+  return msg;
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_MESSAGE_MESSAGE_POOL_H_
@@ -0,0 +1,89 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/message/message_pool.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "cyber/proto/unit_test.pb.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+using proto::UnitTest;
+
+TEST(MessagePoolTest, create) {
+  RoleAttributes attr;
+  EXPECT_EQ(nullptr, MessagePool<UnitTest>::Create(attr));
+  attr.set_message_pool_size(2);
+  EXPECT_NE(nullptr, MessagePool<UnitTest>::Create(attr));
+
+  // without a pool the messages are allocated as before
+  auto msg = AcquireMessage<UnitTest>(nullptr, attr, 0);
+  EXPECT_NE(nullptr, msg);
+}
+
+TEST(MessagePoolTest, recycle) {
+  MessagePool<UnitTest> pool(2);
+  bool recycled = false;
+  auto msg1 = pool.Acquire(&recycled);
+  EXPECT_TRUE(recycled);
+  auto msg2 = pool.Acquire(&recycled);
+  EXPECT_TRUE(recycled);
+  EXPECT_NE(msg1.get(), msg2.get());
+
+  // all in use
+  auto msg3 = pool.Acquire(&recycled);
+  EXPECT_FALSE(recycled);
+  EXPECT_NE(nullptr, msg3);
+
+  UnitTest* released = msg1.get();
+  msg1.reset();
+  auto msg4 = pool.Acquire(&recycled);
+  EXPECT_TRUE(recycled);
+  EXPECT_EQ(released, msg4.get());
+}
+
+TEST(MessagePoolTest, keep_capacity) {
+  MessagePool<UnitTest> pool(1);
+  bool recycled = false;
+  std::string long_name(1024, 'a');
+  UnitTest sent;
+  sent.set_class_name(long_name);
+  std::string str;
+  ASSERT_TRUE(sent.SerializeToString(&str));
+
+  auto msg = pool.Acquire(&recycled);
+  ASSERT_TRUE(msg->ParseFromString(str));
+  msg.reset();
+
+  sent.set_class_name("short");
+  sent.set_case_name("case");
+  ASSERT_TRUE(sent.SerializeToString(&str));
+  msg = pool.Acquire(&recycled);
+  EXPECT_TRUE(recycled);
+  ASSERT_TRUE(msg->ParseFromString(str));
+  EXPECT_EQ("short", msg->class_name());
+  EXPECT_EQ("case", msg->case_name());
+  EXPECT_GE(msg->class_name().capacity(), long_name.size());
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
@@ -18,3 +18,8 @@
 
 DEFINE_string(bridge_module_name, "Bridge", "Bridge module name");
 DEFINE_double(timeout, 1.0, "receive/send proto msg time out");
+DEFINE_int32(bridge_receiver_workers, 0,
+             "receive in batches and handle in so many workers, or in a new "
+             "thread for every readable event if 0");
+DEFINE_bool(bridge_enable_sendmmsg, false,
+            "send all the frames of a proto msg with one sendmmsg call");
@@ -20,3 +20,5 @@
 
 DECLARE_string(bridge_module_name);
 DECLARE_double(timeout);
+DECLARE_int32(bridge_receiver_workers);
+DECLARE_bool(bridge_enable_sendmmsg);
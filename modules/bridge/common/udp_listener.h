@@ -22,20 +22,41 @@
 #include <pthread.h>
 #include <sys/epoll.h>
 #include <sys/resource.h>
+#include <sys/eventfd.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "modules/bridge/common/bridge_header.h"
+#include "modules/bridge/common/macro.h"
+
 namespace apollo {
 namespace bridge {
 
 constexpr int MAXEPOLLSIZE = 100;
+// datagrams received by one recvmmsg call
+constexpr int RECV_BATCH_SIZE = 64;
+// frames queued to a worker at most, more are dropped
+constexpr size_t MAX_WORKER_FRAMES = 256;
 
 template <typename T>
 class UDPListener {
  public:
   typedef bool (T::*func)(int fd);
+  typedef bool (T::*frame_func)(const char *buf, int bytes);
   UDPListener() {}
   UDPListener(T *receiver, uint16_t port, func msg_handle) {
     receiver_ = receiver;
@@ -43,14 +64,32 @@ class UDPListener {
     msg_handle_ = msg_handle;
   }
   ~UDPListener() {
+    Stop();
+    // Listen has returned, so the sockets are closed here only
     if (listener_sock_ != -1) {
       close(listener_sock_);
     }
+    if (stop_fd_ != -1) {
+      close(stop_fd_);
+    }
+    if (kdpfd_ != -1) {
+      close(kdpfd_);
+    }
   }
 
   void SetMsgHandle(func msg_handle) { msg_handle_ = msg_handle; }
   bool Initialize(T *receiver, func msg_handle, uint16_t port);
+  /**
+   * @brief receive the datagrams in batches with recvmmsg, and handle them
+   * in a fixed pool of workers. All the frames of a message are handled by
+   * the same worker in the arrival order.
+   */
+  bool Initialize(T *receiver, frame_func frame_handle, uint16_t port,
+                  int num_workers);
   bool Listen();
+  // Makes Listen return and waits for it, and joins the workers.
+  void Stop();
+  uint64_t dropped_frames() const { return dropped_frames_; }
 
   static void *pthread_handle_message(void *param);
 
@@ -61,15 +100,46 @@ class UDPListener {
   };
 
  private:
+  struct Frame {
+    char buf_[2 * FRAME_SIZE];
+    int bytes_ = 0;
+  };
+
+  struct Worker {
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Frame *> frames_;
+  };
+
   bool setnonblocking(int sockfd);
   void MessageHandle(int fd);
+  bool InitSocket(uint16_t port);
+  bool WaitEvents();
+  void ReceiveFrames(int fd);
+  size_t ShardOf(const Frame &frame) const;
+  void WorkerLoop(Worker *worker);
+  Frame *AcquireFrame();
+  void ReleaseFrame(Frame *frame);
 
  private:
   T *receiver_ = nullptr;
   uint16_t listened_port_ = 0;
   int listener_sock_ = -1;
   func msg_handle_ = nullptr;
-  int kdpfd_ = 0;
+  int kdpfd_ = -1;
+  int stop_fd_ = -1;
+
+  frame_func frame_handle_ = nullptr;
+  std::atomic<bool> running_{true};
+  std::mutex listen_mutex_;
+  std::condition_variable listen_cv_;
+  bool listening_ = false;
+  std::atomic<uint64_t> dropped_frames_{0};
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::unique_ptr<Frame>> frames_;
+  std::mutex free_frames_mutex_;
+  std::vector<Frame *> free_frames_;
 };
 
 template <typename T>
@@ -83,6 +153,44 @@ bool UDPListener<T>::Initialize(T *receiver, func msg_handle, uint16_t port) {
   if (!receiver_) {
     return false;
   }
+  return InitSocket(port);
+}
+
+template <typename T>
+bool UDPListener<T>::Initialize(T *receiver, frame_func frame_handle,
+                                uint16_t port, int num_workers) {
+  frame_handle_ = frame_handle;
+  receiver_ = receiver;
+  if (!frame_handle_ || !receiver_ || num_workers <= 0 || !workers_.empty()) {
+    return false;
+  }
+  if (!InitSocket(port)) {
+    return false;
+  }
+
+  // the queued frames of all the workers, and a batch being received
+  const size_t num_frames =
+      static_cast<size_t>(num_workers) * MAX_WORKER_FRAMES + RECV_BATCH_SIZE;
+  frames_.reserve(num_frames);
+  free_frames_.reserve(num_frames);
+  for (size_t i = 0; i < num_frames; ++i) {
+    frames_.emplace_back(new Frame);
+    free_frames_.push_back(frames_.back().get());
+  }
+  for (int i = 0; i < num_workers; ++i) {
+    workers_.emplace_back(new Worker);
+  }
+  for (auto &worker : workers_) {
+    Worker *worker_ptr = worker.get();
+    worker->thread_ = std::thread([this, worker_ptr]() {
+      WorkerLoop(worker_ptr);
+    });
+  }
+  return true;
+}
+
+template <typename T>
+bool UDPListener<T>::InitSocket(uint16_t port) {
   listened_port_ = port;
   struct rlimit rt;
   rt.rlim_max = rt.rlim_cur = MAXEPOLLSIZE;
@@ -105,6 +213,7 @@ bool UDPListener<T>::Initialize(T *receiver, func msg_handle, uint16_t port) {
   if (bind(listener_sock_, (struct sockaddr *)&serv_addr,
            sizeof(struct sockaddr)) == -1) {
     close(listener_sock_);
+    listener_sock_ = -1;
     return false;
   }
   kdpfd_ = epoll_create(MAXEPOLLSIZE);
@@ -113,6 +222,17 @@ bool UDPListener<T>::Initialize(T *receiver, func msg_handle, uint16_t port) {
   ev.data.fd = listener_sock_;
   if (epoll_ctl(kdpfd_, EPOLL_CTL_ADD, listener_sock_, &ev) < 0) {
     close(listener_sock_);
+    listener_sock_ = -1;
+    return false;
+  }
+  stop_fd_ = eventfd(0, EFD_NONBLOCK);
+  struct epoll_event stop_ev;
+  stop_ev.events = EPOLLIN;
+  stop_ev.data.fd = stop_fd_;
+  if (stop_fd_ == -1 ||
+      epoll_ctl(kdpfd_, EPOLL_CTL_ADD, stop_fd_, &stop_ev) < 0) {
+    close(listener_sock_);
+    listener_sock_ = -1;
     return false;
   }
   return true;
@@ -120,18 +240,41 @@ bool UDPListener<T>::Initialize(T *receiver, func msg_handle, uint16_t port) {
 
 template <typename T>
 bool UDPListener<T>::Listen() {
+  {
+    std::lock_guard<std::mutex> lock(listen_mutex_);
+    if (!running_) {
+      return true;
+    }
+    listening_ = true;
+  }
+  const bool res = WaitEvents();
+  // notify under the lock, Stop may return and the listener be destroyed
+  // as soon as the lock is released
+  std::lock_guard<std::mutex> lock(listen_mutex_);
+  listening_ = false;
+  listen_cv_.notify_all();
+  return res;
+}
+
+template <typename T>
+bool UDPListener<T>::WaitEvents() {
   int nfds = -1;
   bool res = true;
   struct epoll_event events[MAXEPOLLSIZE];
   while (true) {
-    nfds = epoll_wait(kdpfd_, events, 10000, -1);
+    nfds = epoll_wait(kdpfd_, events, MAXEPOLLSIZE, -1);
     if (nfds == -1) {
       res = false;
       break;
     }
 
     for (int i = 0; i < nfds; ++i) {
-      if (events[i].data.fd == listener_sock_) {
+      if (events[i].data.fd == stop_fd_) {
+        return res;
+      }
+      if (events[i].data.fd == listener_sock_ && frame_handle_) {
+        ReceiveFrames(events[i].data.fd);
+      } else if (events[i].data.fd == listener_sock_) {
         pthread_t thread;
         pthread_attr_t attr;
         pthread_attr_init(&attr);
@@ -149,10 +292,148 @@ bool UDPListener<T>::Listen() {
       }
     }
   }
-  close(listener_sock_);
   return res;
 }
 
+template <typename T>
+void UDPListener<T>::Stop() {
+  if (!running_.exchange(false)) {
+    return;
+  }
+  if (stop_fd_ != -1) {
+    uint64_t one = 1;
+    if (write(stop_fd_, &one, sizeof(one)) != sizeof(one)) {
+      return;
+    }
+    std::unique_lock<std::mutex> lock(listen_mutex_);
+    listen_cv_.wait(lock, [this]() { return !listening_; });
+  }
+  for (auto &worker : workers_) {
+    {
+      std::lock_guard<std::mutex> lock(worker->mutex_);
+      worker->cv_.notify_all();
+    }
+    if (worker->thread_.joinable()) {
+      worker->thread_.join();
+    }
+  }
+}
+
+template <typename T>
+void UDPListener<T>::ReceiveFrames(int fd) {
+  Frame *frames[RECV_BATCH_SIZE];
+  struct mmsghdr msgs[RECV_BATCH_SIZE];
+  struct iovec iovecs[RECV_BATCH_SIZE];
+  // edge triggered, so read until the socket is drained
+  while (true) {
+    int num_frames = 0;
+    while (num_frames < RECV_BATCH_SIZE) {
+      Frame *frame = AcquireFrame();
+      if (!frame) {
+        break;
+      }
+      frames[num_frames++] = frame;
+    }
+    // all the frames are queued, drain the socket into a dropped frame
+    Frame dropped;
+    const bool drop = num_frames == 0;
+    if (drop) {
+      frames[num_frames++] = &dropped;
+    }
+    memset(msgs, 0, sizeof(msgs[0]) * num_frames);
+    for (int i = 0; i < num_frames; ++i) {
+      iovecs[i].iov_base = frames[i]->buf_;
+      iovecs[i].iov_len = sizeof(frames[i]->buf_);
+      msgs[i].msg_hdr.msg_iov = &iovecs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    const int received = recvmmsg(fd, msgs, num_frames, MSG_DONTWAIT, nullptr);
+    for (int i = 0; i < num_frames; ++i) {
+      if (drop) {
+        dropped_frames_ += std::max(received, 0);
+        break;
+      }
+      if (i >= received) {
+        ReleaseFrame(frames[i]);
+        continue;
+      }
+      Frame *frame = frames[i];
+      frame->bytes_ = static_cast<int>(msgs[i].msg_len);
+      Worker *worker = workers_[ShardOf(*frame)].get();
+      std::lock_guard<std::mutex> lock(worker->mutex_);
+      if (worker->frames_.size() >= MAX_WORKER_FRAMES) {
+        ++dropped_frames_;
+        ReleaseFrame(frame);
+        continue;
+      }
+      worker->frames_.push_back(frame);
+      worker->cv_.notify_one();
+    }
+    // a datagram arriving later triggers another event
+    if (received < num_frames) {
+      break;
+    }
+  }
+}
+
+template <typename T>
+size_t UDPListener<T>::ShardOf(const Frame &frame) const {
+  if (workers_.size() == 1) {
+    return 0;
+  }
+  size_t offset = HEADER_FLAG_SIZE + 1;
+  if (frame.bytes_ < static_cast<int>(offset + sizeof(hsize))) {
+    return 0;
+  }
+  hsize header_size = 0;
+  memcpy(&header_size, frame.buf_ + offset, sizeof(hsize));
+  offset += sizeof(hsize) + 1;
+  BridgeHeader header;
+  if (header_size < offset || header_size > static_cast<hsize>(frame.bytes_) ||
+      !header.Diserialize(frame.buf_ + offset, header_size - offset)) {
+    return 0;
+  }
+  return (std::hash<std::string>()(header.GetMsgName()) ^ header.GetMsgID()) %
+         workers_.size();
+}
+
+template <typename T>
+void UDPListener<T>::WorkerLoop(Worker *worker) {
+  while (true) {
+    Frame *frame = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(worker->mutex_);
+      worker->cv_.wait(lock, [this, worker]() {
+        return !running_ || !worker->frames_.empty();
+      });
+      if (!running_) {
+        return;
+      }
+      frame = worker->frames_.front();
+      worker->frames_.pop_front();
+    }
+    (receiver_->*frame_handle_)(frame->buf_, frame->bytes_);
+    ReleaseFrame(frame);
+  }
+}
+
+template <typename T>
+typename UDPListener<T>::Frame *UDPListener<T>::AcquireFrame() {
+  std::lock_guard<std::mutex> lock(free_frames_mutex_);
+  if (free_frames_.empty()) {
+    return nullptr;
+  }
+  Frame *frame = free_frames_.back();
+  free_frames_.pop_back();
+  return frame;
+}
+
+template <typename T>
+void UDPListener<T>::ReleaseFrame(Frame *frame) {
+  std::lock_guard<std::mutex> lock(free_frames_mutex_);
+  free_frames_.push_back(frame);
+}
+
 template <typename T>
 bool UDPListener<T>::setnonblocking(int sockfd) {
   if (fcntl(sockfd, F_SETFL, fcntl(sockfd, F_GETFD, 0) | O_NONBLOCK) == -1) {
@@ -0,0 +1,210 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Planning trajectories of 8 frames sent over the loopback in bursts every
+// millisecond, and received by a thread per readable event or by the batched
+// receiver with a pool of workers. The frames and the messages lost are
+// reported in the counters.
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "modules/common_msgs/planning_msgs/planning.pb.h"
+
+#include "modules/bridge/common/bridge_proto_serialized_buf.h"
+#include "modules/bridge/common/udp_listener.h"
+
+namespace apollo {
+namespace bridge {
+namespace {
+
+constexpr int kNumMsgs = 2000;
+
+class FrameCounter {
+ public:
+  bool MsgHandle(int fd) {
+    char buf[2 * FRAME_SIZE];
+    int bytes = static_cast<int>(recvfrom(fd, buf, sizeof(buf), 0, nullptr,
+                                          nullptr));
+    if (bytes <= 0) {
+      return false;
+    }
+    return HandleFrame(buf, bytes);
+  }
+
+  bool HandleFrame(const char *buf, int bytes) {
+    size_t offset = HEADER_FLAG_SIZE + 1;
+    hsize header_size = 0;
+    memcpy(&header_size, buf + offset, sizeof(hsize));
+    offset += sizeof(hsize) + 1;
+    BridgeHeader header;
+    if (header_size < offset || header_size > static_cast<hsize>(bytes) ||
+        !header.Diserialize(buf + offset, header_size - offset)) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++num_frames_;
+    if (++msg_frames_[header.GetMsgID()] == header.GetTotalFrames()) {
+      ++num_msgs_;
+    }
+    return true;
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    num_frames_ = 0;
+    num_msgs_ = 0;
+    msg_frames_.clear();
+  }
+
+  size_t num_frames() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_frames_;
+  }
+
+  size_t num_msgs() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_msgs_;
+  }
+
+ private:
+  std::mutex mutex_;
+  size_t num_frames_ = 0;
+  size_t num_msgs_ = 0;
+  std::unordered_map<uint32_t, uint32_t> msg_frames_;
+};
+
+std::vector<std::unique_ptr<BridgeProtoSerializedBuf<planning::ADCTrajectory>>>
+SerializedMsgs() {
+  std::vector<
+      std::unique_ptr<BridgeProtoSerializedBuf<planning::ADCTrajectory>>>
+      msgs;
+  for (uint32_t msg_id = 1; msg_id <= kNumMsgs; ++msg_id) {
+    auto trajectory = std::make_shared<planning::ADCTrajectory>();
+    trajectory->mutable_header()->set_sequence_num(msg_id);
+    for (int i = 0; i < 200; ++i) {
+      auto *path_point =
+          trajectory->add_trajectory_point()->mutable_path_point();
+      path_point->set_x(0.1 * i);
+      path_point->set_y(0.2 * i);
+    }
+    msgs.emplace_back(new BridgeProtoSerializedBuf<planning::ADCTrajectory>);
+    msgs.back()->Serialize(trajectory, "ADCTrajectory");
+  }
+  return msgs;
+}
+
+// args: receiver workers, or a thread per readable event if 0; sendmmsg;
+// messages per burst
+void BM_UDPListener(benchmark::State &state) {  // NOLINT
+  static uint16_t port = 19100;
+  ++port;
+  const int num_workers = static_cast<int>(state.range(0));
+  const bool enable_sendmmsg = state.range(1) != 0;
+  const int burst = static_cast<int>(state.range(2));
+  const auto msgs = SerializedMsgs();
+  // the detached threads per readable event may outlive the listener
+  static FrameCounter *counter = new FrameCounter;
+  counter->Reset();
+  auto listener = std::make_unique<UDPListener<FrameCounter>>();
+  if (num_workers > 0) {
+    listener->Initialize(counter, &FrameCounter::HandleFrame, port,
+                         num_workers);
+  } else {
+    listener->Initialize(counter, &FrameCounter::MsgHandle, port);
+  }
+  std::thread listen_thread([&listener]() { listener->Listen(); });
+
+  struct sockaddr_in server_addr;
+  server_addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+  server_addr.sin_family = AF_INET;
+  server_addr.sin_port = htons(port);
+  int sock_fd = socket(AF_INET, SOCK_DGRAM, 0);
+  connect(sock_fd, (struct sockaddr *)&server_addr, sizeof(server_addr));
+
+  size_t sent_frames = 0;
+  size_t received_frames = 0;
+  size_t received_msgs = 0;
+  for (auto _ : state) {
+    counter->Reset();
+    for (size_t i = 0; i < msgs.size(); ++i) {
+      if (i % burst == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      const auto &msg = msgs[i];
+      const size_t count = msg->GetSerializedBufCount();
+      if (enable_sendmmsg) {
+        std::vector<struct mmsghdr> mmsgs(count);
+        std::vector<struct iovec> iovecs(count);
+        for (size_t j = 0; j < count; ++j) {
+          iovecs[j].iov_base = const_cast<char *>(msg->GetSerializedBuf(j));
+          iovecs[j].iov_len = msg->GetSerializedBufSize(j);
+          mmsgs[j].msg_hdr.msg_iov = &iovecs[j];
+          mmsgs[j].msg_hdr.msg_iovlen = 1;
+        }
+        sendmmsg(sock_fd, mmsgs.data(), static_cast<unsigned int>(count), 0);
+      } else {
+        for (size_t j = 0; j < count; ++j) {
+          send(sock_fd, msg->GetSerializedBuf(j), msg->GetSerializedBufSize(j),
+               0);
+        }
+      }
+      sent_frames += count;
+    }
+    // until the receiver makes no progress
+    size_t last = 0;
+    do {
+      last = counter->num_frames();
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    } while (counter->num_frames() != last);
+    received_frames += counter->num_frames();
+    received_msgs += counter->num_msgs();
+  }
+  close(sock_fd);
+  listener->Stop();
+  listen_thread.join();
+
+  state.counters["frames"] = benchmark::Counter(
+      static_cast<double>(received_frames), benchmark::Counter::kIsRate);
+  state.counters["frame_loss"] =
+      1.0 - static_cast<double>(received_frames) /
+                static_cast<double>(sent_frames);
+  state.counters["msg_loss"] =
+      1.0 - static_cast<double>(received_msgs) /
+                static_cast<double>(kNumMsgs * state.iterations());
+}
+
+BENCHMARK(BM_UDPListener)
+    ->Args({0, 0, 4})
+    ->Args({1, 0, 4})
+    ->Args({1, 1, 4})
+    ->Args({4, 1, 4})
+    ->Args({1, 1, 16})
+    ->Args({4, 1, 16})
+    ->Iterations(5)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace bridge
+}  // namespace apollo
+
+BENCHMARK_MAIN();
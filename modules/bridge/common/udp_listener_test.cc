@@ -0,0 +1,142 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/bridge/common/udp_listener.h"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "modules/common_msgs/planning_msgs/planning.pb.h"
+
+#include "modules/bridge/common/bridge_proto_serialized_buf.h"
+
+namespace apollo {
+namespace bridge {
+
+namespace {
+
+constexpr uint16_t kPort = 18999;
+
+class FrameRecorder {
+ public:
+  bool HandleFrame(const char *buf, int bytes) {
+    size_t offset = HEADER_FLAG_SIZE + 1;
+    hsize header_size = 0;
+    memcpy(&header_size, buf + offset, sizeof(hsize));
+    offset += sizeof(hsize) + 1;
+    BridgeHeader header;
+    if (header_size < offset || header_size > static_cast<hsize>(bytes) ||
+        !header.Diserialize(buf + offset, header_size - offset)) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    indices_[header.GetMsgID()].push_back(header.GetIndex());
+    threads_[header.GetMsgID()].insert(std::this_thread::get_id());
+    ++num_frames_;
+    return true;
+  }
+
+  size_t num_frames() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_frames_;
+  }
+
+  std::map<uint32_t, std::vector<uint32_t>> indices_;
+  std::map<uint32_t, std::set<std::thread::id>> threads_;
+
+ private:
+  std::mutex mutex_;
+  size_t num_frames_ = 0;
+};
+
+}  // namespace
+
+TEST(UDPListenerTest, BatchedReceive) {
+  FrameRecorder recorder;
+  UDPListener<FrameRecorder> listener;
+  ASSERT_TRUE(
+      listener.Initialize(&recorder, &FrameRecorder::HandleFrame, kPort, 4));
+  std::thread listen_thread([&listener]() { listener.Listen(); });
+
+  struct sockaddr_in server_addr;
+  server_addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+  server_addr.sin_family = AF_INET;
+  server_addr.sin_port = htons(kPort);
+  int sock_fd = socket(AF_INET, SOCK_DGRAM, 0);
+  ASSERT_EQ(0, connect(sock_fd, (struct sockaddr *)&server_addr,
+                       sizeof(server_addr)));
+
+  // messages of several frames, sent with sendmmsg
+  const uint32_t num_msgs = 40;
+  size_t num_frames = 0;
+  size_t frames_per_msg = 0;
+  for (uint32_t msg_id = 1; msg_id <= num_msgs; ++msg_id) {
+    auto trajectory = std::make_shared<planning::ADCTrajectory>();
+    trajectory->mutable_header()->set_sequence_num(msg_id);
+    for (int i = 0; i < 100; ++i) {
+      trajectory->add_trajectory_point()->mutable_path_point()->set_x(i);
+    }
+    BridgeProtoSerializedBuf<planning::ADCTrajectory> proto_buf;
+    ASSERT_TRUE(proto_buf.Serialize(trajectory, "ADCTrajectory"));
+    const size_t count = proto_buf.GetSerializedBufCount();
+    std::vector<struct mmsghdr> msgs(count);
+    std::vector<struct iovec> iovecs(count);
+    for (size_t j = 0; j < count; ++j) {
+      iovecs[j].iov_base = const_cast<char *>(proto_buf.GetSerializedBuf(j));
+      iovecs[j].iov_len = proto_buf.GetSerializedBufSize(j);
+      msgs[j].msg_hdr.msg_iov = &iovecs[j];
+      msgs[j].msg_hdr.msg_iovlen = 1;
+    }
+    ASSERT_EQ(static_cast<int>(count),
+              sendmmsg(sock_fd, msgs.data(), static_cast<unsigned int>(count),
+                       0));
+    num_frames += count;
+    frames_per_msg = count;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  close(sock_fd);
+  EXPECT_LT(1, frames_per_msg);
+
+  for (int i = 0; i < 200 && recorder.num_frames() < num_frames; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  listener.Stop();
+  listen_thread.join();
+
+  // every frame, in order and by the same worker for a message
+  EXPECT_EQ(num_frames, recorder.num_frames());
+  EXPECT_EQ(0, listener.dropped_frames());
+  ASSERT_EQ(num_msgs, recorder.indices_.size());
+  std::set<std::thread::id> workers;
+  for (const auto &msg : recorder.indices_) {
+    ASSERT_EQ(frames_per_msg, msg.second.size());
+    for (size_t j = 0; j < msg.second.size(); ++j) {
+      EXPECT_EQ(j, msg.second[j]);
+    }
+    EXPECT_EQ(1, recorder.threads_[msg.first].size());
+    workers.insert(*recorder.threads_[msg.first].begin());
+  }
+  EXPECT_LT(1, workers.size());
+}
+
+}  // namespace bridge
+}  // namespace apollo
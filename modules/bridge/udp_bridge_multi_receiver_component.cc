@@ -26,6 +26,10 @@ namespace bridge {
 UDPBridgeMultiReceiverComponent::UDPBridgeMultiReceiverComponent()
     : monitor_logger_buffer_(common::monitor::MonitorMessageItem::CONTROL) {}
 
+UDPBridgeMultiReceiverComponent::~UDPBridgeMultiReceiverComponent() {
+  listener_->Stop();
+}
+
 bool UDPBridgeMultiReceiverComponent::Init() {
   AINFO << "UDP bridge multi :receiver init, startin...";
   apollo::bridge::UDPBridgeReceiverRemoteInfo udp_bridge_remote;
@@ -46,6 +50,11 @@ bool UDPBridgeMultiReceiverComponent::Init() {
 }
 
 bool UDPBridgeMultiReceiverComponent::InitSession(uint16_t port) {
+  if (FLAGS_bridge_receiver_workers > 0) {
+    return listener_->Initialize(
+        this, &UDPBridgeMultiReceiverComponent::HandleFrame, port,
+        FLAGS_bridge_receiver_workers);
+  }
   return listener_->Initialize(
       this, &UDPBridgeMultiReceiverComponent::MsgHandle, port);
 }
@@ -121,7 +130,11 @@ bool UDPBridgeMultiReceiverComponent::MsgHandle(int fd) {
   if (bytes <= 0 || bytes > total_recv) {
     return false;
   }
+  return HandleFrame(total_buf, bytes);
+}
 
+bool UDPBridgeMultiReceiverComponent::HandleFrame(const char *total_buf,
+                                                  int bytes) {
   if (strncmp(total_buf, BRIDGE_HEADER_FLAG, HEADER_FLAG_SIZE) != 0) {
     AERROR << "Header flag didn't match!";
     return false;
@@ -136,6 +149,10 @@ bool UDPBridgeMultiReceiverComponent::MsgHandle(int fd) {
     AERROR << "header size is more than FRAME_SIZE!";
     return false;
   }
+  if (header_size > static_cast<hsize>(bytes)) {
+    AERROR << "header size is more than the frame!";
+    return false;
+  }
 
   cursor = total_buf + offset;
   size_t buf_size = header_size - offset;
@@ -164,7 +181,7 @@ bool UDPBridgeMultiReceiverComponent::MsgHandle(int fd) {
   char *buf = proto_buf->GetBuf(header.GetFramePos());
   // check cursor size
   if (header.GetFrameSize() < 0 ||
-    header.GetFrameSize() > (total_recv - header_size)) {
+    header.GetFrameSize() > (bytes - header_size)) {
     return false;
   }
   // check buf size
@@ -43,7 +43,7 @@ namespace bridge {
 class UDPBridgeMultiReceiverComponent final : public cyber::Component<> {
  public:
   UDPBridgeMultiReceiverComponent();
-  ~UDPBridgeMultiReceiverComponent() = default;
+  ~UDPBridgeMultiReceiverComponent();
 
   bool Init() override;
   std::string Name() const { return FLAGS_bridge_module_name; }
@@ -54,6 +54,7 @@ class UDPBridgeMultiReceiverComponent final : public cyber::Component<> {
   void MsgDispatcher();
   bool InitSession(uint16_t port);
   bool MsgHandle(int fd);
+  bool HandleFrame(const char *buf, int bytes);
 
  private:
   bool RemoveInvalidBuf(uint32_t msg_id, const std::string &msg_name);
@@ -32,8 +32,11 @@ UDPBridgeReceiverComponent<T>::UDPBridgeReceiverComponent()
 
 template <typename T>
 UDPBridgeReceiverComponent<T>::~UDPBridgeReceiverComponent() {
-  for (auto proto : proto_list_) {
-    FREE_POINTER(proto);
+  listener_->Stop();
+  for (auto &shard : proto_shards_) {
+    for (auto proto : shard.proto_list_) {
+      FREE_POINTER(proto);
+    }
   }
 }
 
@@ -63,6 +66,11 @@ bool UDPBridgeReceiverComponent<T>::Init() {
 
 template <typename T>
 bool UDPBridgeReceiverComponent<T>::InitSession(uint16_t port) {
+  if (FLAGS_bridge_receiver_workers > 0) {
+    return listener_->Initialize(this,
+                                 &UDPBridgeReceiverComponent<T>::HandleFrame,
+                                 port, FLAGS_bridge_receiver_workers);
+  }
   return listener_->Initialize(this, &UDPBridgeReceiverComponent<T>::MsgHandle,
                                port);
 }
@@ -76,15 +84,16 @@ void UDPBridgeReceiverComponent<T>::MsgDispatcher() {
 template <typename T>
 BridgeProtoDiserializedBuf<T>
     *UDPBridgeReceiverComponent<T>::CreateBridgeProtoBuf(
-        const BridgeHeader &header) {
+        const BridgeHeader &header,
+        std::vector<BridgeProtoDiserializedBuf<T> *> *proto_list) {
   if (IsTimeout(header.GetTimeStamp())) {
     typename std::vector<BridgeProtoDiserializedBuf<T> *>::iterator itor =
-        proto_list_.begin();
-    for (; itor != proto_list_.end();) {
+        proto_list->begin();
+    for (; itor != proto_list->end();) {
       if ((*itor)->IsTheProto(header)) {
         BridgeProtoDiserializedBuf<T> *tmp = *itor;
         FREE_POINTER(tmp);
-        itor = proto_list_.erase(itor);
+        itor = proto_list->erase(itor);
         break;
       }
       ++itor;
@@ -92,7 +101,7 @@ BridgeProtoDiserializedBuf<T>
     return nullptr;
   }
 
-  for (auto proto : proto_list_) {
+  for (auto proto : *proto_list) {
     if (proto->IsTheProto(header)) {
       return proto;
     }
@@ -102,13 +111,15 @@ BridgeProtoDiserializedBuf<T>
     return nullptr;
   }
   proto_buf->Initialize(header);
-  proto_list_.push_back(proto_buf);
+  proto_list->push_back(proto_buf);
   return proto_buf;
 }
 
 template <typename T>
 bool UDPBridgeReceiverComponent<T>::IsProtoExist(const BridgeHeader &header) {
-  for (auto proto : proto_list_) {
+  ProtoShard &shard = ShardOf(header);
+  std::lock_guard<std::mutex> lock(shard.mutex_);
+  for (auto proto : shard.proto_list_) {
     if (proto->IsTheProto(header)) {
       return true;
     }
@@ -145,6 +156,12 @@ bool UDPBridgeReceiverComponent<T>::MsgHandle(int fd) {
   if (bytes <= 0 || bytes > total_recv) {
     return false;
   }
+  return HandleFrame(total_buf, bytes);
+}
+
+template <typename T>
+bool UDPBridgeReceiverComponent<T>::HandleFrame(const char *total_buf,
+                                                int bytes) {
   char header_flag[sizeof(BRIDGE_HEADER_FLAG) + 1] = {0};
   size_t offset = 0;
   memcpy(header_flag, total_buf, HEADER_FLAG_SIZE);
@@ -163,6 +180,10 @@ bool UDPBridgeReceiverComponent<T>::MsgHandle(int fd) {
     AINFO << "header size is more than FRAME_SIZE or less than offset!";
     return false;
   }
+  if (header_size > static_cast<hsize>(bytes)) {
+    AINFO << "header size is more than the frame!";
+    return false;
+  }
 
   BridgeHeader header;
   size_t buf_size = header_size - offset;
@@ -177,35 +198,43 @@ bool UDPBridgeReceiverComponent<T>::MsgHandle(int fd) {
   ADEBUG << "proto total frames: " << header.GetTotalFrames();
   ADEBUG << "proto frame index: " << header.GetIndex();
 
-  std::lock_guard<std::mutex> lock(mutex_);
-  BridgeProtoDiserializedBuf<T> *proto_buf = CreateBridgeProtoBuf(header);
-  if (!proto_buf) {
-    return false;
-  }
+  std::shared_ptr<T> pb_msg;
+  uint32_t msg_id = 0;
+  {
+    ProtoShard &shard = ShardOf(header);
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    BridgeProtoDiserializedBuf<T> *proto_buf =
+        CreateBridgeProtoBuf(header, &shard.proto_list_);
+    if (!proto_buf) {
+      return false;
+    }
 
-  cursor = total_buf + header_size;
-  if (header.GetFramePos() > header.GetMsgSize()) {
-    return false;
-  }
-  char *buf = proto_buf->GetBuf(header.GetFramePos());
-  // check cursor size
-  if (header.GetFrameSize() < 0 ||
-    header.GetFrameSize() > (total_recv - header_size)) {
-    return false;
-  }
-  // check buf size
-  if (header.GetFrameSize() > (header.GetMsgSize() - header.GetFramePos())) {
-    return false;
-  }
-  memcpy(buf, cursor, header.GetFrameSize());
-  proto_buf->UpdateStatus(header.GetIndex());
-  if (proto_buf->IsReadyDiserialize()) {
-    auto pb_msg = std::make_shared<T>();
+    cursor = total_buf + header_size;
+    if (header.GetFramePos() > header.GetMsgSize()) {
+      return false;
+    }
+    char *buf = proto_buf->GetBuf(header.GetFramePos());
+    // check cursor size
+    if (header.GetFrameSize() < 0 ||
+      header.GetFrameSize() > (bytes - header_size)) {
+      return false;
+    }
+    // check buf size
+    if (header.GetFrameSize() > (header.GetMsgSize() - header.GetFramePos())) {
+      return false;
+    }
+    memcpy(buf, cursor, header.GetFrameSize());
+    proto_buf->UpdateStatus(header.GetIndex());
+    if (!proto_buf->IsReadyDiserialize()) {
+      return true;
+    }
+    pb_msg = std::make_shared<T>();
     proto_buf->Diserialized(pb_msg);
-    writer_->Write(pb_msg);
-    RemoveInvalidBuf(proto_buf->GetMsgID());
-    RemoveItem(&proto_list_, proto_buf);
+    msg_id = proto_buf->GetMsgID();
+    RemoveItem(&shard.proto_list_, proto_buf);
   }
+  writer_->Write(pb_msg);
+  RemoveInvalidBuf(msg_id);
   return true;
 }
 
@@ -214,16 +243,19 @@ bool UDPBridgeReceiverComponent<T>::RemoveInvalidBuf(uint32_t msg_id) {
   if (msg_id == 0) {
     return false;
   }
-  typename std::vector<BridgeProtoDiserializedBuf<T> *>::iterator itor =
-      proto_list_.begin();
-  for (; itor != proto_list_.end();) {
-    if ((*itor)->GetMsgID() < msg_id) {
-      BridgeProtoDiserializedBuf<T> *tmp = *itor;
-      FREE_POINTER(tmp);
-      itor = proto_list_.erase(itor);
-      continue;
+  for (auto &shard : proto_shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    typename std::vector<BridgeProtoDiserializedBuf<T> *>::iterator itor =
+        shard.proto_list_.begin();
+    for (; itor != shard.proto_list_.end();) {
+      if ((*itor)->GetMsgID() < msg_id) {
+        BridgeProtoDiserializedBuf<T> *tmp = *itor;
+        FREE_POINTER(tmp);
+        itor = shard.proto_list_.erase(itor);
+        continue;
+      }
+      ++itor;
     }
-    ++itor;
   }
   return true;
 }
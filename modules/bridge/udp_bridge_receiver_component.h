@@ -18,9 +18,11 @@
 #include <netinet/in.h>
 #include <sys/socket.h>
 
+#include <array>
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -54,14 +56,29 @@ class UDPBridgeReceiverComponent final : public cyber::Component<> {
 
   std::string Name() const { return FLAGS_bridge_module_name; }
   bool MsgHandle(int fd);
+  bool HandleFrame(const char *buf, int bytes);
 
  private:
   bool InitSession(uint16_t port);
   void MsgDispatcher();
+  // the partly received messages, sharded by message ID so that the workers
+  // of the listener reassemble different messages concurrently
+  struct ProtoShard {
+    std::mutex mutex_;
+    std::vector<BridgeProtoDiserializedBuf<T> *> proto_list_;
+  };
+  static constexpr size_t kProtoShardNum = 16;
+
+  ProtoShard &ShardOf(const BridgeHeader &header) {
+    return proto_shards_[header.GetMsgID() % kProtoShardNum];
+  }
   bool IsProtoExist(const BridgeHeader &header);
+  // called with the mutex of the shard held
   BridgeProtoDiserializedBuf<T> *CreateBridgeProtoBuf(
-      const BridgeHeader &header);
+      const BridgeHeader &header,
+      std::vector<BridgeProtoDiserializedBuf<T> *> *proto_list);
   bool IsTimeout(double time_stamp);
+  // locks the shards one at a time
   bool RemoveInvalidBuf(uint32_t msg_id);
 
  private:
@@ -71,12 +88,11 @@ class UDPBridgeReceiverComponent final : public cyber::Component<> {
   std::string topic_name_ = "";
   bool enable_timeout_ = true;
   std::shared_ptr<cyber::Writer<T>> writer_;
-  std::mutex mutex_;
 
   std::shared_ptr<UDPListener<UDPBridgeReceiverComponent<T>>> listener_ =
       std::make_shared<UDPListener<UDPBridgeReceiverComponent<T>>>();
 
-  std::vector<BridgeProtoDiserializedBuf<T> *> proto_list_;
+  std::array<ProtoShard, kProtoShardNum> proto_shards_;
 };
 
 RECEIVER_BRIDGE_COMPONENT_REGISTER(canbus::Chassis)
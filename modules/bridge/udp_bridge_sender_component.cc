@@ -73,11 +73,33 @@ bool UDPBridgeSenderComponent<T>::Proc(const std::shared_ptr<T> &pb_msg) {
 
   BridgeProtoSerializedBuf<T> proto_buf;
   proto_buf.Serialize(pb_msg, proto_name_);
-  for (size_t j = 0; j < proto_buf.GetSerializedBufCount(); j++) {
-    ssize_t nbytes = send(sock_fd, proto_buf.GetSerializedBuf(j),
-                          proto_buf.GetSerializedBufSize(j), 0);
-    if (nbytes != static_cast<ssize_t>(proto_buf.GetSerializedBufSize(j))) {
-      break;
+  if (FLAGS_bridge_enable_sendmmsg) {
+    const size_t count = proto_buf.GetSerializedBufCount();
+    std::vector<struct mmsghdr> msgs(count);
+    std::vector<struct iovec> iovecs(count);
+    for (size_t j = 0; j < count; j++) {
+      iovecs[j].iov_base = const_cast<char *>(proto_buf.GetSerializedBuf(j));
+      iovecs[j].iov_len = proto_buf.GetSerializedBufSize(j);
+      msgs[j].msg_hdr.msg_iov = &iovecs[j];
+      msgs[j].msg_hdr.msg_iovlen = 1;
+    }
+    // sendmmsg may send a part of the frames
+    size_t sent = 0;
+    while (sent < count) {
+      int nframes = sendmmsg(sock_fd, msgs.data() + sent,
+                             static_cast<unsigned int>(count - sent), 0);
+      if (nframes <= 0) {
+        break;
+      }
+      sent += static_cast<size_t>(nframes);
+    }
+  } else {
+    for (size_t j = 0; j < proto_buf.GetSerializedBufCount(); j++) {
+      ssize_t nbytes = send(sock_fd, proto_buf.GetSerializedBuf(j),
+                            proto_buf.GetSerializedBufSize(j), 0);
+      if (nbytes != static_cast<ssize_t>(proto_buf.GetSerializedBufSize(j))) {
+        break;
+      }
     }
   }
   close(sock_fd);
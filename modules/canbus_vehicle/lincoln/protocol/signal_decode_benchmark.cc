@@ -0,0 +1,222 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// The lincoln accel, gyro and wheel speed frames decoded by the protocols,
+// byte by byte, or by the CanSignal tables as gen_vehicle_protocol generates
+// them with use_signal_tables, into the same fields. The decoded fields are
+// checked to be the same before the benchmark.
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "google/protobuf/util/message_differencer.h"
+
+#include "modules/canbus_vehicle/lincoln/proto/lincoln.pb.h"
+
+#include "cyber/common/log.h"
+#include "modules/canbus_vehicle/lincoln/protocol/accel_6b.h"
+#include "modules/canbus_vehicle/lincoln/protocol/gyro_6c.h"
+#include "modules/canbus_vehicle/lincoln/protocol/wheelspeed_6a.h"
+#include "modules/drivers/canbus/common/can_signal.h"
+
+namespace apollo {
+namespace canbus {
+namespace lincoln {
+namespace {
+
+// the signal tables of the frames, as in the generated lincoln_signals.h
+namespace signals {
+
+using ::apollo::drivers::canbus::CanByteOrder;
+using ::apollo::drivers::canbus::CanSignal;
+
+struct Accel6b {
+  static constexpr int32_t ID = 0x6B;
+  using LatAcc = CanSignal<0, 16, CanByteOrder::INTEL, true,
+                           std::ratio<1, 100>, std::ratio<0>>;
+  using LongAcc = CanSignal<16, 16, CanByteOrder::INTEL, true,
+                            std::ratio<1, 100>, std::ratio<0>>;
+  using VertAcc = CanSignal<32, 16, CanByteOrder::INTEL, true,
+                            std::ratio<1, 100>, std::ratio<0>>;
+};
+
+struct Gyro6c {
+  static constexpr int32_t ID = 0x6C;
+  using RollRate = CanSignal<0, 16, CanByteOrder::INTEL, true,
+                             std::ratio<1, 5000>, std::ratio<0>>;
+  using YawRate = CanSignal<16, 16, CanByteOrder::INTEL, true,
+                            std::ratio<1, 5000>, std::ratio<0>>;
+};
+
+struct Wheelspeed6a {
+  static constexpr int32_t ID = 0x6A;
+  using WheelSpdFl = CanSignal<0, 16, CanByteOrder::INTEL, true,
+                               std::ratio<1, 100>, std::ratio<0>>;
+  using WheelSpdFr = CanSignal<16, 16, CanByteOrder::INTEL, true,
+                               std::ratio<1, 100>, std::ratio<0>>;
+  using WheelSpdRl = CanSignal<32, 16, CanByteOrder::INTEL, true,
+                               std::ratio<1, 100>, std::ratio<0>>;
+  using WheelSpdRr = CanSignal<48, 16, CanByteOrder::INTEL, true,
+                               std::ratio<1, 100>, std::ratio<0>>;
+};
+
+}  // namespace signals
+
+constexpr int kNumFrames = 300;
+
+struct Frame {
+  int32_t id;
+  uint8_t data[8];
+};
+
+WheelSpeed::WheelSpeedType WheelDirection(double wheel_speed) {
+  if (wheel_speed > 0) {
+    return WheelSpeed::FORWARD;
+  } else if (wheel_speed > -0.01 && wheel_speed < 0.01) {
+    return WheelSpeed::STANDSTILL;
+  } else if (wheel_speed < 0) {
+    return WheelSpeed::BACKWARD;
+  }
+  return WheelSpeed::INVALID;
+}
+
+std::vector<Frame> RandomFrames() {
+  const int32_t ids[] = {signals::Accel6b::ID, signals::Gyro6c::ID,
+                         signals::Wheelspeed6a::ID};
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::vector<Frame> frames(kNumFrames);
+  for (int i = 0; i < kNumFrames; ++i) {
+    frames[i].id = ids[i % 3];
+    for (auto &b : frames[i].data) {
+      b = static_cast<uint8_t>(byte(gen));
+    }
+  }
+  return frames;
+}
+
+class ProtocolDecoder {
+ public:
+  void Decode(const Frame &frame, Lincoln *lincoln) const {
+    switch (frame.id) {
+      case signals::Accel6b::ID:
+        accel_.Parse(frame.data, 8, lincoln);
+        break;
+      case signals::Gyro6c::ID:
+        gyro_.Parse(frame.data, 8, lincoln);
+        break;
+      case signals::Wheelspeed6a::ID:
+        wheelspeed_.Parse(frame.data, 8, lincoln);
+        break;
+      default:
+        break;
+    }
+  }
+
+ private:
+  Accel6b accel_;
+  Gyro6c gyro_;
+  Wheelspeed6a wheelspeed_;
+};
+
+class SignalTableDecoder {
+ public:
+  void Decode(const Frame &frame, Lincoln *lincoln) const {
+    auto *spd = lincoln->mutable_vehicle_spd();
+    const uint8_t *bytes = frame.data;
+    switch (frame.id) {
+      case signals::Accel6b::ID:
+        spd->set_lat_acc(signals::Accel6b::LatAcc::Decode(bytes));
+        spd->set_long_acc(signals::Accel6b::LongAcc::Decode(bytes));
+        spd->set_vert_acc(signals::Accel6b::VertAcc::Decode(bytes));
+        break;
+      case signals::Gyro6c::ID:
+        spd->set_roll_rate(signals::Gyro6c::RollRate::Decode(bytes));
+        spd->set_yaw_rate(signals::Gyro6c::YawRate::Decode(bytes));
+        spd->set_is_yaw_rate_valid(true);
+        break;
+      case signals::Wheelspeed6a::ID: {
+        const double fl = signals::Wheelspeed6a::WheelSpdFl::Decode(bytes);
+        const double fr = signals::Wheelspeed6a::WheelSpdFr::Decode(bytes);
+        const double rl = signals::Wheelspeed6a::WheelSpdRl::Decode(bytes);
+        const double rr = signals::Wheelspeed6a::WheelSpdRr::Decode(bytes);
+        spd->set_wheel_spd_fl(fl);
+        spd->set_is_wheel_spd_fl_valid(true);
+        spd->set_wheel_direction_fl(WheelDirection(fl));
+        spd->set_wheel_spd_fr(fr);
+        spd->set_is_wheel_spd_fr_valid(true);
+        spd->set_wheel_direction_fr(WheelDirection(fr));
+        spd->set_wheel_spd_rl(rl);
+        spd->set_is_wheel_spd_rl_valid(true);
+        spd->set_wheel_direction_rl(WheelDirection(rl));
+        spd->set_wheel_spd_rr(rr);
+        spd->set_is_wheel_spd_rr_valid(true);
+        spd->set_wheel_direction_rr(WheelDirection(rr));
+        break;
+      }
+      default:
+        break;
+    }
+  }
+};
+
+// the fields decoded by the two decoders are bitwise the same
+void CheckSameDecode(const std::vector<Frame> &frames) {
+  ProtocolDecoder protocol_decoder;
+  SignalTableDecoder table_decoder;
+  for (const auto &frame : frames) {
+    Lincoln expected;
+    Lincoln decoded;
+    protocol_decoder.Decode(frame, &expected);
+    table_decoder.Decode(frame, &decoded);
+    if (!google::protobuf::util::MessageDifferencer::Equals(expected,
+                                                            decoded)) {
+      AERROR << "decoded differently, id: " << frame.id
+             << ", expected: " << expected.ShortDebugString()
+             << ", decoded: " << decoded.ShortDebugString();
+      std::abort();
+    }
+  }
+}
+
+template <typename Decoder>
+void BM_DecodeFrames(benchmark::State &state) {  // NOLINT
+  const std::vector<Frame> frames = RandomFrames();
+  CheckSameDecode(frames);
+  Decoder decoder;
+  Lincoln lincoln;
+  for (auto _ : state) {
+    for (const auto &frame : frames) {
+      decoder.Decode(frame, &lincoln);
+    }
+    benchmark::DoNotOptimize(lincoln);
+  }
+  state.counters["frames"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * frames.size()),
+      benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_TEMPLATE(BM_DecodeFrames, ProtocolDecoder);
+BENCHMARK_TEMPLATE(BM_DecodeFrames, SignalTableDecoder);
+
+}  // namespace
+}  // namespace lincoln
+}  // namespace canbus
+}  // namespace apollo
+
+BENCHMARK_MAIN();
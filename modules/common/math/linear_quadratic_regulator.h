@@ -21,7 +21,11 @@
 
 #pragma once
 
+#include <cmath>
+#include <limits>
+
 #include "Eigen/Core"
+#include "Eigen/LU"
 
 /**
  * @namespace apollo::common::math
@@ -66,6 +70,47 @@ void SolveLQRProblem(const Eigen::MatrixXd &A, const Eigen::MatrixXd &B,
                      Eigen::MatrixXd *ptr_K, uint *iterate_num,
                      double *result_diff);
 
+/**
+ * @brief Solver for discrete-time linear quadratic problem with fixed size
+ *        matrices, i.e. N states and M controls known at compile time. It
+ *        runs the same iteration as above without heap allocation.
+ * @param A The system dynamic matrix
+ * @param B The control matrix
+ * @param Q The cost matrix for system state
+ * @param R The cost matrix for control output
+ * @param tolerance The numerical tolerance for solving Discrete
+ *        Algebraic Riccati equation (DARE)
+ * @param max_num_iteration The maximum iterations for solving ARE
+ * @param ptr_K The feedback control matrix (pointer)
+ */
+template <int N, int M>
+void SolveLQRProblem(const Eigen::Matrix<double, N, N> &A,
+                     const Eigen::Matrix<double, N, M> &B,
+                     const Eigen::Matrix<double, N, N> &Q,
+                     const Eigen::Matrix<double, M, M> &R,
+                     const double tolerance, const uint max_num_iteration,
+                     Eigen::Matrix<double, M, N> *ptr_K, uint *iterate_num,
+                     double *result_diff) {
+  static_assert(N > 0 && M > 0, "matrix sizes must be fixed");
+  const Eigen::Matrix<double, N, N> AT = A.transpose();
+  const Eigen::Matrix<double, M, N> BT = B.transpose();
+
+  Eigen::Matrix<double, N, N> P = Q;
+  uint num_iteration = 0;
+  double diff = std::numeric_limits<double>::max();
+  while (num_iteration++ < max_num_iteration && diff > tolerance) {
+    const Eigen::Matrix<double, N, N> P_next =
+        AT * P * A -
+        (AT * P * B) * (R + BT * P * B).inverse() * (BT * P * A) + Q;
+    // check the difference between P and P_next
+    diff = std::fabs((P_next - P).maxCoeff());
+    P = P_next;
+  }
+  *iterate_num = num_iteration;
+  *result_diff = diff;
+  *ptr_K = (R + BT * P * B).inverse() * (BT * P * A);
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -19,6 +19,18 @@
 namespace apollo {
 namespace common {
 namespace math {
+
+namespace {
+// Moves the blocks of the horizon one step ahead, the last block is kept.
+void ShiftBlocks(const size_t offset, const size_t block_size,
+                 const size_t num_blocks, std::vector<c_float> *values) {
+  for (size_t i = 0; i + 1 < num_blocks; ++i) {
+    std::copy_n(values->begin() + offset + (i + 1) * block_size, block_size,
+                values->begin() + offset + i * block_size);
+  }
+}
+}  // namespace
+
 MpcOsqp::MpcOsqp(const Eigen::MatrixXd &matrix_a,
                  const Eigen::MatrixXd &matrix_b,
                  const Eigen::MatrixXd &matrix_q,
@@ -50,6 +62,44 @@ MpcOsqp::MpcOsqp(const Eigen::MatrixXd &matrix_a,
   num_param_ = state_dim_ * (horizon_ + 1) + control_dim_ * horizon_;
 }
 
+MpcOsqp::~MpcOsqp() { ResetWorkspace(); }
+
+void MpcOsqp::EnableWarmStart(const double time_limit) {
+  warm_start_ = true;
+  time_limit_ = time_limit;
+}
+
+bool MpcOsqp::Update(const Eigen::MatrixXd &matrix_a,
+                     const Eigen::MatrixXd &matrix_b,
+                     const Eigen::MatrixXd &matrix_q,
+                     const Eigen::MatrixXd &matrix_r,
+                     const Eigen::MatrixXd &matrix_initial_x,
+                     const Eigen::MatrixXd &matrix_u_lower,
+                     const Eigen::MatrixXd &matrix_u_upper,
+                     const Eigen::MatrixXd &matrix_x_lower,
+                     const Eigen::MatrixXd &matrix_x_upper,
+                     const Eigen::MatrixXd &matrix_x_ref) {
+  if (static_cast<size_t>(matrix_b.rows()) != state_dim_ ||
+      static_cast<size_t>(matrix_b.cols()) != control_dim_ ||
+      matrix_a.rows() != matrix_a_.rows() ||
+      matrix_a.cols() != matrix_a_.cols()) {
+    AERROR << "MPC problem size changed, state_dim: " << matrix_b.rows()
+           << ", control_dim: " << matrix_b.cols();
+    return false;
+  }
+  matrix_a_ = matrix_a;
+  matrix_b_ = matrix_b;
+  matrix_q_ = matrix_q;
+  matrix_r_ = matrix_r;
+  matrix_initial_x_ = matrix_initial_x;
+  matrix_u_lower_ = matrix_u_lower;
+  matrix_u_upper_ = matrix_u_upper;
+  matrix_x_lower_ = matrix_x_lower;
+  matrix_x_upper_ = matrix_x_upper;
+  matrix_x_ref_ = matrix_x_ref;
+  return true;
+}
+
 void MpcOsqp::CalculateKernel(std::vector<c_float> *P_data,
                               std::vector<c_int> *P_indices,
                               std::vector<c_int> *P_indptr) {
@@ -177,6 +227,43 @@ void MpcOsqp::CalculateEqualityConstraint(std::vector<c_float> *A_data,
   A_indptr->emplace_back(ind_A);
 }
 
+void MpcOsqp::CalculateStructuralConstraint(std::vector<c_float> *A_data,
+                                            std::vector<c_int> *A_indices,
+                                            std::vector<c_int> *A_indptr) {
+  // rows: x(0) = x_init, x(k+1) = A*x(k) + B*u(k), then the bounds of all
+  // the variables; the entries of each column are in row order
+  const size_t state_total_dim = state_dim_ * (horizon_ + 1);
+  A_indptr->emplace_back(0);
+  // state and terminal state
+  for (size_t i = 0; i <= horizon_; ++i) {
+    for (size_t j = 0; j < state_dim_; ++j) {
+      A_data->emplace_back(-1.0);
+      A_indices->emplace_back(i * state_dim_ + j);
+      if (i < horizon_) {
+        for (size_t k = 0; k < state_dim_; ++k) {
+          A_data->emplace_back(matrix_a_(k, j));
+          A_indices->emplace_back((i + 1) * state_dim_ + k);
+        }
+      }
+      A_data->emplace_back(1.0);
+      A_indices->emplace_back(state_total_dim + i * state_dim_ + j);
+      A_indptr->emplace_back(A_data->size());
+    }
+  }
+  // control
+  for (size_t i = 0; i < horizon_; ++i) {
+    for (size_t j = 0; j < control_dim_; ++j) {
+      for (size_t k = 0; k < state_dim_; ++k) {
+        A_data->emplace_back(matrix_b_(k, j));
+        A_indices->emplace_back((i + 1) * state_dim_ + k);
+      }
+      A_data->emplace_back(1.0);
+      A_indices->emplace_back(2 * state_total_dim + i * control_dim_ + j);
+      A_indptr->emplace_back(A_data->size());
+    }
+  }
+}
+
 void MpcOsqp::CalculateConstraintVectors() {
   // evaluate the lower and the upper inequality vectors
   Eigen::VectorXd lowerInequality = Eigen::MatrixXd::Zero(
@@ -213,6 +300,10 @@ void MpcOsqp::CalculateConstraintVectors() {
   upperBound_ = Eigen::MatrixXd::Zero(
       2 * state_dim_ * (horizon_ + 1) + control_dim_ * horizon_, 1);
   upperBound_ << upperEquality, upperInequality;
+  // the unbounded states are given as the max double, which osqp does not
+  // take as infinite in every version and then fails to converge
+  lowerBound_ = lowerBound_.cwiseMax(-OSQP_INFTY);
+  upperBound_ = upperBound_.cwiseMin(OSQP_INFTY);
   ADEBUG << " upperBound_";
 }
 
@@ -279,6 +370,9 @@ void MpcOsqp::FreeData(OSQPData *data) {
 }
 
 bool MpcOsqp::Solve(std::vector<double> *control_cmd) {
+  if (warm_start_) {
+    return SolveWithWorkspace(control_cmd);
+  }
   ADEBUG << "Before Calc Gradient";
   CalculateGradient();
   ADEBUG << "After Calc Gradient";
@@ -331,6 +425,7 @@ bool MpcOsqp::Solve(std::vector<double> *control_cmd) {
     control_cmd->at(i) = osqp_workspace->solution->x[i + first_control];
     ADEBUG << "control_cmd:" << i << ":" << control_cmd->at(i);
   }
+  iterations_ = static_cast<int>(osqp_workspace->info->iter);
 
   // Cleanup
   osqp_cleanup(osqp_workspace);
@@ -339,6 +434,126 @@ bool MpcOsqp::Solve(std::vector<double> *control_cmd) {
   return true;
 }
 
+bool MpcOsqp::SetupWorkspace() {
+  std::vector<c_float> P_data;
+  std::vector<c_int> P_indices;
+  std::vector<c_int> P_indptr;
+  CalculateKernel(&P_data, &P_indices, &P_indptr);
+  std::vector<c_float> A_data;
+  std::vector<c_int> A_indices;
+  std::vector<c_int> A_indptr;
+  CalculateStructuralConstraint(&A_data, &A_indices, &A_indptr);
+
+  OSQPData data;
+  data.n = num_param_;
+  data.m = lowerBound_.size();
+  data.P = csc_matrix(data.n, data.n, P_data.size(), P_data.data(),
+                      P_indices.data(), P_indptr.data());
+  data.q = gradient_.data();
+  data.A = csc_matrix(data.m, data.n, A_data.size(), A_data.data(),
+                      A_indices.data(), A_indptr.data());
+  data.l = lowerBound_.data();
+  data.u = upperBound_.data();
+
+  OSQPSettings *settings = Settings();
+  settings->warm_start = true;
+  settings->time_limit = time_limit_;
+  osqp_workspace_ = osqp_setup(&data, settings);
+  // osqp_setup copies the problem data and the settings
+  c_free(data.P);
+  c_free(data.A);
+  c_free(settings);
+  if (osqp_workspace_ == nullptr) {
+    AERROR << "failed to set up osqp workspace";
+    return false;
+  }
+  return true;
+}
+
+void MpcOsqp::ShiftSolution() {
+  // primal: states, then controls
+  const size_t state_total_dim = state_dim_ * (horizon_ + 1);
+  ShiftBlocks(0, state_dim_, horizon_ + 1, &primal_);
+  ShiftBlocks(state_total_dim, control_dim_, horizon_, &primal_);
+  // dual: dynamics constraints, then the bounds of the states and controls
+  ShiftBlocks(0, state_dim_, horizon_ + 1, &dual_);
+  ShiftBlocks(state_total_dim, state_dim_, horizon_ + 1, &dual_);
+  ShiftBlocks(2 * state_total_dim, control_dim_, horizon_, &dual_);
+}
+
+void MpcOsqp::ResetWorkspace() {
+  if (osqp_workspace_ != nullptr) {
+    osqp_cleanup(osqp_workspace_);
+    osqp_workspace_ = nullptr;
+  }
+  primal_.clear();
+  dual_.clear();
+}
+
+bool MpcOsqp::SolveWithWorkspace(std::vector<double> *control_cmd) {
+  CalculateGradient();
+  CalculateConstraintVectors();
+
+  if (osqp_workspace_ != nullptr) {
+    // same sparsity, only the values change between control cycles
+    std::vector<c_float> P_data;
+    std::vector<c_int> P_indices;
+    std::vector<c_int> P_indptr;
+    CalculateKernel(&P_data, &P_indices, &P_indptr);
+    std::vector<c_float> A_data;
+    std::vector<c_int> A_indices;
+    std::vector<c_int> A_indptr;
+    CalculateStructuralConstraint(&A_data, &A_indices, &A_indptr);
+    if (osqp_update_P_A(osqp_workspace_, P_data.data(), OSQP_NULL,
+                        P_data.size(), A_data.data(), OSQP_NULL,
+                        A_data.size()) != 0 ||
+        osqp_update_lin_cost(osqp_workspace_, gradient_.data()) != 0 ||
+        osqp_update_bounds(osqp_workspace_, lowerBound_.data(),
+                           upperBound_.data()) != 0) {
+      AWARN << "failed to update the osqp workspace, set up a new one";
+      ResetWorkspace();
+    } else if (!primal_.empty()) {
+      ShiftSolution();
+      osqp_warm_start(osqp_workspace_, primal_.data(), dual_.data());
+    }
+  }
+  if (osqp_workspace_ == nullptr && !SetupWorkspace()) {
+    return false;
+  }
+
+  osqp_solve(osqp_workspace_);
+
+  const auto status = osqp_workspace_->info->status_val;
+  iterations_ = static_cast<int>(osqp_workspace_->info->iter);
+  if (status == OSQP_MAX_ITER_REACHED || status == OSQP_TIME_LIMIT_REACHED) {
+    ADEBUG << "osqp stopped at iteration " << iterations_
+           << ", use the last iterate";
+  } else if (status != OSQP_SOLVED && status != OSQP_SOLVED_INACCURATE) {
+    AERROR << "failed optimization status:\t"
+           << osqp_workspace_->info->status;
+    // do not warm start the next cycle from a failed solution
+    ResetWorkspace();
+    return false;
+  }
+  if (osqp_workspace_->solution == nullptr) {
+    AERROR << "The solution from OSQP is nullptr";
+    ResetWorkspace();
+    return false;
+  }
+
+  const c_float *x = osqp_workspace_->solution->x;
+  const c_float *y = osqp_workspace_->solution->y;
+  primal_.assign(x, x + num_param_);
+  dual_.assign(y, y + lowerBound_.size());
+
+  const size_t first_control = state_dim_ * (horizon_ + 1);
+  for (size_t i = 0; i < control_dim_; ++i) {
+    control_cmd->at(i) = x[i + first_control];
+    ADEBUG << "control_cmd:" << i << ":" << control_cmd->at(i);
+  }
+  return true;
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
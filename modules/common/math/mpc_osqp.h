@@ -52,9 +52,41 @@ class MpcOsqp {
           const Eigen::MatrixXd &matrix_x_ref, const int max_iter,
           const int horizon, const double eps_abs);
 
+  MpcOsqp(const MpcOsqp &) = delete;
+  MpcOsqp &operator=(const MpcOsqp &) = delete;
+
+  ~MpcOsqp();
+
   // control vector
   bool Solve(std::vector<double> *control_cmd);
 
+  /**
+   * @brief Keep the osqp workspace between the solves. The problem structure
+   * is set up at the first solve, the following solves only update the
+   * matrix values, the bounds and the gradient, and start from the previous
+   * solution shifted by one step. The last iterate is used if the solve
+   * stops at the iteration or the time limit.
+   * @param time_limit The time limit of a solve in seconds, 0 for no limit
+   */
+  void EnableWarmStart(const double time_limit);
+
+  /**
+   * @brief Update the problem of the next control cycle, the sizes of the
+   * matrices have to stay the same.
+   * @return false if the problem size changed
+   */
+  bool Update(const Eigen::MatrixXd &matrix_a, const Eigen::MatrixXd &matrix_b,
+              const Eigen::MatrixXd &matrix_q, const Eigen::MatrixXd &matrix_r,
+              const Eigen::MatrixXd &matrix_initial_x,
+              const Eigen::MatrixXd &matrix_u_lower,
+              const Eigen::MatrixXd &matrix_u_upper,
+              const Eigen::MatrixXd &matrix_x_lower,
+              const Eigen::MatrixXd &matrix_x_upper,
+              const Eigen::MatrixXd &matrix_x_ref);
+
+  // iterations of the last solve
+  int iterations() const { return iterations_; }
+
  private:
   void CalculateKernel(std::vector<c_float> *P_data,
                        std::vector<c_int> *P_indices,
@@ -62,6 +94,15 @@ class MpcOsqp {
   void CalculateEqualityConstraint(std::vector<c_float> *A_data,
                                    std::vector<c_int> *A_indices,
                                    std::vector<c_int> *A_indptr);
+  // same constraints with all the entries of A and B kept, so that the
+  // sparsity does not change with their values
+  void CalculateStructuralConstraint(std::vector<c_float> *A_data,
+                                     std::vector<c_int> *A_indices,
+                                     std::vector<c_int> *A_indptr);
+  bool SolveWithWorkspace(std::vector<double> *control_cmd);
+  bool SetupWorkspace();
+  void ShiftSolution();
+  void ResetWorkspace();
   void CalculateGradient();
   void CalculateConstraintVectors();
   OSQPSettings *Settings();
@@ -81,11 +122,11 @@ class MpcOsqp {
   Eigen::MatrixXd matrix_q_;
   Eigen::MatrixXd matrix_r_;
   Eigen::MatrixXd matrix_initial_x_;
-  const Eigen::MatrixXd matrix_u_lower_;
-  const Eigen::MatrixXd matrix_u_upper_;
-  const Eigen::MatrixXd matrix_x_lower_;
-  const Eigen::MatrixXd matrix_x_upper_;
-  const Eigen::MatrixXd matrix_x_ref_;
+  Eigen::MatrixXd matrix_u_lower_;
+  Eigen::MatrixXd matrix_u_upper_;
+  Eigen::MatrixXd matrix_x_lower_;
+  Eigen::MatrixXd matrix_x_upper_;
+  Eigen::MatrixXd matrix_x_ref_;
   int max_iteration_;
   size_t horizon_;
   double eps_abs_;
@@ -96,6 +137,14 @@ class MpcOsqp {
   Eigen::VectorXd gradient_;
   Eigen::VectorXd lowerBound_;
   Eigen::VectorXd upperBound_;
+
+  // persistent workspace for warm start
+  bool warm_start_ = false;
+  double time_limit_ = 0.0;
+  OSQPWorkspace *osqp_workspace_ = nullptr;
+  std::vector<c_float> primal_;
+  std::vector<c_float> dual_;
+  int iterations_ = 0;
 };
 }  // namespace math
 }  // namespace common
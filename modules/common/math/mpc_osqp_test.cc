@@ -19,6 +19,7 @@
 #include <chrono>
 #include <ctime>
 #include <limits>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -174,6 +175,79 @@ TEST(MPCOSQPSolverTest, NullMatrix) {
   EXPECT_NEAR(0.0, control_cmd[0], 1e-7);
 }
 
+TEST(MPCOSQPSolverTest, WarmStart) {
+  const int states = 2;
+  const int controls = 1;
+  const int horizon = 10;
+  const int max_iter = 4000;
+  const double eps = 1e-5;
+  const double ts = 0.1;
+  const double max = std::numeric_limits<double>::max();
+
+  Eigen::MatrixXd A(states, states);
+  A << 1, ts, 0, 1;
+
+  Eigen::MatrixXd B(states, controls);
+  B << 0.5 * ts * ts, ts;
+
+  Eigen::MatrixXd Q(states, states);
+  Q << 1, 0, 0, 1;
+
+  Eigen::MatrixXd R(controls, controls);
+  R << 0.1;
+
+  Eigen::MatrixXd lower_bound(controls, 1);
+  lower_bound << -1;
+
+  Eigen::MatrixXd upper_bound(controls, 1);
+  upper_bound << 1;
+
+  Eigen::MatrixXd reference_state(states, 1);
+  reference_state << 0, 0;
+
+  Eigen::MatrixXd state_lower_bound(states, 1);
+  state_lower_bound << -max, -max;
+
+  Eigen::MatrixXd state_upper_bound(states, 1);
+  state_upper_bound << max, max;
+
+  Eigen::MatrixXd state(states, 1);
+  state << 2, 0;
+
+  std::unique_ptr<MpcOsqp> warm_start_solver;
+  std::vector<double> control_cmd(controls, 0);
+  std::vector<double> warm_start_control_cmd(controls, 0);
+  for (int i = 0; i < 20; ++i) {
+    MpcOsqp mpc_osqp_solver(A, B, Q, R, state, lower_bound, upper_bound,
+                            state_lower_bound, state_upper_bound,
+                            reference_state, max_iter, horizon, eps);
+    ASSERT_TRUE(mpc_osqp_solver.Solve(&control_cmd));
+
+    if (warm_start_solver == nullptr) {
+      warm_start_solver.reset(
+          new MpcOsqp(A, B, Q, R, state, lower_bound, upper_bound,
+                      state_lower_bound, state_upper_bound, reference_state,
+                      max_iter, horizon, eps));
+      warm_start_solver->EnableWarmStart(0.0);
+    } else {
+      ASSERT_TRUE(warm_start_solver->Update(
+          A, B, Q, R, state, lower_bound, upper_bound, state_lower_bound,
+          state_upper_bound, reference_state));
+    }
+    ASSERT_TRUE(warm_start_solver->Solve(&warm_start_control_cmd));
+    EXPECT_NEAR(control_cmd[0], warm_start_control_cmd[0], 1e-3);
+
+    state = A * state + B * control_cmd[0];
+  }
+
+  // the problem size can not change
+  Eigen::MatrixXd B2(states, 2);
+  B2 << 0, 0, 1, 1;
+  EXPECT_FALSE(warm_start_solver->Update(
+      A, B2, Q, R, state, lower_bound, upper_bound, state_lower_bound,
+      state_upper_bound, reference_state));
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -0,0 +1,129 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Defines the templated ShapeKDTree2d class.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "cyber/common/macros.h"
+
+#include "modules/common/math/aabox2d.h"
+#include "modules/common/math/aaboxkdtree2d.h"
+#include "modules/common/math/box2d.h"
+#include "modules/common/math/line_segment2d.h"
+#include "modules/common/math/math_utils.h"
+#include "modules/common/math/vec2d.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+/**
+ * @class ShapeKDTreeObject2d
+ * @brief A Box2d or LineSegment2d with its index in the input of
+ *        ShapeKDTree2d, as an object of AABoxKDTree2d.
+ */
+template <class Shape>
+class ShapeKDTreeObject2d {
+ public:
+  ShapeKDTreeObject2d(const Shape &shape, const size_t index)
+      : shape_(shape), aabox_(GetAABox(shape)), index_(index) {}
+  const AABox2d &aabox() const { return aabox_; }
+  double DistanceTo(const Vec2d &point) const {
+    return shape_.DistanceTo(point);
+  }
+  double DistanceSquareTo(const Vec2d &point) const {
+    return Square(shape_.DistanceTo(point));
+  }
+  const Shape &shape() const { return shape_; }
+  size_t index() const { return index_; }
+
+ private:
+  static AABox2d GetAABox(const Box2d &box) { return box.GetAABox(); }
+  static AABox2d GetAABox(const LineSegment2d &segment) {
+    return AABox2d(segment.start(), segment.end());
+  }
+
+  Shape shape_;
+  AABox2d aabox_;
+  size_t index_ = 0;
+};
+
+/**
+ * @class ShapeKDTree2d
+ * @brief KD-tree over 2d shapes for the broad phase of overlap checks: only
+ *        the shapes returned by a query need the exact test.
+ */
+template <class Shape>
+class ShapeKDTree2d {
+ public:
+  using Object = ShapeKDTreeObject2d<Shape>;
+
+  explicit ShapeKDTree2d(const std::vector<Shape> &shapes) {
+    if (shapes.empty()) {
+      return;
+    }
+    objects_.reserve(shapes.size());
+    for (size_t i = 0; i < shapes.size(); ++i) {
+      objects_.emplace_back(shapes[i], i);
+    }
+    AABoxKDTreeParams params;
+    params.max_leaf_dimension = 5.0;  // meters.
+    params.max_leaf_size = 4;
+    kdtree_.reset(new AABoxKDTree2d<Object>(objects_, params));
+  }
+
+  bool empty() const { return objects_.empty(); }
+
+  size_t size() const { return objects_.size(); }
+
+  /**
+   * @brief Get the shapes within the distance of the point.
+   */
+  std::vector<const Object *> GetObjects(const Vec2d &point,
+                                         const double distance) const {
+    if (kdtree_ == nullptr) {
+      return {};
+    }
+    return kdtree_->GetObjects(point, distance);
+  }
+
+  /**
+   * @brief Get the shapes which may overlap with the box, including every
+   *        shape which does.
+   */
+  std::vector<const Object *> GetOverlapCandidates(const Box2d &box) const {
+    // any point of the box is within half of its diagonal from the center
+    return GetObjects(box.center(), box.diagonal() / 2.0 + kMathEpsilon);
+  }
+
+ private:
+  // the kd-tree points into objects_
+  std::vector<Object> objects_;
+  std::unique_ptr<AABoxKDTree2d<Object>> kdtree_;
+
+  DISALLOW_COPY_AND_ASSIGN(ShapeKDTree2d);
+};
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
@@ -0,0 +1,96 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/common/math/shape_kdtree2d.h"
+
+#include <set>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+namespace {
+
+constexpr double kSize = 50.0;
+constexpr int kNumShapes = 200;
+constexpr int kNumQueries = 500;
+
+Box2d RandomBox() {
+  return Box2d({RandomDouble(-kSize, kSize), RandomDouble(-kSize, kSize)},
+               RandomDouble(-M_PI, M_PI), RandomDouble(0.5, 6.0),
+               RandomDouble(0.5, 3.0));
+}
+
+template <class Shape>
+std::set<size_t> GetIndices(const ShapeKDTree2d<Shape> &kdtree,
+                            const Box2d &box) {
+  std::set<size_t> indices;
+  for (const auto *object : kdtree.GetOverlapCandidates(box)) {
+    indices.insert(object->index());
+  }
+  return indices;
+}
+
+}  // namespace
+
+TEST(ShapeKDTree2d, Empty) {
+  ShapeKDTree2d<Box2d> kdtree({});
+  EXPECT_TRUE(kdtree.empty());
+  EXPECT_TRUE(kdtree.GetOverlapCandidates(RandomBox()).empty());
+}
+
+TEST(ShapeKDTree2d, BoxCandidates) {
+  std::vector<Box2d> boxes;
+  for (int i = 0; i < kNumShapes; ++i) {
+    boxes.push_back(RandomBox());
+  }
+  ShapeKDTree2d<Box2d> kdtree(boxes);
+  EXPECT_EQ(boxes.size(), kdtree.size());
+  for (int i = 0; i < kNumQueries; ++i) {
+    const Box2d box = RandomBox();
+    const auto indices = GetIndices(kdtree, box);
+    for (size_t j = 0; j < boxes.size(); ++j) {
+      if (box.HasOverlap(boxes[j])) {
+        EXPECT_EQ(1, indices.count(j));
+      }
+    }
+  }
+}
+
+TEST(ShapeKDTree2d, SegmentCandidates) {
+  std::vector<LineSegment2d> segments;
+  for (int i = 0; i < kNumShapes; ++i) {
+    const Vec2d start(RandomDouble(-kSize, kSize), RandomDouble(-kSize, kSize));
+    segments.emplace_back(
+        start, start + Vec2d(RandomDouble(-5.0, 5.0), RandomDouble(-5.0, 5.0)));
+  }
+  ShapeKDTree2d<LineSegment2d> kdtree(segments);
+  for (int i = 0; i < kNumQueries; ++i) {
+    const Box2d box = RandomBox();
+    const auto indices = GetIndices(kdtree, box);
+    for (size_t j = 0; j < segments.size(); ++j) {
+      if (box.HasOverlap(segments[j])) {
+        EXPECT_EQ(1, indices.count(j));
+      }
+    }
+  }
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
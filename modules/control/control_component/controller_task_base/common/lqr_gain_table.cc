@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/control/control_component/controller_task_base/common/lqr_gain_table.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace control {
+
+bool LqrGainTable::Init(const double min_speed, const double max_speed,
+                        const double resolution, const GainSolver &solver) {
+  Clear();
+  if (resolution <= 0.0 || max_speed < min_speed) {
+    AERROR << "invalid speed grid, min_speed: " << min_speed
+           << ", max_speed: " << max_speed << ", resolution: " << resolution;
+    return false;
+  }
+  const size_t num_speeds =
+      static_cast<size_t>(std::floor((max_speed - min_speed) / resolution)) +
+      1;
+  min_speed_ = min_speed;
+  resolution_ = resolution;
+  gains_.resize(num_speeds);
+  for (size_t i = 0; i < num_speeds; ++i) {
+    solver(min_speed_ + resolution_ * static_cast<double>(i), &gains_[i]);
+    if (gains_[i].size() == 0 || gains_[i].rows() != gains_.front().rows() ||
+        gains_[i].cols() != gains_.front().cols()) {
+      AERROR << "inconsistent gain at speed: "
+             << min_speed_ + resolution_ * static_cast<double>(i);
+      Clear();
+      return false;
+    }
+  }
+  ADEBUG << "LQR gain table built with " << num_speeds << " speeds in ["
+         << min_speed_ << ", " << LqrGainTable::max_speed() << "]";
+  return true;
+}
+
+bool LqrGainTable::Interpolate(const double speed,
+                               Eigen::MatrixXd *gain) const {
+  if (empty() || speed < min_speed_ || speed > max_speed()) {
+    return false;
+  }
+  if (gains_.size() == 1) {
+    *gain = gains_.front();
+    return true;
+  }
+  const double index = (speed - min_speed_) / resolution_;
+  const size_t lower =
+      std::min(static_cast<size_t>(index), gains_.size() - 2);
+  const double ratio = index - static_cast<double>(lower);
+  *gain = gains_[lower] + ratio * (gains_[lower + 1] - gains_[lower]);
+  return true;
+}
+
+void LqrGainTable::Clear() {
+  min_speed_ = 0.0;
+  resolution_ = 0.0;
+  gains_.clear();
+}
+
+}  // namespace control
+}  // namespace apollo
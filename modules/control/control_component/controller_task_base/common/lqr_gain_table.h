@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Defines the LqrGainTable class.
+ */
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "Eigen/Core"
+
+/**
+ * @namespace apollo::control
+ * @brief apollo::control
+ */
+namespace apollo {
+namespace control {
+
+/**
+ * @class LqrGainTable
+ *
+ * @brief Gain scheduled LQR feedback. The feedback gains are solved once on
+ * a uniform speed grid and linearly interpolated between the grid points,
+ * instead of solving the Riccati equation every control cycle.
+ */
+class LqrGainTable {
+ public:
+  /**
+   * @brief solves the feedback gain of the system at the given speed
+   */
+  using GainSolver = std::function<void(const double speed, Eigen::MatrixXd *)>;
+
+  LqrGainTable() = default;
+
+  /**
+   * @brief solve the gains on the speed grid
+   * @param min_speed the first speed of the grid
+   * @param max_speed the last speed of the grid is no more than it
+   * @param resolution the speed interval of the grid
+   * @param solver the solver of the gain at a grid speed
+   * @return true if the table is built
+   */
+  bool Init(const double min_speed, const double max_speed,
+            const double resolution, const GainSolver &solver);
+
+  /**
+   * @brief interpolate the gain at the given speed
+   * @param speed the speed to look up
+   * @param gain the interpolated gain
+   * @return false if the table is empty or the speed is out of the grid,
+   *         the gain should be solved by the caller then
+   */
+  bool Interpolate(const double speed, Eigen::MatrixXd *gain) const;
+
+  /**
+   * @brief clear the table
+   */
+  void Clear();
+
+  bool empty() const { return gains_.empty(); }
+
+  double min_speed() const { return min_speed_; }
+
+  double max_speed() const {
+    return empty() ? min_speed_
+                   : min_speed_ + resolution_ *
+                                      static_cast<double>(gains_.size() - 1);
+  }
+
+ private:
+  double min_speed_ = 0.0;
+  double resolution_ = 0.0;
+  std::vector<Eigen::MatrixXd> gains_;
+};
+
+}  // namespace control
+}  // namespace apollo
@@ -0,0 +1,160 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// LQR feedback gain of the lateral controller per control cycle, solved from
+// the Riccati equation with dynamic or fixed size matrices, or interpolated
+// from the gain table. The speed sweeps from 0.5m/s to 30m/s over the cycles.
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "modules/common/math/linear_quadratic_regulator.h"
+#include "modules/control/control_component/controller_task_base/common/lqr_gain_table.h"
+
+namespace apollo {
+namespace control {
+namespace {
+
+using Matrix = Eigen::MatrixXd;
+
+// the lateral controller conf
+constexpr double kTs = 0.01;
+constexpr double kCf = 155494.663;
+constexpr double kCr = 155494.663;
+constexpr double kMass = 2080.0;
+constexpr double kLf = 1.4;
+constexpr double kLr = 1.4;
+constexpr double kIz = kLf * kLf * kMass / 2.0 + kLr * kLr * kMass / 2.0;
+constexpr double kEps = 0.01;
+constexpr int kMaxIteration = 150;
+
+class LateralModel {
+ public:
+  LateralModel() {
+    matrix_bd_ = Matrix::Zero(4, 1);
+    matrix_bd_(1, 0) = kCf / kMass * kTs;
+    matrix_bd_(3, 0) = kLf * kCf / kIz * kTs;
+    matrix_q_ = Matrix::Zero(4, 4);
+    matrix_q_(0, 0) = 0.05;
+    matrix_q_(2, 2) = 1.0;
+    matrix_r_ = Matrix::Identity(1, 1);
+    for (double speed = 0.5; speed < 30.0; speed += 0.37) {
+      speeds_.push_back(speed);
+    }
+  }
+
+  Matrix MatrixAd(const double speed) const {
+    Matrix matrix_a = Matrix::Zero(4, 4);
+    matrix_a(0, 1) = 1.0;
+    matrix_a(1, 1) = -(kCf + kCr) / kMass / speed;
+    matrix_a(1, 2) = (kCf + kCr) / kMass;
+    matrix_a(1, 3) = (kLr * kCr - kLf * kCf) / kMass / speed;
+    matrix_a(2, 3) = 1.0;
+    matrix_a(3, 1) = (kLr * kCr - kLf * kCf) / kIz / speed;
+    matrix_a(3, 2) = (kLf * kCf - kLr * kCr) / kIz;
+    matrix_a(3, 3) = -1.0 * (kLf * kLf * kCf + kLr * kLr * kCr) / kIz / speed;
+    const Matrix matrix_i = Matrix::Identity(4, 4);
+    return (matrix_i - kTs * 0.5 * matrix_a).inverse() *
+           (matrix_i + kTs * 0.5 * matrix_a);
+  }
+
+  void SolveGain(const double speed, Matrix *gain) const {
+    uint num_iteration = 0;
+    double result_diff = 0.0;
+    common::math::SolveLQRProblem(MatrixAd(speed), matrix_bd_, matrix_q_,
+                                  matrix_r_, kEps, kMaxIteration, gain,
+                                  &num_iteration, &result_diff);
+  }
+
+  const Matrix &matrix_bd() const { return matrix_bd_; }
+  const Matrix &matrix_q() const { return matrix_q_; }
+  const Matrix &matrix_r() const { return matrix_r_; }
+  const std::vector<double> &speeds() const { return speeds_; }
+
+ private:
+  Matrix matrix_bd_;
+  Matrix matrix_q_;
+  Matrix matrix_r_;
+  std::vector<double> speeds_;
+};
+
+void BM_SolveLQRProblem(benchmark::State &state) {  // NOLINT
+  const LateralModel model;
+  std::vector<Matrix> matrix_ads;
+  for (const double speed : model.speeds()) {
+    matrix_ads.push_back(model.MatrixAd(speed));
+  }
+  Matrix gain;
+  size_t i = 0;
+  for (auto _ : state) {
+    uint num_iteration = 0;
+    double result_diff = 0.0;
+    common::math::SolveLQRProblem(matrix_ads[i], model.matrix_bd(),
+                                  model.matrix_q(), model.matrix_r(), kEps,
+                                  kMaxIteration, &gain, &num_iteration,
+                                  &result_diff);
+    benchmark::DoNotOptimize(gain.data());
+    i = (i + 1) % matrix_ads.size();
+  }
+}
+
+void BM_SolveLQRProblemFixedSize(benchmark::State &state) {  // NOLINT
+  const LateralModel model;
+  std::vector<Eigen::Matrix4d> matrix_ads;
+  for (const double speed : model.speeds()) {
+    matrix_ads.emplace_back(model.MatrixAd(speed));
+  }
+  const Eigen::Matrix<double, 4, 1> matrix_bd = model.matrix_bd();
+  const Eigen::Matrix4d matrix_q = model.matrix_q();
+  const Eigen::Matrix<double, 1, 1> matrix_r = model.matrix_r();
+  Eigen::Matrix<double, 1, 4> gain;
+  size_t i = 0;
+  for (auto _ : state) {
+    uint num_iteration = 0;
+    double result_diff = 0.0;
+    common::math::SolveLQRProblem<4, 1>(matrix_ads[i], matrix_bd, matrix_q,
+                                        matrix_r, kEps, kMaxIteration, &gain,
+                                        &num_iteration, &result_diff);
+    benchmark::DoNotOptimize(gain.data());
+    i = (i + 1) % matrix_ads.size();
+  }
+}
+
+void BM_LqrGainTableInterpolate(benchmark::State &state) {  // NOLINT
+  const LateralModel model;
+  LqrGainTable table;
+  table.Init(0.1, 35.0, 0.2, [&model](const double speed, Matrix *gain) {
+    model.SolveGain(speed, gain);
+  });
+  Matrix gain;
+  size_t i = 0;
+  for (auto _ : state) {
+    table.Interpolate(model.speeds()[i], &gain);
+    benchmark::DoNotOptimize(gain.data());
+    i = (i + 1) % model.speeds().size();
+  }
+}
+
+BENCHMARK(BM_SolveLQRProblem);
+BENCHMARK(BM_SolveLQRProblemFixedSize);
+BENCHMARK(BM_LqrGainTableInterpolate);
+
+}  // namespace
+}  // namespace control
+}  // namespace apollo
+
+BENCHMARK_MAIN();
@@ -0,0 +1,167 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/control/control_component/controller_task_base/common/lqr_gain_table.h"
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "modules/common/math/linear_quadratic_regulator.h"
+
+namespace apollo {
+namespace control {
+
+using Matrix = Eigen::MatrixXd;
+
+class LqrGainTableTest : public ::testing::Test {
+ public:
+  virtual void SetUp() {
+    // lateral dynamic model of the vehicle in the lateral controller conf
+    const double cf = 155494.663;
+    const double cr = 155494.663;
+    const double mass = 2080.0;
+    const double lf = 1.4;
+    const double lr = 1.4;
+    const double iz = lf * lf * mass / 2.0 + lr * lr * mass / 2.0;
+    matrix_a_ = Matrix::Zero(4, 4);
+    matrix_a_(0, 1) = 1.0;
+    matrix_a_(1, 2) = (cf + cr) / mass;
+    matrix_a_(2, 3) = 1.0;
+    matrix_a_(3, 2) = (lf * cf - lr * cr) / iz;
+    matrix_a_coeff_ = Matrix::Zero(4, 4);
+    matrix_a_coeff_(1, 1) = -(cf + cr) / mass;
+    matrix_a_coeff_(1, 3) = (lr * cr - lf * cf) / mass;
+    matrix_a_coeff_(3, 1) = (lr * cr - lf * cf) / iz;
+    matrix_a_coeff_(3, 3) = -1.0 * (lf * lf * cf + lr * lr * cr) / iz;
+    matrix_bd_ = Matrix::Zero(4, 1);
+    matrix_bd_(1, 0) = cf / mass * ts_;
+    matrix_bd_(3, 0) = lf * cf / iz * ts_;
+    matrix_q_ = Matrix::Zero(4, 4);
+    matrix_q_(0, 0) = 0.05;
+    matrix_q_(2, 2) = 1.0;
+    matrix_r_ = Matrix::Identity(1, 1);
+  }
+
+ protected:
+  void SolveGain(const double speed, Matrix *gain) const {
+    Matrix matrix_a = matrix_a_;
+    matrix_a(1, 1) = matrix_a_coeff_(1, 1) / speed;
+    matrix_a(1, 3) = matrix_a_coeff_(1, 3) / speed;
+    matrix_a(3, 1) = matrix_a_coeff_(3, 1) / speed;
+    matrix_a(3, 3) = matrix_a_coeff_(3, 3) / speed;
+    const Matrix matrix_i = Matrix::Identity(4, 4);
+    const Matrix matrix_ad = (matrix_i - ts_ * 0.5 * matrix_a).inverse() *
+                             (matrix_i + ts_ * 0.5 * matrix_a);
+    uint num_iteration = 0;
+    double result_diff = 0.0;
+    common::math::SolveLQRProblem(matrix_ad, matrix_bd_, matrix_q_, matrix_r_,
+                                  1.0e-6, 10000, gain, &num_iteration,
+                                  &result_diff);
+  }
+
+  const double ts_ = 0.01;
+  Matrix matrix_a_;
+  Matrix matrix_a_coeff_;
+  Matrix matrix_bd_;
+  Matrix matrix_q_;
+  Matrix matrix_r_;
+};
+
+TEST_F(LqrGainTableTest, Init) {
+  LqrGainTable table;
+  EXPECT_TRUE(table.empty());
+  EXPECT_FALSE(table.Init(1.0, 0.5, 0.1, [this](double speed, Matrix *gain) {
+    SolveGain(speed, gain);
+  }));
+  EXPECT_FALSE(table.Init(1.0, 2.0, 0.0, [this](double speed, Matrix *gain) {
+    SolveGain(speed, gain);
+  }));
+  EXPECT_FALSE(table.Init(1.0, 2.0, 0.5, [](double speed, Matrix *gain) {
+    *gain = Matrix::Zero(1, speed < 1.5 ? 4 : 5);
+  }));
+  EXPECT_TRUE(table.empty());
+
+  EXPECT_TRUE(table.Init(1.0, 10.2, 0.5, [this](double speed, Matrix *gain) {
+    SolveGain(speed, gain);
+  }));
+  EXPECT_FALSE(table.empty());
+  EXPECT_DOUBLE_EQ(1.0, table.min_speed());
+  EXPECT_DOUBLE_EQ(10.0, table.max_speed());
+}
+
+TEST_F(LqrGainTableTest, Interpolate) {
+  LqrGainTable table;
+  Matrix gain;
+  EXPECT_FALSE(table.Interpolate(5.0, &gain));
+
+  ASSERT_TRUE(table.Init(1.0, 30.0, 0.2, [this](double speed, Matrix *gain) {
+    SolveGain(speed, gain);
+  }));
+  EXPECT_FALSE(table.Interpolate(0.5, &gain));
+  EXPECT_FALSE(table.Interpolate(30.5, &gain));
+
+  // exact on the grid
+  Matrix expected_gain;
+  for (const double speed : {1.0, 5.0, 30.0}) {
+    ASSERT_TRUE(table.Interpolate(speed, &gain));
+    SolveGain(speed, &expected_gain);
+    ASSERT_EQ(1, gain.rows());
+    ASSERT_EQ(4, gain.cols());
+    for (int i = 0; i < 4; ++i) {
+      EXPECT_NEAR(expected_gain(0, i), gain(0, i), 1.0e-9);
+    }
+  }
+
+  // close to the solved gains between the grid points
+  for (const double speed : {1.1, 3.33, 7.9, 15.05, 29.9}) {
+    ASSERT_TRUE(table.Interpolate(speed, &gain));
+    SolveGain(speed, &expected_gain);
+    for (int i = 0; i < 4; ++i) {
+      EXPECT_NEAR(expected_gain(0, i), gain(0, i),
+                  0.01 * std::fabs(expected_gain(0, i)) + 1.0e-6);
+    }
+  }
+}
+
+TEST_F(LqrGainTableTest, FixedSizeSolver) {
+  Matrix gain;
+  SolveGain(10.0, &gain);
+
+  Matrix matrix_a = matrix_a_;
+  matrix_a(1, 1) = matrix_a_coeff_(1, 1) / 10.0;
+  matrix_a(1, 3) = matrix_a_coeff_(1, 3) / 10.0;
+  matrix_a(3, 1) = matrix_a_coeff_(3, 1) / 10.0;
+  matrix_a(3, 3) = matrix_a_coeff_(3, 3) / 10.0;
+  const Eigen::Matrix4d matrix_i = Eigen::Matrix4d::Identity();
+  const Eigen::Matrix4d matrix_ad =
+      (matrix_i - ts_ * 0.5 * matrix_a).inverse() *
+      (matrix_i + ts_ * 0.5 * matrix_a);
+  Eigen::Matrix<double, 1, 4> fixed_gain;
+  uint num_iteration = 0;
+  double result_diff = 0.0;
+  common::math::SolveLQRProblem<4, 1>(
+      matrix_ad, Eigen::Matrix<double, 4, 1>(matrix_bd_),
+      Eigen::Matrix4d(matrix_q_), Eigen::Matrix<double, 1, 1>(matrix_r_),
+      1.0e-6, 10000, &fixed_gain, &num_iteration, &result_diff);
+  EXPECT_LT(result_diff, 1.0e-6);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_NEAR(gain(0, i), fixed_gain(0, i), 1.0e-9);
+  }
+}
+
+}  // namespace control
+}  // namespace apollo
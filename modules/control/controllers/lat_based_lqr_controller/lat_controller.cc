@@ -247,6 +247,7 @@ Status LatController::Init(std::shared_ptr<DependencyInjector> injector) {
   matrix_q_updated_ = matrix_q_;
   InitializeFilters();
   LoadLatGainScheduler();
+  LoadLqrGainTable();
   LogInitParameters();
 
   enable_leadlag_ =
@@ -297,6 +298,46 @@ void LatController::LoadLatGainScheduler() {
       << "Fail to load heading error gain scheduler";
 }
 
+void LatController::LoadLqrGainTable() {
+  enable_lqr_gain_table_ =
+      lat_based_lqr_controller_conf_.enable_lqr_gain_table();
+  drive_lqr_gain_table_.Clear();
+  reverse_lqr_gain_table_.Clear();
+  if (!enable_lqr_gain_table_) {
+    return;
+  }
+  // The grid starts at the minimum speed protection, so that the tabulated
+  // models are the same as the ones solved at runtime
+  const double resolution =
+      lat_based_lqr_controller_conf_.lqr_gain_table_resolution();
+  const double max_speed =
+      lat_based_lqr_controller_conf_.lqr_gain_table_max_speed();
+  for (const bool reverse : {false, true}) {
+    UpdateDynamicModel(reverse);
+    const double direction =
+        reverse && !lat_based_lqr_controller_conf_.reverse_use_dynamic_model()
+            ? -1.0
+            : 1.0;
+    auto *table = reverse ? &reverse_lqr_gain_table_ : &drive_lqr_gain_table_;
+    if (!table->Init(minimum_speed_protection_, max_speed, resolution,
+                     [this, reverse, direction](const double speed,
+                                                Matrix *matrix_k) {
+                       UpdateMatrix(reverse, direction * speed);
+                       UpdateMatrixCompound();
+                       UpdateMatrixQ(reverse, speed);
+                       uint num_iteration = 0;
+                       double result_diff = 0.0;
+                       SolveLqr(matrix_k, &num_iteration, &result_diff);
+                     })) {
+      AERROR << "Fail to build lqr gain table, solve lqr at runtime";
+      enable_lqr_gain_table_ = false;
+      break;
+    }
+  }
+  UpdateDynamicModel(false);
+  AINFO << "Lateral control lqr gain table loaded: " << enable_lqr_gain_table_;
+}
+
 void LatController::Stop() { CloseLogFile(); }
 
 std::string LatController::Name() const { return name_; }
@@ -391,48 +432,8 @@ Status LatController::ComputeControlCommand(
   // Re-build the vehicle dynamic models at reverse driving (in particular,
   // replace the lateral translational motion dynamics with the corresponding
   // kinematic models)
-  if (vehicle_state->gear() == canbus::Chassis::GEAR_REVERSE) {
-    /*
-    A matrix (Gear Reverse)
-    [0.0, 0.0, 1.0 * v 0.0;
-     0.0, (-(c_f + c_r) / m) / v, (c_f + c_r) / m,
-     (l_r * c_r - l_f * c_f) / m / v;
-     0.0, 0.0, 0.0, 1.0;
-     0.0, ((lr * cr - lf * cf) / i_z) / v, (l_f * c_f - l_r * c_r) / i_z,
-     (-1.0 * (l_f^2 * c_f + l_r^2 * c_r) / i_z) / v;]
-    */
-    cf_ = -lat_based_lqr_controller_conf_.cf();
-    cr_ = -lat_based_lqr_controller_conf_.cr();
-    matrix_a_(0, 1) = 0.0;
-    matrix_a_coeff_(0, 2) = 1.0;
-  } else {
-    /*
-    A matrix (Gear Drive)
-    [0.0, 1.0, 0.0, 0.0;
-     0.0, (-(c_f + c_r) / m) / v, (c_f + c_r) / m,
-     (l_r * c_r - l_f * c_f) / m / v;
-     0.0, 0.0, 0.0, 1.0;
-     0.0, ((lr * cr - lf * cf) / i_z) / v, (l_f * c_f - l_r * c_r) / i_z,
-     (-1.0 * (l_f^2 * c_f + l_r^2 * c_r) / i_z) / v;]
-    */
-    cf_ = lat_based_lqr_controller_conf_.cf();
-    cr_ = lat_based_lqr_controller_conf_.cr();
-    matrix_a_(0, 1) = 1.0;
-    matrix_a_coeff_(0, 2) = 0.0;
-  }
-  matrix_a_(1, 2) = (cf_ + cr_) / mass_;
-  matrix_a_(3, 2) = (lf_ * cf_ - lr_ * cr_) / iz_;
-  matrix_a_coeff_(1, 1) = -(cf_ + cr_) / mass_;
-  matrix_a_coeff_(1, 3) = (lr_ * cr_ - lf_ * cf_) / mass_;
-  matrix_a_coeff_(3, 1) = (lr_ * cr_ - lf_ * cf_) / iz_;
-  matrix_a_coeff_(3, 3) = -1.0 * (lf_ * lf_ * cf_ + lr_ * lr_ * cr_) / iz_;
-
-  /*
-  b = [0.0, c_f / m, 0.0, l_f * c_f / i_z]^T
-  */
-  matrix_b_(1, 0) = cf_ / mass_;
-  matrix_b_(3, 0) = lf_ * cf_ / iz_;
-  matrix_bd_ = matrix_b_ * ts_;
+  const bool reverse = vehicle_state->gear() == canbus::Chassis::GEAR_REVERSE;
+  UpdateDynamicModel(reverse);
 
   UpdateDrivingOrientation();
 
@@ -443,47 +444,26 @@ Status LatController::ComputeControlCommand(
   // Error Rate, preview lateral error1 , preview lateral error2, ...]
   UpdateState(debug, chassis);
 
-  UpdateMatrix();
+  uint num_iteration = 0;
+  double result_diff = 0.0;
+  // Look up the lqr gains solved at init, or solve them at the current speed
+  if (!InterpolateLqrGain(reverse, vehicle_state->linear_velocity(),
+                          &matrix_k_)) {
+    UpdateMatrix(reverse, vehicle_state->linear_velocity());
 
-  // Compound discrete matrix with road preview model
-  UpdateMatrixCompound();
+    // Compound discrete matrix with road preview model
+    UpdateMatrixCompound();
 
-  // Adjust matrix_q_updated when in reverse gear
-  int q_param_size = lat_based_lqr_controller_conf_.matrix_q_size();
-  int reverse_q_param_size =
-      lat_based_lqr_controller_conf_.reverse_matrix_q_size();
-  if (injector_->vehicle_state()->gear() == canbus::Chassis::GEAR_REVERSE) {
-    for (int i = 0; i < reverse_q_param_size; ++i) {
-      matrix_q_(i, i) = lat_based_lqr_controller_conf_.reverse_matrix_q(i);
-    }
-  } else {
-    for (int i = 0; i < q_param_size; ++i) {
-      matrix_q_(i, i) = lat_based_lqr_controller_conf_.matrix_q(i);
-    }
-  }
+    // Adjust matrix_q_updated when in reverse gear, and add gain scheduler
+    // for higher speed steering
+    UpdateMatrixQ(reverse, std::fabs(vehicle_state->linear_velocity()));
 
-  uint num_iteration;
-  double result_diff;
-  // Add gain scheduler for higher speed steering
-  if (FLAGS_enable_gain_scheduler) {
-    matrix_q_updated_(0, 0) =
-        matrix_q_(0, 0) * lat_err_interpolation_->Interpolate(
-                              std::fabs(vehicle_state->linear_velocity()));
-    matrix_q_updated_(2, 2) =
-        matrix_q_(2, 2) * heading_err_interpolation_->Interpolate(
-                              std::fabs(vehicle_state->linear_velocity()));
-    common::math::SolveLQRProblem(matrix_adc_, matrix_bdc_, matrix_q_updated_,
-                                  matrix_r_, lqr_eps_, lqr_max_iteration_,
-                                  &matrix_k_, &num_iteration, &result_diff);
-  } else {
-    common::math::SolveLQRProblem(matrix_adc_, matrix_bdc_, matrix_q_,
-                                  matrix_r_, lqr_eps_, lqr_max_iteration_,
-                                  &matrix_k_, &num_iteration, &result_diff);
-  }
+    SolveLqr(&matrix_k_, &num_iteration, &result_diff);
 
-  ADEBUG << "LQR num_iteration is " << num_iteration
-        << ", max iteration threshold is " << lqr_max_iteration_
-        << "; result_diff is " << result_diff;
+    ADEBUG << "LQR num_iteration is " << num_iteration
+           << ", max iteration threshold is " << lqr_max_iteration_
+           << "; result_diff is " << result_diff;
+  }
 
   // feedback = - K * state
   // Convert vehicle steer angle from rad to degree and then to steer degree
@@ -708,18 +688,65 @@ void LatController::UpdateState(SimpleLateralDebug *debug,
   }
 }
 
-void LatController::UpdateMatrix() {
+void LatController::UpdateDynamicModel(const bool reverse) {
+  if (reverse) {
+    /*
+    A matrix (Gear Reverse)
+    [0.0, 0.0, 1.0 * v 0.0;
+     0.0, (-(c_f + c_r) / m) / v, (c_f + c_r) / m,
+     (l_r * c_r - l_f * c_f) / m / v;
+     0.0, 0.0, 0.0, 1.0;
+     0.0, ((lr * cr - lf * cf) / i_z) / v, (l_f * c_f - l_r * c_r) / i_z,
+     (-1.0 * (l_f^2 * c_f + l_r^2 * c_r) / i_z) / v;]
+    */
+    cf_ = -lat_based_lqr_controller_conf_.cf();
+    cr_ = -lat_based_lqr_controller_conf_.cr();
+    matrix_a_(0, 1) = 0.0;
+    matrix_a_coeff_(0, 2) = 1.0;
+  } else {
+    /*
+    A matrix (Gear Drive)
+    [0.0, 1.0, 0.0, 0.0;
+     0.0, (-(c_f + c_r) / m) / v, (c_f + c_r) / m,
+     (l_r * c_r - l_f * c_f) / m / v;
+     0.0, 0.0, 0.0, 1.0;
+     0.0, ((lr * cr - lf * cf) / i_z) / v, (l_f * c_f - l_r * c_r) / i_z,
+     (-1.0 * (l_f^2 * c_f + l_r^2 * c_r) / i_z) / v;]
+    */
+    cf_ = lat_based_lqr_controller_conf_.cf();
+    cr_ = lat_based_lqr_controller_conf_.cr();
+    matrix_a_(0, 1) = 1.0;
+    matrix_a_coeff_(0, 2) = 0.0;
+  }
+  matrix_a_(1, 2) = (cf_ + cr_) / mass_;
+  matrix_a_(3, 2) = (lf_ * cf_ - lr_ * cr_) / iz_;
+  matrix_a_coeff_(1, 1) = -(cf_ + cr_) / mass_;
+  matrix_a_coeff_(1, 3) = (lr_ * cr_ - lf_ * cf_) / mass_;
+  matrix_a_coeff_(3, 1) = (lr_ * cr_ - lf_ * cf_) / iz_;
+  matrix_a_coeff_(3, 3) = -1.0 * (lf_ * lf_ * cf_ + lr_ * lr_ * cr_) / iz_;
+
+  /*
+  b = [0.0, c_f / m, 0.0, l_f * c_f / i_z]^T
+  */
+  matrix_b_(1, 0) = cf_ / mass_;
+  matrix_b_(3, 0) = lf_ * cf_ / iz_;
+  matrix_bd_ = matrix_b_ * ts_;
+  // Update Matrix_b for reverse mode
+  if (FLAGS_reverse_heading_control && reverse) {
+    matrix_bd_ = -matrix_b_ * ts_;
+    ADEBUG << "Matrix_b changed due to gear direction";
+  }
+}
+
+void LatController::UpdateMatrix(const bool reverse, const double linear_v) {
   double v;
   // At reverse driving, replace the lateral translational motion dynamics with
   // the corresponding kinematic models
-  if (injector_->vehicle_state()->gear() == canbus::Chassis::GEAR_REVERSE &&
-      !lat_based_lqr_controller_conf_.reverse_use_dynamic_model()) {
-    v = std::min(injector_->vehicle_state()->linear_velocity(),
-                 -minimum_speed_protection_);
+  if (reverse && !lat_based_lqr_controller_conf_.reverse_use_dynamic_model()) {
+    v = std::min(linear_v, -minimum_speed_protection_);
     matrix_a_(0, 2) = matrix_a_coeff_(0, 2) * v;
   } else {
-    v = std::max(injector_->vehicle_state()->linear_velocity(),
-                 minimum_speed_protection_);
+    v = std::max(linear_v, minimum_speed_protection_);
     matrix_a_(0, 2) = 0.0;
   }
   matrix_a_(1, 1) = matrix_a_coeff_(1, 1) / v;
@@ -744,6 +771,61 @@ void LatController::UpdateMatrixCompound() {
   }
 }
 
+void LatController::UpdateMatrixQ(const bool reverse, const double speed) {
+  if (reverse) {
+    for (int i = 0; i < lat_based_lqr_controller_conf_.reverse_matrix_q_size();
+         ++i) {
+      matrix_q_(i, i) = lat_based_lqr_controller_conf_.reverse_matrix_q(i);
+    }
+  } else {
+    for (int i = 0; i < lat_based_lqr_controller_conf_.matrix_q_size(); ++i) {
+      matrix_q_(i, i) = lat_based_lqr_controller_conf_.matrix_q(i);
+    }
+  }
+  if (FLAGS_enable_gain_scheduler) {
+    matrix_q_updated_(0, 0) =
+        matrix_q_(0, 0) * lat_err_interpolation_->Interpolate(speed);
+    matrix_q_updated_(2, 2) =
+        matrix_q_(2, 2) * heading_err_interpolation_->Interpolate(speed);
+  }
+}
+
+void LatController::SolveLqr(Matrix *matrix_k, uint *num_iteration,
+                             double *result_diff) const {
+  const Matrix &matrix_q =
+      FLAGS_enable_gain_scheduler ? matrix_q_updated_ : matrix_q_;
+  if (matrix_adc_.rows() != basic_state_size_) {
+    common::math::SolveLQRProblem(matrix_adc_, matrix_bdc_, matrix_q,
+                                  matrix_r_, lqr_eps_, lqr_max_iteration_,
+                                  matrix_k, num_iteration, result_diff);
+    return;
+  }
+  // Without preview, the problem size is known at compile time
+  Eigen::Matrix<double, 1, basic_state_size_> fixed_matrix_k;
+  common::math::SolveLQRProblem<basic_state_size_, 1>(
+      matrix_adc_, matrix_bdc_, matrix_q, matrix_r_, lqr_eps_,
+      lqr_max_iteration_, &fixed_matrix_k, num_iteration, result_diff);
+  *matrix_k = fixed_matrix_k;
+}
+
+bool LatController::InterpolateLqrGain(const bool reverse,
+                                       const double linear_v,
+                                       Matrix *matrix_k) const {
+  if (!enable_lqr_gain_table_) {
+    return false;
+  }
+  // The kinematic model at reverse driving is tabulated on the backward speed
+  const bool backward =
+      reverse && !lat_based_lqr_controller_conf_.reverse_use_dynamic_model();
+  const auto &table =
+      reverse ? reverse_lqr_gain_table_ : drive_lqr_gain_table_;
+  // UpdateMatrix holds the speed at the minimum speed protection, where the
+  // table starts, so the slower speeds take the gain of the first grid point
+  const double speed =
+      std::max(backward ? -linear_v : linear_v, table.min_speed());
+  return table.Interpolate(speed, matrix_k);
+}
+
 double LatController::ComputeFeedForward(double ref_curvature) const {
   const double kv =
       lr_ * mass_ / 2 / cf_ / wheelbase_ - lf_ * mass_ / 2 / cr_ / wheelbase_;
@@ -920,15 +1002,11 @@ void LatController::ComputeLateralErrors(
 void LatController::UpdateDrivingOrientation() {
   auto vehicle_state = injector_->vehicle_state();
   driving_orientation_ = vehicle_state->heading();
-  matrix_bd_ = matrix_b_ * ts_;
   // Reverse the driving direction if the vehicle is in reverse mode
   if (FLAGS_reverse_heading_control) {
     if (vehicle_state->gear() == canbus::Chassis::GEAR_REVERSE) {
       driving_orientation_ =
           common::math::NormalizeAngle(driving_orientation_ + M_PI);
-      // Update Matrix_b for reverse mode
-      matrix_bd_ = -matrix_b_ * ts_;
-      ADEBUG << "Matrix_b changed due to gear direction";
     }
   }
 }
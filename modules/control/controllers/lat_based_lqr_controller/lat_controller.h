@@ -36,6 +36,7 @@
 #include "modules/common/filters/mean_filter.h"
 #include "modules/control/control_component/controller_task_base/common/interpolation_1d.h"
 #include "modules/control/control_component/controller_task_base/common/leadlag_controller.h"
+#include "modules/control/control_component/controller_task_base/common/lqr_gain_table.h"
 #include "modules/control/control_component/controller_task_base/common/mrac_controller.h"
 #include "modules/control/control_component/controller_task_base/common/trajectory_analyzer.h"
 #include "modules/control/control_component/controller_task_base/control_task.h"
@@ -110,10 +111,22 @@ class LatController : public ControlTask {
   // logic for reverse driving mode
   void UpdateDrivingOrientation();
 
-  void UpdateMatrix();
+  // dynamic model at drive or reverse gear
+  void UpdateDynamicModel(const bool reverse);
+
+  void UpdateMatrix(const bool reverse, const double linear_v);
 
   void UpdateMatrixCompound();
 
+  void UpdateMatrixQ(const bool reverse, const double speed);
+
+  void SolveLqr(Eigen::MatrixXd *matrix_k, uint *num_iteration,
+                double *result_diff) const;
+
+  // look up the lqr gain table, return false if the gain must be solved
+  bool InterpolateLqrGain(const bool reverse, const double linear_v,
+                          Eigen::MatrixXd *matrix_k) const;
+
   double ComputeFeedForward(double ref_curvature) const;
 
   void ComputeLateralErrors(const double x, const double y, const double theta,
@@ -125,6 +138,7 @@ class LatController : public ControlTask {
   bool LoadControlConf();
   void InitializeFilters();
   void LoadLatGainScheduler();
+  void LoadLqrGainTable();
   void LogInitParameters();
   void ProcessLogs(const SimpleLateralDebug *debug,
                    const canbus::Chassis *chassis);
@@ -178,7 +192,7 @@ class LatController : public ControlTask {
 
   // number of states without previews, includes
   // lateral error, lateral error rate, heading error, heading error rate
-  const int basic_state_size_ = 4;
+  static constexpr int basic_state_size_ = 4;
   // vehicle state matrix
   Eigen::MatrixXd matrix_a_;
   // vehicle state matrix (discrete-time)
@@ -209,6 +223,11 @@ class LatController : public ControlTask {
   // parameters for lqr solver; threshold for computation
   double lqr_eps_ = 0.0;
 
+  // lqr gains solved on a speed grid at init, for drive and reverse gear
+  bool enable_lqr_gain_table_ = false;
+  LqrGainTable drive_lqr_gain_table_;
+  LqrGainTable reverse_lqr_gain_table_;
+
   common::DigitalFilter digital_filter_;
 
   std::unique_ptr<Interpolation1D> lat_err_interpolation_;
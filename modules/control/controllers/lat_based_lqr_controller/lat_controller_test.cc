@@ -56,6 +56,21 @@ class LatControllerTest : public ::testing::Test, LatController {
                                         chassis);
   }
 
+  bool BuildLqrGainTables(const double min_speed, const double max_speed,
+                          const double resolution,
+                          const LqrGainTable::GainSolver &solver) {
+    enable_lqr_gain_table_ = true;
+    return drive_lqr_gain_table_.Init(min_speed, max_speed, resolution,
+                                      solver) &&
+           reverse_lqr_gain_table_.Init(min_speed, max_speed, resolution,
+                                        solver);
+  }
+
+  bool InterpolateLqrGain(const bool reverse, const double linear_v,
+                          Eigen::MatrixXd *matrix_k) const {
+    return LatController::InterpolateLqrGain(reverse, linear_v, matrix_k);
+  }
+
  protected:
   LocalizationPb LoadLocalizaionPb(const std::string &filename) {
     LocalizationPb localization_pb;
@@ -124,5 +139,29 @@ TEST_F(LatControllerTest, ComputeLateralErrors) {
   EXPECT_NEAR(debug->curvature(), matched_kappa_expected, 0.001);
 }
 
+TEST_F(LatControllerTest, InterpolateLqrGainBelowMinimumSpeed) {
+  const auto solver = [](const double speed, Eigen::MatrixXd *matrix_k) {
+    *matrix_k = Eigen::MatrixXd::Constant(1, 4, speed);
+  };
+  ASSERT_TRUE(BuildLqrGainTables(1.0, 10.0, 0.5, solver));
+
+  Eigen::MatrixXd matrix_k;
+  EXPECT_TRUE(InterpolateLqrGain(false, 2.25, &matrix_k));
+  EXPECT_NEAR(matrix_k(0, 0), 2.25, 1e-9);
+
+  // the speeds below the grid take the gain of the first grid point
+  EXPECT_TRUE(InterpolateLqrGain(false, 0.2, &matrix_k));
+  EXPECT_NEAR(matrix_k(0, 0), 1.0, 1e-9);
+  EXPECT_TRUE(InterpolateLqrGain(false, -0.5, &matrix_k));
+  EXPECT_NEAR(matrix_k(0, 0), 1.0, 1e-9);
+  EXPECT_TRUE(InterpolateLqrGain(true, -0.2, &matrix_k));
+  EXPECT_NEAR(matrix_k(0, 0), 1.0, 1e-9);
+  EXPECT_TRUE(InterpolateLqrGain(true, -3.0, &matrix_k));
+  EXPECT_NEAR(matrix_k(0, 0), 3.0, 1e-9);
+
+  // the speeds above the grid are solved at runtime
+  EXPECT_FALSE(InterpolateLqrGain(false, 12.0, &matrix_k));
+}
+
 }  // namespace control
 }  // namespace apollo
@@ -116,6 +116,8 @@ bool MPCController::LoadControlConf() {
 
   mpc_eps_ = control_conf_.eps();
   mpc_max_iteration_ = control_conf_.max_iteration();
+  enable_mpc_warm_start_ = control_conf_.enable_mpc_warm_start();
+  mpc_time_limit_ = control_conf_.mpc_time_limit();
   throttle_lowerbound_ = std::max(vehicle_param_.throttle_deadzone(),
                                   control_conf_.throttle_minimum_action());
   brake_lowerbound_ = std::max(vehicle_param_.brake_deadzone(),
@@ -470,12 +472,31 @@ Status MPCController::ComputeControlCommand(
 
   std::vector<double> control_cmd(controls_, 0);
 
-  apollo::common::math::MpcOsqp mpc_osqp(
-      matrix_ad_, matrix_bd_, matrix_q_updated_, matrix_r_updated_,
-      matrix_state_, lower_bound, upper_bound, lower_state_bound,
-      upper_state_bound, reference_state, mpc_max_iteration_, horizon_,
-      mpc_eps_);
-  if (!mpc_osqp.Solve(&control_cmd)) {
+  bool mpc_solved = false;
+  if (enable_mpc_warm_start_) {
+    // Only the values of the problem change between control cycles
+    if (mpc_osqp_ == nullptr ||
+        !mpc_osqp_->Update(matrix_ad_, matrix_bd_, matrix_q_updated_,
+                           matrix_r_updated_, matrix_state_, lower_bound,
+                           upper_bound, lower_state_bound, upper_state_bound,
+                           reference_state)) {
+      mpc_osqp_.reset(new apollo::common::math::MpcOsqp(
+          matrix_ad_, matrix_bd_, matrix_q_updated_, matrix_r_updated_,
+          matrix_state_, lower_bound, upper_bound, lower_state_bound,
+          upper_state_bound, reference_state, mpc_max_iteration_, horizon_,
+          mpc_eps_));
+      mpc_osqp_->EnableWarmStart(mpc_time_limit_);
+    }
+    mpc_solved = mpc_osqp_->Solve(&control_cmd);
+  } else {
+    apollo::common::math::MpcOsqp mpc_osqp(
+        matrix_ad_, matrix_bd_, matrix_q_updated_, matrix_r_updated_,
+        matrix_state_, lower_bound, upper_bound, lower_state_bound,
+        upper_state_bound, reference_state, mpc_max_iteration_, horizon_,
+        mpc_eps_);
+    mpc_solved = mpc_osqp.Solve(&control_cmd);
+  }
+  if (!mpc_solved) {
     AERROR << "MPC OSQP solver failed";
   } else {
     ADEBUG << "MPC OSQP problem solved! ";
@@ -704,6 +725,7 @@ Status MPCController::ComputeControlCommand(
 Status MPCController::Reset() {
   previous_heading_error_ = 0.0;
   previous_lateral_error_ = 0.0;
+  mpc_osqp_.reset();
   return Status::OK();
 }
 
@@ -243,6 +243,12 @@ class MPCController : public ControlTask {
   int mpc_max_iteration_ = 0;
   // parameters for mpc solver; threshold for computation
   double mpc_eps_ = 0.0;
+  // parameters for mpc solver; warm start from the previous control cycle
+  bool enable_mpc_warm_start_ = false;
+  // parameters for mpc solver; time limit of a warm started solve
+  double mpc_time_limit_ = 0.0;
+  // mpc solver kept between control cycles when warm started
+  std::unique_ptr<common::math::MpcOsqp> mpc_osqp_;
 
   common::DigitalFilter digital_filter_;
 
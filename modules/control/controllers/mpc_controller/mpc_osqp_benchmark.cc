@@ -0,0 +1,232 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// MPC solves of the controller at 100Hz along the planning trajectory of the
+// test data, set up every cycle or warm started from the previous cycle. The
+// error dynamics start 0.5m off the trajectory and run in closed loop. The
+// solve time distribution over the trajectory is reported in the counters.
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "modules/common_msgs/planning_msgs/planning.pb.h"
+#include "modules/control/controllers/mpc_controller/proto/mpc_controller.pb.h"
+
+#include "cyber/common/file.h"
+#include "modules/common/math/mpc_osqp.h"
+
+namespace apollo {
+namespace control {
+namespace {
+
+using Matrix = Eigen::MatrixXd;
+using apollo::common::math::MpcOsqp;
+
+constexpr int kStates = 6;
+constexpr int kControls = 2;
+constexpr int kHorizon = 10;
+// the default vehicle
+constexpr double kWheelBase = 2.8448;
+constexpr double kMaxWheelAngle = 8.20304748437 / 16.0;
+constexpr double kMaxAcceleration = 2.0;
+constexpr double kMaxDeceleration = -6.0;
+
+class MpcProblems {
+ public:
+  static const MpcProblems& Instance() {
+    static const MpcProblems* instance = new MpcProblems();
+    return *instance;
+  }
+
+  // Solves along the trajectory, and returns the solve time of each cycle.
+  std::vector<double> Run(const bool warm_start, const int max_iteration,
+                          int* iterations) const {
+    std::vector<double> solve_times;
+    std::unique_ptr<MpcOsqp> warm_start_solver;
+    std::vector<double> control_cmd(kControls, 0.0);
+    Matrix state = Matrix::Zero(kStates, 1);
+    state(0, 0) = 0.5;
+    *iterations = 0;
+    for (const auto& point : trajectory_.trajectory_point()) {
+      const double v = std::max(point.v(), 0.1);
+      Matrix matrix_a = matrix_a_;
+      matrix_a(1, 1) = matrix_a_coeff_(1, 1) / v;
+      matrix_a(1, 3) = matrix_a_coeff_(1, 3) / v;
+      matrix_a(3, 1) = matrix_a_coeff_(3, 1) / v;
+      matrix_a(3, 3) = matrix_a_coeff_(3, 3) / v;
+      const Matrix matrix_i = Matrix::Identity(kStates, kStates);
+      const Matrix matrix_ad = (matrix_i - ts_ * 0.5 * matrix_a).inverse() *
+                               (matrix_i + ts_ * 0.5 * matrix_a);
+
+      const auto start = std::chrono::steady_clock::now();
+      bool solved = false;
+      if (warm_start) {
+        if (warm_start_solver == nullptr) {
+          warm_start_solver.reset(new MpcOsqp(
+              matrix_ad, matrix_bd_, matrix_q_, matrix_r_, state, lower_bound_,
+              upper_bound_, lower_state_bound_, upper_state_bound_,
+              reference_state_, max_iteration, kHorizon, eps_));
+          warm_start_solver->EnableWarmStart(0.0);
+        } else {
+          warm_start_solver->Update(matrix_ad, matrix_bd_, matrix_q_,
+                                    matrix_r_, state, lower_bound_,
+                                    upper_bound_, lower_state_bound_,
+                                    upper_state_bound_, reference_state_);
+        }
+        solved = warm_start_solver->Solve(&control_cmd);
+        *iterations += warm_start_solver->iterations();
+      } else {
+        MpcOsqp mpc_osqp(matrix_ad, matrix_bd_, matrix_q_, matrix_r_, state,
+                         lower_bound_, upper_bound_, lower_state_bound_,
+                         upper_state_bound_, reference_state_, max_iteration,
+                         kHorizon, eps_);
+        solved = mpc_osqp.Solve(&control_cmd);
+        *iterations += mpc_osqp.iterations();
+      }
+      solve_times.push_back(std::chrono::duration<double, std::micro>(
+                                std::chrono::steady_clock::now() - start)
+                                .count());
+      if (!solved) {
+        std::fill(control_cmd.begin(), control_cmd.end(), 0.0);
+      }
+
+      // closed loop error dynamics along the trajectory
+      Matrix control(kControls, 1);
+      control << control_cmd[0], control_cmd[1];
+      Matrix matrix_c = Matrix::Zero(kStates, 1);
+      matrix_c(1, 0) = (lr_ * cr_ - lf_ * cf_) / mass_ / v - v;
+      matrix_c(3, 0) = -(lf_ * lf_ * cf_ + lr_ * lr_ * cr_) / iz_ / v;
+      state = matrix_ad * state + matrix_bd_ * control +
+              matrix_c * v * point.path_point().kappa() * ts_;
+    }
+    return solve_times;
+  }
+
+ private:
+  MpcProblems() {
+    const std::string dir = "modules/control/controllers/mpc_controller/";
+    MPCControllerConf conf;
+    CHECK(cyber::common::GetProtoFromFile(dir + "conf/controller_conf.pb.txt",
+                                          &conf));
+    CHECK(cyber::common::GetProtoFromFile(
+        dir + "mpc_controller_test_data/1_planning.pb.txt", &trajectory_));
+
+    ts_ = conf.ts();
+    eps_ = conf.eps();
+    cf_ = conf.cf();
+    cr_ = conf.cr();
+    const double mass_front = conf.mass_fl() + conf.mass_fr();
+    const double mass_rear = conf.mass_rl() + conf.mass_rr();
+    mass_ = mass_front + mass_rear;
+    lf_ = kWheelBase * (1.0 - mass_front / mass_);
+    lr_ = kWheelBase * (1.0 - mass_rear / mass_);
+    iz_ = lf_ * lf_ * mass_front + lr_ * lr_ * mass_rear;
+
+    matrix_a_ = Matrix::Zero(kStates, kStates);
+    matrix_a_(0, 1) = 1.0;
+    matrix_a_(1, 2) = (cf_ + cr_) / mass_;
+    matrix_a_(2, 3) = 1.0;
+    matrix_a_(3, 2) = (lf_ * cf_ - lr_ * cr_) / iz_;
+    matrix_a_(4, 5) = 1.0;
+    matrix_a_coeff_ = Matrix::Zero(kStates, kStates);
+    matrix_a_coeff_(1, 1) = -(cf_ + cr_) / mass_;
+    matrix_a_coeff_(1, 3) = (lr_ * cr_ - lf_ * cf_) / mass_;
+    matrix_a_coeff_(3, 1) = (lr_ * cr_ - lf_ * cf_) / iz_;
+    matrix_a_coeff_(3, 3) = -1.0 * (lf_ * lf_ * cf_ + lr_ * lr_ * cr_) / iz_;
+
+    Matrix matrix_b = Matrix::Zero(kStates, kControls);
+    matrix_b(1, 0) = cf_ / mass_;
+    matrix_b(3, 0) = lf_ * cf_ / iz_;
+    matrix_b(5, 1) = -1.0;
+    matrix_bd_ = matrix_b * ts_;
+
+    matrix_q_ = Matrix::Zero(kStates, kStates);
+    for (int i = 0; i < conf.matrix_q_size(); ++i) {
+      matrix_q_(i, i) = conf.matrix_q(i);
+    }
+    matrix_r_ = Matrix::Identity(kControls, kControls);
+    for (int i = 0; i < conf.matrix_r_size(); ++i) {
+      matrix_r_(i, i) = conf.matrix_r(i);
+    }
+
+    lower_bound_ = Matrix(kControls, 1);
+    lower_bound_ << -kMaxWheelAngle, kMaxDeceleration;
+    upper_bound_ = Matrix(kControls, 1);
+    upper_bound_ << kMaxWheelAngle, kMaxAcceleration;
+    const double max = std::numeric_limits<double>::max();
+    lower_state_bound_ = Matrix(kStates, 1);
+    lower_state_bound_ << -max, -max, -M_PI, -max, -max, -max;
+    upper_state_bound_ = Matrix(kStates, 1);
+    upper_state_bound_ << max, max, M_PI, max, max, max;
+    reference_state_ = Matrix::Zero(kStates, 1);
+  }
+
+  planning::ADCTrajectory trajectory_;
+  double ts_ = 0.0;
+  double eps_ = 0.0;
+  double cf_ = 0.0;
+  double cr_ = 0.0;
+  double mass_ = 0.0;
+  double lf_ = 0.0;
+  double lr_ = 0.0;
+  double iz_ = 0.0;
+  Matrix matrix_a_;
+  Matrix matrix_a_coeff_;
+  Matrix matrix_bd_;
+  Matrix matrix_q_;
+  Matrix matrix_r_;
+  Matrix lower_bound_;
+  Matrix upper_bound_;
+  Matrix lower_state_bound_;
+  Matrix upper_state_bound_;
+  Matrix reference_state_;
+};
+
+// args: warm start, max iteration
+void BM_MpcSolve(benchmark::State& state) {  // NOLINT
+  const auto& problems = MpcProblems::Instance();
+  std::vector<double> solve_times;
+  int iterations = 0;
+  for (auto _ : state) {
+    solve_times = problems.Run(state.range(0) != 0,
+                               static_cast<int>(state.range(1)), &iterations);
+  }
+  std::sort(solve_times.begin(), solve_times.end());
+  const size_t n = solve_times.size();
+  state.counters["p50_us"] = solve_times[n / 2];
+  state.counters["p90_us"] = solve_times[n * 9 / 10];
+  state.counters["p99_us"] = solve_times[n * 99 / 100];
+  state.counters["max_us"] = solve_times.back();
+  state.counters["iterations"] =
+      static_cast<double>(iterations) / static_cast<double>(n);
+}
+
+BENCHMARK(BM_MpcSolve)
+    ->Args({0, 3000})
+    ->Args({1, 3000})
+    ->Args({1, 50})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace control
+}  // namespace apollo
+
+BENCHMARK_MAIN();
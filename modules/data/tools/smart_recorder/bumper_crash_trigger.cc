@@ -62,5 +62,9 @@ void BumperCrashTrigger::Pull(const cyber::record::RecordMessage& msg) {
   }
 }
 
+bool BumperCrashTrigger::ShouldPull(const std::string& channel_name) const {
+  return trigger_obj_->enabled() && channel_name == FLAGS_chassis_topic;
+}
+
 }  // namespace data
 }  // namespace apollo
@@ -35,6 +35,7 @@ class BumperCrashTrigger : public TriggerBase {
   bool ShouldRestore(const cyber::record::RecordMessage& msg) const override {
     return false;
   };
+  bool ShouldPull(const std::string& channel_name) const override;
 
   virtual ~BumperCrashTrigger() = default;
 
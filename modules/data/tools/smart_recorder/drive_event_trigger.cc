@@ -43,5 +43,9 @@ void DriveEventTrigger::Pull(const cyber::record::RecordMessage& msg) {
   }
 }
 
+bool DriveEventTrigger::ShouldPull(const std::string& channel_name) const {
+  return trigger_obj_->enabled() && channel_name == FLAGS_drive_event_topic;
+}
+
 }  // namespace data
 }  // namespace apollo
@@ -34,6 +34,7 @@ class DriveEventTrigger : public TriggerBase {
   bool ShouldRestore(const cyber::record::RecordMessage& msg) const override {
     return false;
   };
+  bool ShouldPull(const std::string& channel_name) const override;
 
   virtual ~DriveEventTrigger() = default;
 };
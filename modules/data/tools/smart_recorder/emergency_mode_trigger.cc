@@ -46,5 +46,9 @@ void EmergencyModeTrigger::Pull(const cyber::record::RecordMessage& msg) {
   }
 }
 
+bool EmergencyModeTrigger::ShouldPull(const std::string& channel_name) const {
+  return trigger_obj_->enabled() && channel_name == FLAGS_chassis_topic;
+}
+
 }  // namespace data
 }  // namespace apollo
@@ -54,6 +54,10 @@ void HardBrakeTrigger::Pull(const cyber::record::RecordMessage& msg) {
   }
 }
 
+bool HardBrakeTrigger::ShouldPull(const std::string& channel_name) const {
+  return trigger_obj_->enabled() && channel_name == FLAGS_chassis_topic;
+}
+
 bool HardBrakeTrigger::IsNoisy(const float speed) const {
   const float pre_speed_mps =
       (current_speed_queue_.empty() ? 0.0f : current_speed_queue_.back());
@@ -37,6 +37,7 @@ class HardBrakeTrigger : public TriggerBase {
   bool ShouldRestore(const cyber::record::RecordMessage& msg) const override {
     return false;
   };
+  bool ShouldPull(const std::string& channel_name) const override;
 
   virtual ~HardBrakeTrigger() = default;
 
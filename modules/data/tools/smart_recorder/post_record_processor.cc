@@ -19,6 +19,9 @@
 #include <dirent.h>
 
 #include <algorithm>
+#include <deque>
+#include <functional>
+#include <future>
 #include <limits>
 #include <memory>
 
@@ -30,11 +33,13 @@
 
 #include "modules/data/tools/smart_recorder/channel_pool.h"
 #include "modules/data/tools/smart_recorder/interval_pool.h"
+#include "modules/data/tools/smart_recorder/smart_recorder_gflags.h"
 
 namespace apollo {
 namespace data {
 
 using cyber::common::DirectoryExists;
+using cyber::record::RecordMessage;
 using cyber::record::RecordReader;
 using cyber::record::RecordViewer;
 using cyber::record::RecordWriter;
@@ -59,19 +64,7 @@ bool PostRecordProcessor::Init(const SmartRecordTrigger& trigger_conf) {
 
 bool PostRecordProcessor::Process() {
   // First scan, get intervals
-  for (const std::string& record : source_record_files_) {
-    const auto reader = std::make_shared<RecordReader>(
-        absl::StrCat(source_record_dir_, "/", record));
-    RecordViewer viewer(reader, 0,
-                        std::numeric_limits<uint64_t>::max(),
-                        ChannelPool::Instance()->GetAllChannels());
-    AINFO << record << ":" << viewer.begin_time() << " - " << viewer.end_time();
-    for (const auto& msg : viewer) {
-      for (const auto& trigger : triggers_) {
-        trigger->Pull(msg);
-      }
-    }
-  }
+  PullRecords();
   // Second scan, restore messages based on intervals in the first scan
   IntervalPool::Instance()->ReorgIntervals();
   IntervalPool::Instance()->PrintIntervals();
@@ -86,9 +79,11 @@ bool PostRecordProcessor::Process() {
       // or required by any triggers, restore it
       if (IntervalPool::Instance()->MessageFallIntoRange(msg.time) ||
           ShouldRestore(msg)) {
-        writer_->WriteChannel(msg.channel_name,
-                              reader->GetMessageType(msg.channel_name),
-                              reader->GetProtoDesc(msg.channel_name));
+        if (writer_->IsNewChannel(msg.channel_name)) {
+          writer_->WriteChannel(msg.channel_name,
+                                reader->GetMessageType(msg.channel_name),
+                                reader->GetProtoDesc(msg.channel_name));
+        }
         writer_->WriteMessage(msg.channel_name, msg.content, msg.time);
       }
     }
@@ -96,6 +91,84 @@ bool PostRecordProcessor::Process() {
   return true;
 }
 
+void PostRecordProcessor::PullRecords() {
+  pull_channels_.clear();
+  content_channels_.clear();
+  for (const std::string& channel : ChannelPool::Instance()->GetAllChannels()) {
+    for (const auto& trigger : triggers_) {
+      if (trigger->ShouldPull(channel)) {
+        pull_channels_.insert(channel);
+        if (trigger->PullsContent()) {
+          content_channels_.insert(channel);
+        }
+      }
+    }
+  }
+  if (pull_channels_.empty()) {
+    AINFO << "no channels to pull by the triggers";
+    return;
+  }
+  if (FLAGS_post_record_scan_threads <= 1) {
+    // Stream the messages to the triggers, without buffering the records
+    for (const std::string& record : source_record_files_) {
+      ScanRecord(record,
+                 [this](const RecordMessage& msg) { PullMessage(msg); });
+    }
+    return;
+  }
+  // Records are scanned ahead in parallel, while the triggers pull the
+  // scanned records one by one in order, as they keep states across records
+  const size_t max_scans = static_cast<size_t>(FLAGS_post_record_scan_threads);
+  std::deque<std::future<std::vector<RecordMessage>>> scans;
+  size_t next_record = 0;
+  for (size_t i = 0; i < source_record_files_.size(); ++i) {
+    while (next_record < source_record_files_.size() &&
+           scans.size() < max_scans) {
+      const std::string& record = source_record_files_[next_record++];
+      scans.push_back(std::async(std::launch::async, [this, &record]() {
+        std::vector<RecordMessage> messages;
+        ScanRecord(record, [this, &messages](const RecordMessage& msg) {
+          messages.emplace_back();
+          RecordMessage& scanned = messages.back();
+          scanned.channel_name = msg.channel_name;
+          scanned.time = msg.time;
+          if (content_channels_.count(msg.channel_name) > 0) {
+            scanned.content = msg.content;
+          }
+        });
+        return messages;
+      }));
+    }
+    const std::vector<RecordMessage> messages = scans.front().get();
+    scans.pop_front();
+    for (const auto& msg : messages) {
+      PullMessage(msg);
+    }
+  }
+}
+
+void PostRecordProcessor::PullMessage(const RecordMessage& msg) {
+  for (const auto& trigger : triggers_) {
+    if (trigger->ShouldPull(msg.channel_name)) {
+      trigger->Pull(msg);
+    }
+  }
+}
+
+void PostRecordProcessor::ScanRecord(
+    const std::string& record,
+    const std::function<void(const RecordMessage&)>& visit) const {
+  const auto reader = std::make_shared<RecordReader>(
+      absl::StrCat(source_record_dir_, "/", record));
+  // The viewer reads the pulled channels in the index of the record only
+  RecordViewer viewer(reader, 0, std::numeric_limits<uint64_t>::max(),
+                      pull_channels_);
+  AINFO << record << ":" << viewer.begin_time() << " - " << viewer.end_time();
+  for (const auto& msg : viewer) {
+    visit(msg);
+  }
+}
+
 std::string PostRecordProcessor::GetDefaultOutputFile() const {
   std::string src_file_name = source_record_files_.front();
   const std::string record_flag(".record");
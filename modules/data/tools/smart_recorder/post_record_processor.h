@@ -16,9 +16,13 @@
 
 #pragma once
 
+#include <functional>
+#include <set>
 #include <string>
 #include <vector>
 
+#include "cyber/record/record_message.h"
+
 #include "modules/data/tools/smart_recorder/proto/smart_recorder_triggers.pb.h"
 #include "modules/data/tools/smart_recorder/record_processor.h"
 
@@ -41,8 +45,17 @@ class PostRecordProcessor : public RecordProcessor {
 
  private:
   void LoadSourceRecords();
+  void PullRecords();
+  void PullMessage(const cyber::record::RecordMessage& msg);
+  void ScanRecord(
+      const std::string& record,
+      const std::function<void(const cyber::record::RecordMessage&)>& visit)
+      const;
 
   std::vector<std::string> source_record_files_;
+  // Channels pulled by any trigger, and the ones whose content is read
+  std::set<std::string> pull_channels_;
+  std::set<std::string> content_channels_;
 };
 
 }  // namespace data
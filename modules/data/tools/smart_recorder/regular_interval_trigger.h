@@ -34,6 +34,7 @@ class RegularIntervalTrigger : public TriggerBase {
   bool ShouldRestore(const cyber::record::RecordMessage& msg) const override {
     return false;
   };
+  bool PullsContent() const override { return false; }
 
   virtual ~RegularIntervalTrigger() = default;
 
@@ -33,6 +33,9 @@ class SmallTopicsTrigger : public TriggerBase {
   SmallTopicsTrigger();
 
   void Pull(const cyber::record::RecordMessage& msg) override{};
+  bool ShouldPull(const std::string& channel_name) const override {
+    return false;
+  }
   bool ShouldRestore(const cyber::record::RecordMessage& msg) const override;
 
   virtual ~SmallTopicsTrigger() = default;
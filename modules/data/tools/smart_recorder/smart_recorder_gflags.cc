@@ -23,3 +23,7 @@ DEFINE_string(smart_recorder_config_filename,
               "smart_recorder_config.pb.txt",
               "The config file.");
 DEFINE_bool(real_time_trigger, true, "Whether to use realtime trigger.");
+DEFINE_int32(post_record_scan_threads, 1,
+             "The number of records scanned for the triggers in parallel "
+             "when post processing. With 1, the records are streamed to the "
+             "triggers without buffering.");
@@ -56,6 +56,10 @@ void SwerveTrigger::Pull(const cyber::record::RecordMessage& msg) {
   }
 }
 
+bool SwerveTrigger::ShouldPull(const std::string& channel_name) const {
+  return trigger_obj_->enabled() && channel_name == FLAGS_chassis_topic;
+}
+
 bool SwerveTrigger::IsNoisy(const float steer) const {
   if (steer > MAX_STEER_PER || steer < MIN_STEER_PER) {
     return true;
@@ -37,6 +37,7 @@ class SwerveTrigger : public TriggerBase {
   bool ShouldRestore(const cyber::record::RecordMessage& msg) const override {
     return false;
   };
+  bool ShouldPull(const std::string& channel_name) const override;
 
   virtual ~SwerveTrigger() = default;
 
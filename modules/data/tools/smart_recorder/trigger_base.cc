@@ -31,6 +31,10 @@ bool TriggerBase::Init(const SmartRecordTrigger& trigger_conf) {
   return true;
 }
 
+bool TriggerBase::ShouldPull(const std::string& channel_name) const {
+  return trigger_obj_->enabled();
+}
+
 uint64_t TriggerBase::SecondsToNanoSeconds(const double seconds) const {
   static constexpr uint64_t kSecondsToNanoSecondsFactor = 1000000000UL;
   return static_cast<uint64_t>(kSecondsToNanoSecondsFactor * seconds);
@@ -44,6 +44,12 @@ class TriggerBase {
   // Decide if the current message needs to be restored
   virtual bool ShouldRestore(const cyber::record::RecordMessage& msg) const = 0;
 
+  // Decide if the messages of the channel need to be pulled, all by default
+  virtual bool ShouldPull(const std::string& channel_name) const;
+
+  // Decide if Pull reads the content of messages, or only channels and times
+  virtual bool PullsContent() const { return true; }
+
   const std::string& GetTriggerName() const { return trigger_name_; }
 
   uint64_t SecondsToNanoSeconds(const double seconds) const;
@@ -78,6 +78,20 @@ DEFINE_double(voxel_filter_size, 0.3, "VoxelGrid pointcloud filter leaf size");
 DEFINE_double(voxel_filter_height, 0.2,
               "VoxelGrid pointcloud filter leaf height");
 
+DEFINE_bool(enable_voxel_filter, false,
+            "True to downsample pointcloud with the hashed voxel grid off "
+            "the reader thread");
+
+DEFINE_double(voxel_filter_range_step, 20.0,
+              "The voxel filter leaf grows by the near leaf size every such "
+              "meters away from the lidar, no growth if not positive");
+
+DEFINE_bool(enable_point_cloud_quantization, false,
+            "True to stream pointcloud as quantized delta coded points");
+
+DEFINE_double(point_cloud_quantization_resolution, 0.01,
+              "Quantization step of the streamed pointcloud in meters");
+
 DEFINE_double(system_status_lifetime_seconds, 30,
               "Lifetime of a valid SystemStatus message. It's more like a "
               "replay message if the timestamp is old, where we should ignore "
@@ -52,6 +52,14 @@ DECLARE_double(voxel_filter_size);
 
 DECLARE_double(voxel_filter_height);
 
+DECLARE_bool(enable_voxel_filter);
+
+DECLARE_double(voxel_filter_range_step);
+
+DECLARE_bool(enable_point_cloud_quantization);
+
+DECLARE_double(point_cloud_quantization_resolution);
+
 DECLARE_double(system_status_lifetime_seconds);
 
 DECLARE_string(lidar_height_yaml);
@@ -0,0 +1,215 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/dreamview_plus/backend/point_cloud/point_cloud_downsampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace apollo {
+namespace dreamview {
+namespace {
+
+// 20 bits of voxel coordinate per axis, and the range level above them.
+constexpr int kCoordBits = 20;
+constexpr int64_t kCoordOffset = int64_t{1} << (kCoordBits - 1);
+constexpr int kMaxLevel = 3;
+constexpr uint64_t kEmptyKey = std::numeric_limits<uint64_t>::max();
+
+void AppendVarint(uint32_t value, std::string *data) {
+  while (value >= 0x80) {
+    data->push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  data->push_back(static_cast<char>(value));
+}
+
+bool ReadVarint(const std::string &data, size_t *pos, uint32_t *value) {
+  *value = 0;
+  for (int shift = 0; shift < 32 && *pos < data.size(); shift += 7) {
+    const uint8_t byte = static_cast<uint8_t>(data[(*pos)++]);
+    *value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t ZigZag(const int32_t value) {
+  return (static_cast<uint32_t>(value) << 1) ^
+         static_cast<uint32_t>(value >> 31);
+}
+
+int32_t UnZigZag(const uint32_t value) {
+  return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+}
+
+}  // namespace
+
+PointCloudDownsampler::PointCloudDownsampler(const float leaf_size,
+                                             const float leaf_height,
+                                             const float range_step)
+    : leaf_size_(leaf_size),
+      leaf_height_(leaf_height),
+      range_step_(range_step) {}
+
+bool PointCloudDownsampler::VoxelKey(const float x, const float y,
+                                     const float z, uint64_t *key) const {
+  int level = 0;
+  if (range_step_ > 0.0f) {
+    const float range = std::sqrt(x * x + y * y);
+    level = std::min(kMaxLevel, static_cast<int>(range / range_step_));
+  }
+  const float scale = static_cast<float>(level + 1);
+  const int64_t coords[3] = {
+      static_cast<int64_t>(std::floor(x / (leaf_size_ * scale))),
+      static_cast<int64_t>(std::floor(y / (leaf_size_ * scale))),
+      static_cast<int64_t>(std::floor(z / (leaf_height_ * scale)))};
+  uint64_t packed = static_cast<uint64_t>(level);
+  for (const int64_t coord : coords) {
+    if (coord < -kCoordOffset || coord >= kCoordOffset) {
+      return false;
+    }
+    packed = (packed << kCoordBits) |
+             static_cast<uint64_t>(coord + kCoordOffset);
+  }
+  *key = packed;
+  return true;
+}
+
+uint32_t PointCloudDownsampler::FindOrInsert(const uint64_t key) {
+  const size_t mask = keys_.size() - 1;
+  size_t slot = static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >>
+                                    hash_shift_);
+  while (keys_[slot] != kEmptyKey) {
+    if (keys_[slot] == key) {
+      return indices_[slot];
+    }
+    slot = (slot + 1) & mask;
+  }
+  keys_[slot] = key;
+  indices_[slot] = static_cast<uint32_t>(voxels_.size());
+  voxels_.emplace_back();
+  return indices_[slot];
+}
+
+void PointCloudDownsampler::Downsample(
+    const drivers::PointCloud &point_cloud,
+    pcl::PointCloud<pcl::PointXYZ> *output) {
+  output->clear();
+  voxels_.clear();
+  if (leaf_size_ <= 0.0f || leaf_height_ <= 0.0f) {
+    return;
+  }
+
+  // at most half full, so the probe sequences stay short
+  size_t capacity = 64;
+  while (capacity < 2 * static_cast<size_t>(point_cloud.point_size())) {
+    capacity <<= 1;
+  }
+  if (keys_.size() < capacity) {
+    keys_.resize(capacity);
+    indices_.resize(capacity);
+  }
+  capacity = keys_.size();
+  hash_shift_ = 64;
+  for (size_t size = capacity; size > 1; size >>= 1) {
+    --hash_shift_;
+  }
+  std::fill(keys_.begin(), keys_.end(), kEmptyKey);
+
+  for (const auto &point : point_cloud.point()) {
+    if (std::isnan(point.x()) || std::isnan(point.y()) ||
+        std::isnan(point.z())) {
+      continue;
+    }
+    uint64_t key = 0;
+    if (!VoxelKey(point.x(), point.y(), point.z(), &key)) {
+      continue;
+    }
+    Voxel &voxel = voxels_[FindOrInsert(key)];
+    voxel.x += point.x();
+    voxel.y += point.y();
+    voxel.z += point.z();
+    ++voxel.count;
+  }
+
+  output->points.resize(voxels_.size());
+  for (size_t i = 0; i < voxels_.size(); ++i) {
+    const Voxel &voxel = voxels_[i];
+    const double count = static_cast<double>(voxel.count);
+    output->points[i].x = static_cast<float>(voxel.x / count);
+    output->points[i].y = static_cast<float>(voxel.y / count);
+    output->points[i].z = static_cast<float>(voxel.z / count);
+  }
+  output->width = static_cast<uint32_t>(output->points.size());
+  output->height = 1;
+  output->is_dense = true;
+}
+
+size_t EncodeQuantizedPoints(const pcl::PointCloud<pcl::PointXYZ> &points,
+                             const float resolution, std::string *data) {
+  data->clear();
+  if (resolution <= 0.0f) {
+    return 0;
+  }
+  // one byte per coordinate in the common case of close points
+  data->reserve(points.size() * 3);
+  const float max = std::numeric_limits<int16_t>::max();
+  const float min = std::numeric_limits<int16_t>::min();
+  int32_t last[3] = {0, 0, 0};
+  size_t num_points = 0;
+  for (const auto &point : points.points) {
+    const float values[3] = {std::round(point.x / resolution),
+                             std::round(point.y / resolution),
+                             std::round(point.z / resolution)};
+    // also drops NaN
+    if (!(values[0] >= min && values[0] <= max && values[1] >= min &&
+          values[1] <= max && values[2] >= min && values[2] <= max)) {
+      continue;
+    }
+    for (int i = 0; i < 3; ++i) {
+      const int32_t value = static_cast<int32_t>(values[i]);
+      AppendVarint(ZigZag(value - last[i]), data);
+      last[i] = value;
+    }
+    ++num_points;
+  }
+  return num_points;
+}
+
+bool DecodeQuantizedPoints(const std::string &data, const float resolution,
+                           std::vector<float> *num) {
+  num->clear();
+  int32_t last[3] = {0, 0, 0};
+  size_t pos = 0;
+  while (pos < data.size()) {
+    for (int i = 0; i < 3; ++i) {
+      uint32_t delta = 0;
+      if (!ReadVarint(data, &pos, &delta)) {
+        return false;
+      }
+      last[i] += UnZigZag(delta);
+      num->push_back(static_cast<float>(last[i]) * resolution);
+    }
+  }
+  return true;
+}
+
+}  // namespace dreamview
+}  // namespace apollo
@@ -0,0 +1,116 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "pcl/point_cloud.h"
+#include "pcl/point_types.h"
+
+#include "modules/common_msgs/sensor_msgs/pointcloud.pb.h"
+
+/**
+ * @namespace apollo::dreamview
+ * @brief apollo::dreamview
+ */
+namespace apollo {
+namespace dreamview {
+
+/**
+ * @class PointCloudDownsampler
+ * @brief Hashed voxel grid downsampling of the point cloud in the sensor
+ * frame. Each occupied voxel is replaced by the centroid of its points, like
+ * pcl::VoxelGrid, but in a single pass over the points with an open
+ * addressing hash table instead of sorting them. The leaf size grows with the
+ * distance to the sensor, where the points are sparse anyway.
+ */
+class PointCloudDownsampler {
+ public:
+  /**
+   * @param leaf_size the voxel size in x and y near the sensor
+   * @param leaf_height the voxel size in z near the sensor
+   * @param range_step the leaf grows by the near leaf every range_step
+   * meters away from the sensor, up to 4 times; no growth if not positive
+   */
+  PointCloudDownsampler(const float leaf_size, const float leaf_height,
+                        const float range_step);
+
+  /**
+   * @brief downsample the point cloud
+   * @param point_cloud the point cloud in the sensor frame
+   * @param output the centroids of the occupied voxels, in the order the
+   * voxels are first hit; NaN points and points out of the grid are dropped
+   */
+  void Downsample(const drivers::PointCloud &point_cloud,
+                  pcl::PointCloud<pcl::PointXYZ> *output);
+
+ private:
+  struct Voxel {
+    double x = 0.0;
+    double y = 0.0;
+    double z = 0.0;
+    uint32_t count = 0;
+  };
+
+  bool VoxelKey(const float x, const float y, const float z,
+                uint64_t *key) const;
+
+  uint32_t FindOrInsert(const uint64_t key);
+
+  const float leaf_size_;
+  const float leaf_height_;
+  const float range_step_;
+
+  // open addressing table from the voxel key to the index of the voxel,
+  // kept between frames to avoid reallocation
+  std::vector<uint64_t> keys_;
+  std::vector<uint32_t> indices_;
+  int hash_shift_ = 64;
+  std::vector<Voxel> voxels_;
+};
+
+/**
+ * @brief encode the points into the quantized binary frame. Each coordinate
+ * is rounded to an int16 multiple of the resolution, and written as the
+ * zigzag varint of its delta to the same coordinate of the previous point.
+ * Points out of the int16 range are dropped.
+ * @param points the points to encode
+ * @param resolution the quantization step in meters
+ * @param data the encoded frame
+ * @return the number of points encoded
+ */
+size_t EncodeQuantizedPoints(const pcl::PointCloud<pcl::PointXYZ> &points,
+                             const float resolution, std::string *data);
+
+/**
+ * @brief decode the quantized binary frame
+ * @param data the encoded frame
+ * @param resolution the quantization step in meters
+ * @param num the x, y, z of the decoded points
+ * @return false if the frame is truncated
+ */
+bool DecodeQuantizedPoints(const std::string &data, const float resolution,
+                           std::vector<float> *num);
+
+}  // namespace dreamview
+}  // namespace apollo
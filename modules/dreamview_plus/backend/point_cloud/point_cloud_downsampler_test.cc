@@ -0,0 +1,145 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/dreamview_plus/backend/point_cloud/point_cloud_downsampler.h"
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <tuple>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace dreamview {
+
+namespace {
+
+drivers::PointCloud RandomPointCloud(const int num_points, const float range) {
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<float> xy(-range, range);
+  std::uniform_real_distribution<float> z(-2.0f, 3.0f);
+  drivers::PointCloud point_cloud;
+  for (int i = 0; i < num_points; ++i) {
+    auto *point = point_cloud.add_point();
+    point->set_x(xy(gen));
+    point->set_y(xy(gen));
+    point->set_z(z(gen));
+  }
+  return point_cloud;
+}
+
+}  // namespace
+
+TEST(PointCloudDownsamplerTest, VoxelCentroids) {
+  drivers::PointCloud point_cloud = RandomPointCloud(20000, 30.0f);
+  auto *nan_point = point_cloud.add_point();
+  nan_point->set_x(NAN);
+  nan_point->set_y(1.0f);
+  nan_point->set_z(1.0f);
+
+  // the same centroids as sorting the points into the voxels
+  const float leaf_size = 0.5f;
+  const float leaf_height = 0.25f;
+  std::map<std::tuple<int, int, int>, std::vector<double>> expected;
+  for (const auto &point : point_cloud.point()) {
+    if (std::isnan(point.x())) {
+      continue;
+    }
+    auto &voxel = expected[std::make_tuple(
+        static_cast<int>(std::floor(point.x() / leaf_size)),
+        static_cast<int>(std::floor(point.y() / leaf_size)),
+        static_cast<int>(std::floor(point.z() / leaf_height)))];
+    voxel.resize(4, 0.0);
+    voxel[0] += point.x();
+    voxel[1] += point.y();
+    voxel[2] += point.z();
+    voxel[3] += 1.0;
+  }
+
+  PointCloudDownsampler downsampler(leaf_size, leaf_height, 0.0f);
+  pcl::PointCloud<pcl::PointXYZ> output;
+  // the hash table is reused by the second frame
+  for (int frame = 0; frame < 2; ++frame) {
+    downsampler.Downsample(point_cloud, &output);
+    ASSERT_EQ(expected.size(), output.size());
+    for (const auto &point : output.points) {
+      const auto it = expected.find(
+          std::make_tuple(static_cast<int>(std::floor(point.x / leaf_size)),
+                          static_cast<int>(std::floor(point.y / leaf_size)),
+                          static_cast<int>(std::floor(point.z / leaf_height))));
+      ASSERT_TRUE(it != expected.end());
+      EXPECT_NEAR(it->second[0] / it->second[3], point.x, 1.0e-4);
+      EXPECT_NEAR(it->second[1] / it->second[3], point.y, 1.0e-4);
+      EXPECT_NEAR(it->second[2] / it->second[3], point.z, 1.0e-4);
+    }
+  }
+
+  downsampler.Downsample(drivers::PointCloud(), &output);
+  EXPECT_TRUE(output.empty());
+}
+
+TEST(PointCloudDownsamplerTest, RangeAdaptiveLeaf) {
+  const drivers::PointCloud point_cloud = RandomPointCloud(50000, 60.0f);
+  PointCloudDownsampler uniform(0.3f, 0.2f, 0.0f);
+  PointCloudDownsampler adaptive(0.3f, 0.2f, 20.0f);
+  pcl::PointCloud<pcl::PointXYZ> uniform_output;
+  pcl::PointCloud<pcl::PointXYZ> adaptive_output;
+  uniform.Downsample(point_cloud, &uniform_output);
+  adaptive.Downsample(point_cloud, &adaptive_output);
+
+  // the same voxels near the lidar, and fewer far away
+  int uniform_near = 0;
+  int adaptive_near = 0;
+  for (const auto &point : uniform_output.points) {
+    uniform_near += std::hypot(point.x, point.y) < 19.0f ? 1 : 0;
+  }
+  for (const auto &point : adaptive_output.points) {
+    adaptive_near += std::hypot(point.x, point.y) < 19.0f ? 1 : 0;
+  }
+  EXPECT_EQ(uniform_near, adaptive_near);
+  EXPECT_LT(adaptive_output.size() - adaptive_near,
+            uniform_output.size() - uniform_near);
+}
+
+TEST(PointCloudDownsamplerTest, QuantizedPoints) {
+  pcl::PointCloud<pcl::PointXYZ> points;
+  points.push_back(pcl::PointXYZ(1.234f, -5.678f, 0.5f));
+  points.push_back(pcl::PointXYZ(-300.0f, 300.0f, -1.0f));
+  // out of the int16 range
+  points.push_back(pcl::PointXYZ(400.0f, 0.0f, 0.0f));
+  points.push_back(pcl::PointXYZ(NAN, 0.0f, 0.0f));
+  points.push_back(pcl::PointXYZ(-0.004f, 0.006f, 327.0f));
+
+  const float resolution = 0.01f;
+  std::string data;
+  EXPECT_EQ(3, EncodeQuantizedPoints(points, resolution, &data));
+  std::vector<float> num;
+  ASSERT_TRUE(DecodeQuantizedPoints(data, resolution, &num));
+  const std::vector<float> expected = {1.234f, -5.678f, 0.5f,  -300.0f, 300.0f,
+                                       -1.0f,  -0.004f, 0.006f, 327.0f};
+  ASSERT_EQ(expected.size(), num.size());
+  for (size_t i = 0; i < num.size(); ++i) {
+    EXPECT_NEAR(expected[i], num[i], resolution * 0.5f + 1.0e-4f);
+  }
+
+  // truncated in the last coordinate
+  EXPECT_FALSE(DecodeQuantizedPoints(data.substr(0, data.size() - 1),
+                                     resolution, &num));
+}
+
+}  // namespace dreamview
+}  // namespace apollo
@@ -20,7 +20,6 @@
 #include <vector>
 
 #include "nlohmann/json.hpp"
-#include "pcl/filters/voxel_grid.h"
 #include "yaml-cpp/yaml.h"
 
 #include "modules/dreamview/proto/point_cloud.pb.h"
@@ -44,7 +43,8 @@ PointCloudUpdater::PointCloudUpdater(WebSocketHandler *websocket)
     : UpdaterWithChannelsBase({"PointCloud", "PerceptionEdgeInfo"},
                               {"sensor", "edge"}),
       node_(cyber::CreateNode("point_cloud")),
-      websocket_(websocket) {
+      websocket_(websocket),
+      enable_voxel_filter_(FLAGS_enable_voxel_filter) {
   localization_reader_ = node_->CreateReader<LocalizationEstimate>(
       FLAGS_localization_topic,
       [this](const std::shared_ptr<LocalizationEstimate> &msg) {
@@ -60,6 +60,11 @@ PointCloudChannelUpdater* PointCloudUpdater::GetPointCloudChannelUpdater(
   if (channel_updaters_.find(channel_name) == channel_updaters_.end()) {
     channel_updaters_[channel_name] =
         new PointCloudChannelUpdater(channel_name);
+    channel_updaters_[channel_name]->downsampler_.reset(
+        new PointCloudDownsampler(
+            static_cast<float>(FLAGS_voxel_filter_size),
+            static_cast<float>(FLAGS_voxel_filter_height),
+            static_cast<float>(FLAGS_voxel_filter_range_step)));
     if (channel_name == FLAGS_perception_edge_info_topic) {
       channel_updaters_[channel_name]->perception_edge_reader_ =
           node_->CreateReader<PerceptionEdgeInfo>(
@@ -121,6 +126,12 @@ void PointCloudUpdater::StopStream(const std::string& channel_name) {
   // 回到初始值
   updater->last_point_cloud_time_ = 0.0;
   updater->point_cloud_str_ = "";
+  // Wait for the task in process, so that a new subscription does not start
+  // a second one on the same downsampler.
+  std::lock_guard<std::mutex> lock(updater->future_mutex_);
+  if (updater->async_future_.valid()) {
+    updater->async_future_.wait();
+  }
   updater->future_ready_ = true;
 }
 void PointCloudUpdater::PublishMessage(const std::string &channel_name) {
@@ -233,53 +244,58 @@ void PointCloudUpdater::UpdatePointCloud(
     AWARN << "skipping outdated point cloud data";
     return;
   }
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr;
-  // Check if last filter process has finished before processing new data.
   if (enable_voxel_filter_) {
+    // The message is downsampled off the reader thread, and dropped if the
+    // last one is still in process.
+    std::lock_guard<std::mutex> lock(updater->future_mutex_);
     if (updater->future_ready_) {
       updater->future_ready_ = false;
-      // transform from drivers::PointCloud to pcl::PointCloud
-      pcl_ptr = ConvertPCLPointCloud(point_cloud, channel_name);
-      std::future<void> f = cyber::Async(&PointCloudUpdater::FilterPointCloud,
-                                         this, pcl_ptr, channel_name);
+      std::future<void> f =
+          cyber::Async(&PointCloudUpdater::DownsamplePointCloud, this,
+                       point_cloud, channel_name);
       updater->async_future_ = std::move(f);
     }
   } else {
-    pcl_ptr = ConvertPCLPointCloud(point_cloud, channel_name);
-    this->FilterPointCloud(pcl_ptr, channel_name);
+    pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr =
+        ConvertPCLPointCloud(point_cloud, channel_name);
+    SerializePointCloud(pcl_ptr, channel_name);
   }
 }
 
-void PointCloudUpdater::FilterPointCloud(
-    pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr,
+void PointCloudUpdater::DownsamplePointCloud(
+    const std::shared_ptr<drivers::PointCloud> &point_cloud,
     const std::string &channel_name) {
   PointCloudChannelUpdater *updater = GetPointCloudChannelUpdater(channel_name);
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_filtered_ptr(
+  // Downsample in the lidar frame before the transform, so that only the
+  // voxel centroids are transformed, and the leaf grows with the range.
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr(
       new pcl::PointCloud<pcl::PointXYZ>);
+  updater->downsampler_->Downsample(*point_cloud, pcl_ptr.get());
+  TransformPointCloud(pcl_ptr, point_cloud->header().frame_id());
+  SerializePointCloud(pcl_ptr, channel_name);
+}
 
-  /*
-      By default, disable voxel filter since it's taking more than 500ms
-      ideally the most efficient sampling method is to
-      use per beam random sample for organized cloud(TODO)
-  */
-  if (enable_voxel_filter_) {
-    pcl::VoxelGrid<pcl::PointXYZ> voxel_grid;
-    voxel_grid.setInputCloud(pcl_ptr);
-    voxel_grid.setLeafSize(static_cast<float>(FLAGS_voxel_filter_size),
-                           static_cast<float>(FLAGS_voxel_filter_size),
-                           static_cast<float>(FLAGS_voxel_filter_height));
-    voxel_grid.filter(*pcl_filtered_ptr);
-  } else {
-    pcl_filtered_ptr = pcl_ptr;
-  }
-
+void PointCloudUpdater::SerializePointCloud(
+    pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr,
+    const std::string &channel_name) {
+  PointCloudChannelUpdater *updater = GetPointCloudChannelUpdater(channel_name);
   apollo::dreamview::PointCloud point_cloud_pb;
-  for (size_t idx = 0; idx < pcl_filtered_ptr->size(); ++idx) {
-    pcl::PointXYZ &pt = pcl_filtered_ptr->points[idx];
-    if (!std::isnan(pt.x) && !std::isnan(pt.y) && !std::isnan(pt.z)) {
-      point_cloud_pb.add_num(pt.x);
-      point_cloud_pb.add_num(pt.y);
-      point_cloud_pb.add_num(pt.z);
+  if (FLAGS_enable_point_cloud_quantization) {
+    const float resolution =
+        static_cast<float>(FLAGS_point_cloud_quantization_resolution);
+    EncodeQuantizedPoints(*pcl_ptr, resolution,
+                          point_cloud_pb.mutable_quantized_num());
+    point_cloud_pb.set_resolution(resolution);
+  } else {
+    point_cloud_pb.mutable_num()->Reserve(
+        static_cast<int>(pcl_ptr->size() * 3));
+    for (size_t idx = 0; idx < pcl_ptr->size(); ++idx) {
+      pcl::PointXYZ &pt = pcl_ptr->points[idx];
+      if (!std::isnan(pt.x) && !std::isnan(pt.y) && !std::isnan(pt.z)) {
+        point_cloud_pb.add_num(pt.x);
+        point_cloud_pb.add_num(pt.y);
+        point_cloud_pb.add_num(pt.z);
+      }
     }
   }
   {
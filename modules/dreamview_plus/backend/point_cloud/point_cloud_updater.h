@@ -22,6 +22,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -46,6 +47,7 @@
 #include "modules/transform/buffer.h"
 #include "modules/common/util/string_util.h"
 #include "modules/dreamview/backend/common/handlers/websocket_handler.h"
+#include "modules/dreamview_plus/backend/point_cloud/point_cloud_downsampler.h"
 #include "modules/dreamview_plus/backend/updater/updater_with_channels_base.h"
 
 /**
@@ -65,7 +67,12 @@ struct PointCloudChannelUpdater {
   std::string point_cloud_str_;
   std::unique_ptr<cyber::Timer> timer_;
   std::atomic<bool> future_ready_;
+  // Guards async_future_, replaced by the reader thread and waited for by
+  // StopStream.
+  std::mutex future_mutex_;
   std::future<void> async_future_;
+  // Only used by the async task, one at a time.
+  std::unique_ptr<PointCloudDownsampler> downsampler_;
   explicit PointCloudChannelUpdater(std::string channel_name)
       : cur_channel_name_(channel_name),
         point_cloud_reader_(nullptr),
@@ -120,8 +127,12 @@ class PointCloudUpdater : public UpdaterWithChannelsBase {
   void UpdatePointCloud(const std::shared_ptr<drivers::PointCloud> &point_cloud,
                         const std::string &channel_name);
 
-  void FilterPointCloud(pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr,
-                        const std::string &channel_name);
+  void DownsamplePointCloud(
+      const std::shared_ptr<drivers::PointCloud> &point_cloud,
+      const std::string &channel_name);
+
+  void SerializePointCloud(pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr,
+                           const std::string &channel_name);
 
   void UpdateLocalizationTime(
       const std::shared_ptr<apollo::localization::LocalizationEstimate>
@@ -2,7 +2,7 @@ import * as THREE from 'three';
 import Logger from '@dreamview/log';
 import { DreamviewAnalysis, perfMonitor } from '@dreamview/dreamview-analysis';
 import { pointCloudHeightColorMapping } from '../constant/common';
-import { disposeMesh, getPointSize } from '../utils/common';
+import { decodeQuantizedPointCloud, disposeMesh, getPointSize } from '../utils/common';
 
 const logger = Logger.getInstance(`PointCloud-${Date.now()}`);
 
@@ -54,8 +54,11 @@ export default class PointCloud {
         this.pointCloudMesh = pointCloudMesh;
     }
 
-    update(pointCloud) {
+    update(data) {
         perfMonitor.mark('pointCloudUpdateStart');
+        const pointCloud = data?.quantizedNum?.length
+            ? { num: decodeQuantizedPointCloud(data.quantizedNum, data.resolution) }
+            : data;
         if (!this.option.layerOption.Perception.pointCloud || !pointCloud.num || pointCloud.num.length % 3 !== 0) {
             logger.warn('pointCloud length should be multiples of 3');
             return;
@@ -176,3 +176,29 @@ export function getPointSize(pointCount: number) {
     }
     return 0.05;
 }
+
+// 解码量化点云：每个坐标为 resolution 的整数倍，以与上一个点同一坐标之差的 zigzag varint 编码
+export function decodeQuantizedPointCloud(data: Uint8Array, resolution: number) {
+    const num: number[] = [];
+    const last = [0, 0, 0];
+    let pos = 0;
+    while (pos < data.length) {
+        for (let i = 0; i < 3; i += 1) {
+            let value = 0;
+            let shift = 0;
+            let byte = 0x80;
+            while (byte & 0x80) {
+                if (pos >= data.length) {
+                    return num.slice(0, num.length - i);
+                }
+                byte = data[pos];
+                pos += 1;
+                value += (byte & 0x7f) * 2 ** shift;
+                shift += 7;
+            }
+            last[i] += value % 2 ? -(value + 1) / 2 : value / 2;
+            num.push(last[i] * resolution);
+        }
+    }
+    return num;
+}
@@ -144,6 +144,27 @@ class CanClient {
     return Send(frames, &n);
   }
 
+  /**
+   * @brief Send a batch of messages one by one. A failed message does not
+   *        stop the rest of the batch.
+   * @param frames The messages to send.
+   * @return The status of the first failed message, or OK.
+   */
+  virtual apollo::common::ErrorCode SendBatch(
+      const std::vector<CanFrame> &frames) {
+    apollo::common::ErrorCode result = apollo::common::ErrorCode::OK;
+    std::vector<CanFrame> single_frame(1);
+    for (const auto &frame : frames) {
+      single_frame[0] = frame;
+      const apollo::common::ErrorCode ret = SendSingleFrame(single_frame);
+      if (ret != apollo::common::ErrorCode::OK &&
+          result == apollo::common::ErrorCode::OK) {
+        result = ret;
+      }
+    }
+    return result;
+  }
+
   /**
    * @brief Receive messages
    * @param frames The messages to receive.
@@ -36,6 +36,49 @@ namespace can {
 
 using apollo::common::ErrorCode;
 
+namespace {
+
+bool ToSocketCanFrame(const CanFrame &frame, can_frame *socket_frame) {
+  if (frame.len > CANBUS_MESSAGE_LENGTH || frame.len < 0) {
+    AERROR << "frame.len = " << frame.len
+           << ", which is not equal to can message data length ("
+           << CANBUS_MESSAGE_LENGTH << ").";
+    return false;
+  }
+  if (frame.id > CAN_STANDARD_MAX_ID) {
+    socket_frame->can_id = (frame.id & CAN_EFF_MASK) | CAN_EFF_FLAG;
+  } else {
+    socket_frame->can_id = (frame.id & CAN_SFF_MASK);
+  }
+  ADEBUG << "send can id is " << socket_frame->can_id;
+  socket_frame->can_dlc = frame.len;
+  std::memcpy(socket_frame->data, frame.data, frame.len);
+  return true;
+}
+
+bool FromSocketCanFrame(const can_frame &socket_frame, CanFrame *frame) {
+  if (socket_frame.can_dlc > CANBUS_MESSAGE_LENGTH ||
+      socket_frame.can_dlc < 0) {
+    AERROR << "socket_frame.can_dlc = " << socket_frame.can_dlc
+           << ", which is not equal to can message data length ("
+           << CANBUS_MESSAGE_LENGTH << ").";
+    return false;
+  }
+  if (socket_frame.can_id > CAN_STANDARD_MAX_ID) {
+    frame->id = FLAGS_enable_can_err_check
+                    ? socket_frame.can_id & CAN_EFF_MASK | CAN_ERR_FLAG
+                    : socket_frame.can_id & CAN_EFF_MASK;
+  } else {
+    frame->id = (socket_frame.can_id & CAN_SFF_MASK);
+  }
+  ADEBUG << "Socket can receive can id is " << socket_frame.can_id;
+  frame->len = socket_frame.can_dlc;
+  std::memcpy(frame->data, socket_frame.data, socket_frame.can_dlc);
+  return true;
+}
+
+}  // namespace
+
 bool SocketCanClientRaw::Init(const CANCardParameter &parameter) {
   if (!parameter.has_channel_id()) {
     AERROR << "Init CAN failed: parameter does not have channel id. The "
@@ -108,6 +151,16 @@ ErrorCode SocketCanClientRaw::Start() {
     return ErrorCode::CAN_CLIENT_ERROR_BASE;
   }
 
+  // 3. kernel receive timestamps of the batched reception
+  if (FLAGS_enable_can_batch_io) {
+    ret = ::setsockopt(dev_handler_, SOL_SOCKET, SO_TIMESTAMP, &enable,
+                       sizeof(enable));
+    if (ret < 0) {
+      AERROR << "enable receive timestamps error code: " << ret;
+      return ErrorCode::CAN_CLIENT_ERROR_BASE;
+    }
+  }
+
   std::string interface_prefix;
   if (interface_ == CANCardParameter::VIRTUAL) {
     interface_prefix = "vcan";
@@ -164,20 +217,9 @@ ErrorCode SocketCanClientRaw::Send(const std::vector<CanFrame> &frames,
     return ErrorCode::CAN_CLIENT_ERROR_SEND_FAILED;
   }
   for (size_t i = 0; i < frames.size() && i < MAX_CAN_SEND_FRAME_LEN; ++i) {
-    if (frames[i].len > CANBUS_MESSAGE_LENGTH || frames[i].len < 0) {
-      AERROR << "frames[" << i << "].len = " << frames[i].len
-             << ", which is not equal to can message data length ("
-             << CANBUS_MESSAGE_LENGTH << ").";
+    if (!ToSocketCanFrame(frames[i], &send_frames_[i])) {
       return ErrorCode::CAN_CLIENT_ERROR_SEND_FAILED;
     }
-    if (frames[i].id > CAN_STANDARD_MAX_ID) {
-      send_frames_[i].can_id = (frames[i].id & CAN_EFF_MASK) | CAN_EFF_FLAG;
-    } else {
-      send_frames_[i].can_id = (frames[i].id & CAN_SFF_MASK);
-    }
-    ADEBUG << "send can id is " << send_frames_[i].can_id;
-    send_frames_[i].can_dlc = frames[i].len;
-    std::memcpy(send_frames_[i].data, frames[i].data, frames[i].len);
 
     // Synchronous transmission of CAN messages
     int ret = static_cast<int>(
@@ -206,6 +248,10 @@ ErrorCode SocketCanClientRaw::Receive(std::vector<CanFrame> *const frames,
     return ErrorCode::CAN_CLIENT_ERROR_FRAME_NUM;
   }
 
+  if (FLAGS_enable_can_batch_io) {
+    return ReceiveBatch(frames, frame_num);
+  }
+
   for (int32_t i = 0; i < *frame_num && i < MAX_CAN_RECV_FRAME_LEN; ++i) {
     CanFrame cf;
     auto ret = read(dev_handler_, &recv_frames_[i], sizeof(recv_frames_[i]));
@@ -214,29 +260,106 @@ ErrorCode SocketCanClientRaw::Receive(std::vector<CanFrame> *const frames,
       AERROR << "receive message failed, error code: " << ret;
       return ErrorCode::CAN_CLIENT_ERROR_BASE;
     }
-    if (recv_frames_[i].can_dlc > CANBUS_MESSAGE_LENGTH ||
-        recv_frames_[i].can_dlc < 0) {
-      AERROR << "recv_frames_[" << i
-             << "].can_dlc = " << recv_frames_[i].can_dlc
-             << ", which is not equal to can message data length ("
-             << CANBUS_MESSAGE_LENGTH << ").";
+    if (!FromSocketCanFrame(recv_frames_[i], &cf)) {
       return ErrorCode::CAN_CLIENT_ERROR_RECV_FAILED;
     }
-    if (recv_frames_[i].can_id > CAN_STANDARD_MAX_ID) {
-      cf.id = FLAGS_enable_can_err_check
-                  ? recv_frames_[i].can_id & CAN_EFF_MASK | CAN_ERR_FLAG
-                  : recv_frames_[i].can_id & CAN_EFF_MASK;
-    } else {
-      cf.id = (recv_frames_[i].can_id & CAN_SFF_MASK);
+    frames->push_back(cf);
+  }
+  return ErrorCode::OK;
+}
+
+ErrorCode SocketCanClientRaw::ReceiveBatch(std::vector<CanFrame> *const frames,
+                                           int32_t *const frame_num) {
+  const unsigned int max_num = static_cast<unsigned int>(*frame_num);
+  if (max_num == 0) {
+    return ErrorCode::OK;
+  }
+  for (unsigned int i = 0; i < max_num; ++i) {
+    recv_iovecs_[i].iov_base = &recv_frames_[i];
+    recv_iovecs_[i].iov_len = sizeof(recv_frames_[i]);
+    std::memset(&recv_msgs_[i], 0, sizeof(recv_msgs_[i]));
+    recv_msgs_[i].msg_hdr.msg_iov = &recv_iovecs_[i];
+    recv_msgs_[i].msg_hdr.msg_iovlen = 1;
+    recv_msgs_[i].msg_hdr.msg_control = recv_controls_[i];
+    recv_msgs_[i].msg_hdr.msg_controllen = sizeof(recv_controls_[i]);
+  }
+
+  // wait for the first frame, then take the frames already queued
+  const int ret =
+      recvmmsg(dev_handler_, recv_msgs_, max_num, MSG_WAITFORONE, nullptr);
+  if (ret < 0) {
+    AERROR << "receive message failed, error code: " << ret;
+    return ErrorCode::CAN_CLIENT_ERROR_BASE;
+  }
+
+  for (int i = 0; i < ret; ++i) {
+    CanFrame cf;
+    if (!FromSocketCanFrame(recv_frames_[i], &cf)) {
+      return ErrorCode::CAN_CLIENT_ERROR_RECV_FAILED;
+    }
+    struct msghdr *msg = &recv_msgs_[i].msg_hdr;
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(msg); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(msg, cmsg)) {
+      if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMP) {
+        std::memcpy(&cf.timestamp, CMSG_DATA(cmsg), sizeof(cf.timestamp));
+      }
     }
-    ADEBUG << "Socket can receive can id is " << recv_frames_[i].can_id;
-    cf.len = recv_frames_[i].can_dlc;
-    std::memcpy(cf.data, recv_frames_[i].data, recv_frames_[i].can_dlc);
     frames->push_back(cf);
   }
+  *frame_num = ret;
   return ErrorCode::OK;
 }
 
+ErrorCode SocketCanClientRaw::SendBatch(const std::vector<CanFrame> &frames) {
+  if (!FLAGS_enable_can_batch_io) {
+    return CanClient::SendBatch(frames);
+  }
+  if (!is_started_) {
+    AERROR << "Nvidia can client has not been initiated! Please init first!";
+    return ErrorCode::CAN_CLIENT_ERROR_SEND_FAILED;
+  }
+
+  ErrorCode result = ErrorCode::OK;
+  batch_send_frames_.resize(frames.size());
+  size_t num = 0;
+  for (const auto &frame : frames) {
+    if (!ToSocketCanFrame(frame, &batch_send_frames_[num])) {
+      if (result == ErrorCode::OK) {
+        result = ErrorCode::CAN_CLIENT_ERROR_SEND_FAILED;
+      }
+      continue;
+    }
+    ++num;
+  }
+  send_msgs_.resize(num);
+  send_iovecs_.resize(num);
+  for (size_t i = 0; i < num; ++i) {
+    send_iovecs_[i].iov_base = &batch_send_frames_[i];
+    send_iovecs_[i].iov_len = sizeof(batch_send_frames_[i]);
+    std::memset(&send_msgs_[i], 0, sizeof(send_msgs_[i]));
+    send_msgs_[i].msg_hdr.msg_iov = &send_iovecs_[i];
+    send_msgs_[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  // a frame that fails is skipped, as it is by sending one by one
+  size_t sent = 0;
+  while (sent < num) {
+    const int ret =
+        sendmmsg(dev_handler_, &send_msgs_[sent],
+                 static_cast<unsigned int>(num - sent), 0);
+    if (ret <= 0) {
+      AERROR << "send message failed, error code: " << ret;
+      if (result == ErrorCode::OK) {
+        result = ErrorCode::CAN_CLIENT_ERROR_BASE;
+      }
+      ++sent;
+    } else {
+      sent += static_cast<size_t>(ret);
+    }
+  }
+  return result;
+}
+
 std::string SocketCanClientRaw::GetErrorString(const int32_t /*status*/) {
   return "";
 }
@@ -27,6 +27,7 @@
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 
 #include <linux/can.h>
 #include <linux/can/raw.h>
@@ -103,6 +104,15 @@ class SocketCanClientRaw : public CanClient {
   apollo::common::ErrorCode Receive(std::vector<CanFrame> *const frames,
                                     int32_t *const frame_num) override;
 
+  /**
+   * @brief Send messages with as few sendmmsg as possible when batch io is
+   *        enabled, otherwise one by one.
+   * @param frames The messages to send.
+   * @return The status of the first failed message, or OK.
+   */
+  apollo::common::ErrorCode SendBatch(
+      const std::vector<CanFrame> &frames) override;
+
   /**
    * @brief Get the error string.
    * @param status The status to get the error string.
@@ -110,11 +120,29 @@ class SocketCanClientRaw : public CanClient {
   std::string GetErrorString(const int32_t status) override;
 
  private:
+  /*
+   * @brief receive the available messages, up to frame_num and at least one,
+   * by one recvmmsg, with the kernel receive timestamps. frame_num is set to
+   * the amount of messages received.
+   */
+  apollo::common::ErrorCode ReceiveBatch(std::vector<CanFrame> *const frames,
+                                         int32_t *const frame_num);
+
   int dev_handler_ = 0;
   CANCardParameter::CANChannelId port_;
   CANCardParameter::CANInterface interface_;
   can_frame send_frames_[MAX_CAN_SEND_FRAME_LEN];
   can_frame recv_frames_[MAX_CAN_RECV_FRAME_LEN];
+
+  // buffers of batch io, kept between calls
+  static constexpr size_t kRecvControlSize = CMSG_SPACE(sizeof(struct timeval));
+  struct mmsghdr recv_msgs_[MAX_CAN_RECV_FRAME_LEN];
+  struct iovec recv_iovecs_[MAX_CAN_RECV_FRAME_LEN];
+  alignas(struct cmsghdr) char recv_controls_[MAX_CAN_RECV_FRAME_LEN]
+                                             [kRecvControlSize];
+  std::vector<can_frame> batch_send_frames_;
+  std::vector<struct mmsghdr> send_msgs_;
+  std::vector<struct iovec> send_iovecs_;
 };
 
 }  // namespace can
@@ -22,6 +22,8 @@
 
 #include "modules/common_msgs/drivers_msgs/can_card_parameter.pb.h"
 
+#include "modules/drivers/canbus/sensor_gflags.h"
+
 namespace apollo {
 namespace drivers {
 namespace canbus {
@@ -50,6 +52,51 @@ TEST(SocketCanClientRawTest, simple_test) {
   socket_can_client.Stop();
 }
 
+// needs a virtual can: ip link add dev vcan0 type vcan && ip link set up vcan0
+TEST(SocketCanClientRawTest, batch_io_on_vcan) {
+  FLAGS_enable_can_batch_io = true;
+  CANCardParameter param;
+  param.set_brand(CANCardParameter::SOCKET_CAN_RAW);
+  param.set_channel_id(CANCardParameter::CHANNEL_ID_ZERO);
+  param.set_interface(CANCardParameter::VIRTUAL);
+  SocketCanClientRaw sender;
+  SocketCanClientRaw receiver;
+  EXPECT_TRUE(sender.Init(param));
+  EXPECT_TRUE(receiver.Init(param));
+  if (sender.Start() != ErrorCode::OK || receiver.Start() != ErrorCode::OK) {
+    FLAGS_enable_can_batch_io = false;
+    GTEST_SKIP() << "vcan0 is not available";
+  }
+
+  const int num_frames = 25;
+  std::vector<CanFrame> frames(num_frames);
+  for (int i = 0; i < num_frames; ++i) {
+    frames[i].id = i % 2 == 0 ? 0x100 + i : 0x18FF0000 + i;
+    frames[i].len = 8;
+    frames[i].data[0] = static_cast<uint8_t>(i);
+  }
+  EXPECT_EQ(sender.SendBatch(frames), ErrorCode::OK);
+
+  std::vector<CanFrame> received;
+  while (received.size() < frames.size()) {
+    int32_t num = MAX_CAN_RECV_FRAME_LEN;
+    const size_t size = received.size();
+    ASSERT_EQ(receiver.Receive(&received, &num), ErrorCode::OK);
+    EXPECT_LT(0, num);
+    EXPECT_EQ(size + num, received.size());
+  }
+  ASSERT_EQ(frames.size(), received.size());
+  for (int i = 0; i < num_frames; ++i) {
+    EXPECT_EQ(frames[i].id, received[i].id);
+    EXPECT_EQ(frames[i].len, received[i].len);
+    EXPECT_EQ(frames[i].data[0], received[i].data[0]);
+    EXPECT_NE(0, received[i].timestamp.tv_sec);
+  }
+  sender.Stop();
+  receiver.Stop();
+  FLAGS_enable_can_batch_io = false;
+}
+
 }  // namespace can
 }  // namespace canbus
 }  // namespace drivers
@@ -0,0 +1,198 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Chassis frames parsed one by one or in batches of a receive, and frames
+// sent in bursts over vcan0 and received by a thread, one syscall per frame
+// or with sendmmsg/recvmmsg. The frames received per second and the mean
+// latency from the send to the return of the receive are reported in the
+// counters. The vcan0 benchmark is skipped without vcan0:
+//   ip link add dev vcan0 type vcan && ip link set up vcan0
+
+#include <sys/time.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "modules/common_msgs/chassis_msgs/chassis_detail.pb.h"
+
+#include "modules/drivers/canbus/can_client/socket/socket_can_client_raw.h"
+#include "modules/drivers/canbus/can_comm/message_manager.h"
+#include "modules/drivers/canbus/sensor_gflags.h"
+
+namespace apollo {
+namespace drivers {
+namespace canbus {
+namespace {
+
+using ::apollo::canbus::ChassisDetail;
+using apollo::common::ErrorCode;
+
+constexpr int kNumFrames = 2000;
+constexpr uint32_t kStopId = 0x7FF;
+
+template <int kId>
+class BenchmarkProtocolData : public ProtocolData<ChassisDetail> {
+ public:
+  static const int32_t ID = kId;
+  void Parse(const uint8_t *bytes, int32_t length,
+             ChassisDetail *chassis_detail) const override {
+    auto *gas = chassis_detail->mutable_gas();
+    gas->set_throttle_input(bytes[0]);
+    gas->set_throttle_output(bytes[1] * 0.1);
+  }
+};
+
+class BenchmarkMessageManager : public MessageManager<ChassisDetail> {
+ public:
+  BenchmarkMessageManager() {
+    AddRecvProtocolData<BenchmarkProtocolData<0x100>, true>();
+    AddRecvProtocolData<BenchmarkProtocolData<0x101>, true>();
+    AddRecvProtocolData<BenchmarkProtocolData<0x102>, true>();
+    AddRecvProtocolData<BenchmarkProtocolData<0x103>, false>();
+  }
+};
+
+int64_t NowUs() {
+  struct timeval now;
+  gettimeofday(&now, nullptr);
+  return static_cast<int64_t>(now.tv_sec) * 1000000 + now.tv_usec;
+}
+
+// args: batch parse
+void BM_ParseFrames(benchmark::State &state) {  // NOLINT
+  const bool batch = state.range(0) != 0;
+  BenchmarkMessageManager manager;
+  std::vector<CanFrame> frames(MAX_CAN_RECV_FRAME_LEN);
+  for (size_t i = 0; i < frames.size(); ++i) {
+    frames[i].id = 0x100 + static_cast<uint32_t>(i % 4);
+    frames[i].len = 8;
+    frames[i].data[0] = static_cast<uint8_t>(i);
+  }
+  for (auto _ : state) {
+    if (batch) {
+      manager.ParseBatch(frames);
+    } else {
+      for (const auto &frame : frames) {
+        manager.Parse(frame.id, frame.data, frame.len);
+      }
+    }
+  }
+  state.counters["frames"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * frames.size()),
+      benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_ParseFrames)->Arg(0)->Arg(1);
+
+// args: batch io, frames per burst
+void BM_VcanRoundTrip(benchmark::State &state) {  // NOLINT
+  FLAGS_enable_can_batch_io = state.range(0) != 0;
+  const int burst = static_cast<int>(state.range(1));
+  CANCardParameter param;
+  param.set_brand(CANCardParameter::SOCKET_CAN_RAW);
+  param.set_channel_id(CANCardParameter::CHANNEL_ID_ZERO);
+  param.set_interface(CANCardParameter::VIRTUAL);
+  can::SocketCanClientRaw sender;
+  can::SocketCanClientRaw receiver;
+  sender.Init(param);
+  receiver.Init(param);
+  if (sender.Start() != ErrorCode::OK || receiver.Start() != ErrorCode::OK) {
+    state.SkipWithError("vcan0 is not available");
+    return;
+  }
+
+  int64_t received_frames = 0;
+  int64_t latency_sum = 0;
+  for (auto _ : state) {
+    std::atomic<bool> stopped = {false};
+    std::thread receive_thread([&]() {
+      std::vector<CanFrame> buf;
+      while (true) {
+        buf.clear();
+        int32_t num = MAX_CAN_RECV_FRAME_LEN;
+        if (receiver.Receive(&buf, &num) != ErrorCode::OK) {
+          continue;
+        }
+        const int64_t now = NowUs();
+        for (const auto &frame : buf) {
+          if (frame.id == kStopId) {
+            stopped = true;
+            return;
+          }
+          int64_t sent = 0;
+          std::memcpy(&sent, frame.data, sizeof(sent));
+          latency_sum += now - sent;
+          ++received_frames;
+        }
+      }
+    });
+
+    std::vector<CanFrame> frames(burst);
+    for (int i = 0; i < kNumFrames; i += burst) {
+      const int64_t now = NowUs();
+      for (int j = 0; j < burst; ++j) {
+        frames[j].id = 0x100 + j % 4;
+        frames[j].len = 8;
+        std::memcpy(frames[j].data, &now, sizeof(now));
+      }
+      sender.SendBatch(frames);
+      std::this_thread::sleep_for(std::chrono::microseconds(100 * burst));
+    }
+    // the stop frame until it is not lost
+    std::vector<CanFrame> stop(1);
+    stop[0].id = kStopId;
+    stop[0].len = 8;
+    while (!stopped) {
+      sender.SendBatch(stop);
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    receive_thread.join();
+  }
+  sender.Stop();
+  receiver.Stop();
+  FLAGS_enable_can_batch_io = false;
+
+  state.counters["frames"] = benchmark::Counter(
+      static_cast<double>(received_frames), benchmark::Counter::kIsRate);
+  state.counters["frame_loss"] =
+      1.0 - static_cast<double>(received_frames) /
+                static_cast<double>(kNumFrames * state.iterations());
+  state.counters["latency_us"] =
+      received_frames > 0 ? static_cast<double>(latency_sum) /
+                                static_cast<double>(received_frames)
+                          : 0.0;
+}
+
+BENCHMARK(BM_VcanRoundTrip)
+    ->Args({0, 1})
+    ->Args({0, 10})
+    ->Args({1, 1})
+    ->Args({1, 10})
+    ->Iterations(5)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace canbus
+}  // namespace drivers
+}  // namespace apollo
+
+BENCHMARK_MAIN();
@@ -37,6 +37,7 @@
 #include "modules/drivers/canbus/can_client/can_client.h"
 #include "modules/drivers/canbus/can_comm/message_manager.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/sensor_gflags.h"
 
 /**
  * @namespace apollo::drivers::canbus
@@ -147,11 +148,13 @@ void CanReceiver<SensorType>::RecvThreadFunc() {
   int32_t receive_none_count = 0;
   const int32_t ERROR_COUNT_MAX = 10;
   auto default_period = 10 * 1000;
+  std::vector<CanFrame> buf;
+  buf.reserve(MAX_CAN_RECV_FRAME_LEN);
 
   while (IsRunning()) {
     is_finish_recv_once_.exchange(false);
     ADEBUG << "is_finish_recv_once_ 1 is " << is_finish_recv_once_.load();
-    std::vector<CanFrame> buf;
+    buf.clear();
     int32_t frame_num = MAX_CAN_RECV_FRAME_LEN;
     if (can_client_->Receive(&buf, &frame_num) !=
         ::apollo::common::ErrorCode::OK) {
@@ -178,6 +181,18 @@ void CanReceiver<SensorType>::RecvThreadFunc() {
     }
     receive_none_count = 0;
 
+    if (FLAGS_enable_can_batch_io) {
+      pt_manager_->ParseBatch(buf);
+      if (enable_log_) {
+        for (const auto &frame : buf) {
+          AINFO << "recv_can_frame#" << frame.CanFrameString();
+        }
+      }
+      is_finish_recv_once_.exchange(true);
+      cyber::Yield();
+      continue;
+    }
+
     for (const auto &frame : buf) {
       uint8_t len = frame.len;
       uint32_t uid = frame.id;
@@ -39,6 +39,7 @@
 #include "modules/drivers/canbus/can_client/can_client.h"
 #include "modules/drivers/canbus/can_comm/message_manager.h"
 #include "modules/drivers/canbus/can_comm/protocol_data.h"
+#include "modules/drivers/canbus/sensor_gflags.h"
 
 /**
  * @namespace apollo::drivers::canbus
@@ -315,6 +316,7 @@ void CanSender<SensorType>::PowerSendThreadFunc() {
   int64_t tm_start = 0;
   int64_t tm_end = 0;
   int64_t sleep_interval = 0;
+  std::vector<CanFrame> batch_frames;
 
   AINFO << "Can client sender thread starts.";
 
@@ -330,6 +332,10 @@ void CanSender<SensorType>::PowerSendThreadFunc() {
       if (!need_send) {
         continue;
       }
+      if (FLAGS_enable_can_batch_io) {
+        batch_frames.push_back(message.CanFrame());
+        continue;
+      }
       std::vector<CanFrame> can_frames;
       CanFrame can_frame = message.CanFrame();
       can_frames.push_back(can_frame);
@@ -346,6 +352,19 @@ void CanSender<SensorType>::PowerSendThreadFunc() {
         pt_manager_->ParseSender(uid, data, len);
       }
     }
+    if (!batch_frames.empty()) {
+      // the messages due in this period by as few syscalls as possible
+      if (can_client_->SendBatch(batch_frames) != common::ErrorCode::OK) {
+        AERROR << "Send batch of " << batch_frames.size() << " msgs failed.";
+      }
+      for (const auto &can_frame : batch_frames) {
+        if (enable_log()) {
+          AINFO << "send_can_frame#" << can_frame.CanFrameString();
+        }
+        pt_manager_->ParseSender(can_frame.id, can_frame.data, can_frame.len);
+      }
+      batch_frames.clear();
+    }
     delta_period = new_delta_period;
     tm_end = cyber::Time::Now().ToNanosecond() / 1e3;
     sleep_interval = delta_period - (tm_end - tm_start);
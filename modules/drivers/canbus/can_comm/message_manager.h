@@ -32,8 +32,10 @@
 
 #include "cyber/common/log.h"
 #include "cyber/time/time.h"
+#include "modules/drivers/canbus/can_client/can_client.h"
 #include "modules/drivers/canbus/can_comm/protocol_data.h"
 #include "modules/drivers/canbus/common/byte.h"
+#include "modules/drivers/canbus/common/canbus_consts.h"
 
 /**
  * @namespace apollo::drivers::canbus
@@ -86,6 +88,14 @@ class MessageManager {
   virtual void Parse(const uint32_t message_id, const uint8_t *data,
                      int32_t length);
 
+  /**
+   * @brief parse a batch of received messages as Parse does one by one, but
+   * take each lock once for the batch. The periods of the checked messages
+   * are measured by the timestamps of the frames if they have.
+   * @param frames the received messages
+   */
+  virtual void ParseBatch(const std::vector<CanFrame> &frames);
+
   /**
    * @brief parse data and store parsed info in send protocol data
    * @param message_id the id of the message
@@ -159,10 +169,21 @@ class MessageManager {
   template <class T, bool need_check>
   void AddSendProtocolData();
 
+  void AddProtocolData(const uint32_t message_id,
+                       ProtocolData<SensorType> *protocol_data);
+
+  /*
+   * @brief count the error of the period of the message if it is checked
+   * @param time the time of the message in microseconds
+   */
+  void CheckPeriod(const uint32_t message_id, const int64_t time);
+
   std::vector<std::unique_ptr<ProtocolData<SensorType>>> send_protocol_data_;
   std::vector<std::unique_ptr<ProtocolData<SensorType>>> recv_protocol_data_;
 
   std::unordered_map<uint32_t, ProtocolData<SensorType> *> protocol_data_map_;
+  // protocol_data_map_ of the standard ids, indexed by the id
+  std::vector<ProtocolData<SensorType> *> protocol_data_table_;
   std::unordered_map<uint32_t, ProtocolData<SensorType> *>
       recv_protocol_data_map_;
   std::unordered_map<uint32_t, ProtocolData<SensorType> *>
@@ -183,6 +204,9 @@ class MessageManager {
   SensorType sensor_check_sender_data_;
   bool is_received_on_time_ = false;
 
+  // protocol data of the frames of the batch being parsed
+  std::vector<ProtocolData<SensorType> *> batch_protocol_data_;
+
   std::condition_variable cvar_;
 };
 
@@ -195,7 +219,7 @@ void MessageManager<SensorType>::AddRecvProtocolData() {
     return;
   }
   recv_protocol_data_map_[T::ID] = dt;
-  protocol_data_map_[T::ID] = dt;
+  AddProtocolData(T::ID, dt);
   if (need_check) {
     check_ids_[T::ID].period = dt->GetPeriod();
     check_ids_[T::ID].real_period = 0;
@@ -213,7 +237,7 @@ void MessageManager<SensorType>::AddSendProtocolData() {
     return;
   }
   sender_protocol_data_map_[T::ID] = dt;
-  protocol_data_map_[T::ID] = dt;
+  AddProtocolData(T::ID, dt);
   if (need_check) {
     check_ids_[T::ID].period = dt->GetPeriod();
     check_ids_[T::ID].real_period = 0;
@@ -222,17 +246,37 @@ void MessageManager<SensorType>::AddSendProtocolData() {
   }
 }
 
+template <typename SensorType>
+void MessageManager<SensorType>::AddProtocolData(
+    const uint32_t message_id, ProtocolData<SensorType> *protocol_data) {
+  protocol_data_map_[message_id] = protocol_data;
+  if (message_id <= MAX_STANDARD_CAN_ID) {
+    if (protocol_data_table_.empty()) {
+      protocol_data_table_.resize(MAX_STANDARD_CAN_ID + 1, nullptr);
+    }
+    protocol_data_table_[message_id] = protocol_data;
+  }
+}
+
 template <typename SensorType>
 ProtocolData<SensorType> *
 MessageManager<SensorType>::GetMutableProtocolDataById(
     const uint32_t message_id) {
   ADEBUG << "get protocol data message_id is:" << Byte::byte_to_hex(message_id);
-  if (protocol_data_map_.find(message_id) == protocol_data_map_.end()) {
+  ProtocolData<SensorType> *protocol_data = nullptr;
+  if (message_id < protocol_data_table_.size()) {
+    protocol_data = protocol_data_table_[message_id];
+  } else if (message_id > MAX_STANDARD_CAN_ID) {
+    const auto it = protocol_data_map_.find(message_id);
+    if (it != protocol_data_map_.end()) {
+      protocol_data = it->second;
+    }
+  }
+  if (protocol_data == nullptr) {
     ADEBUG << "Unable to get protocol data because of invalid message_id:"
            << Byte::byte_to_hex(message_id);
-    return nullptr;
   }
-  return protocol_data_map_[message_id];
+  return protocol_data;
 }
 
 template <typename SensorType>
@@ -264,20 +308,65 @@ void MessageManager<SensorType>::Parse(const uint32_t message_id,
   }
 
   received_ids_.insert(message_id);
-  // check if need to check period
-  const auto it = check_ids_.find(message_id);
-  if (it != check_ids_.end()) {
-    const int64_t time = Time::Now().ToNanosecond() / 1e3;
-    it->second.real_period = time - it->second.last_time;
-    // if period 1.5 large than base period, inc error_count
-    const double period_multiplier = 1.5;
-    if (static_cast<double>(it->second.real_period) >
-        (static_cast<double>(it->second.period) * period_multiplier)) {
-      it->second.error_count += 1;
+  CheckPeriod(message_id, Time::Now().ToNanosecond() / 1e3);
+}
+
+template <typename SensorType>
+void MessageManager<SensorType>::ParseBatch(
+    const std::vector<CanFrame> &frames) {
+  batch_protocol_data_.resize(frames.size());
+  for (size_t i = 0; i < frames.size(); ++i) {
+    batch_protocol_data_[i] = GetMutableProtocolDataById(frames[i].id);
+  }
+  // parse all
+  {
+    std::lock_guard<std::mutex> lock(sensor_data_mutex_);
+    for (size_t i = 0; i < frames.size(); ++i) {
+      if (batch_protocol_data_[i] != nullptr) {
+        batch_protocol_data_[i]->Parse(frames[i].data, frames[i].len,
+                                       &sensor_data_);
+      }
+    }
+  }
+
+  // parse revceiver
+  {
+    std::lock_guard<std::mutex> lock(sensor_data_recv_mutex_);
+    for (size_t i = 0; i < frames.size(); ++i) {
+      if (batch_protocol_data_[i] != nullptr) {
+        batch_protocol_data_[i]->Parse(frames[i].data, frames[i].len,
+                                       &sensor_recv_data_);
+      }
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(sensor_data_check_recv_mutex_);
+    for (size_t i = 0; i < frames.size(); ++i) {
+      if (batch_protocol_data_[i] != nullptr) {
+        batch_protocol_data_[i]->Parse(frames[i].data, frames[i].len,
+                                       &sensor_check_recv_data_);
+      }
+    }
+  }
+
+  const int64_t now = Time::Now().ToNanosecond() / 1e3;
+  for (size_t i = 0; i < frames.size(); ++i) {
+    if (batch_protocol_data_[i] == nullptr) {
+      continue;
+    }
+    const uint32_t message_id = frames[i].id;
+    if (recv_protocol_data_map_.find(message_id) ==
+        recv_protocol_data_map_.end()) {
+      AERROR << "Failed to get recv data, " << "message is " << message_id;
+    }
+    received_ids_.insert(message_id);
+    const struct timeval &timestamp = frames[i].timestamp;
+    if (timestamp.tv_sec != 0 || timestamp.tv_usec != 0) {
+      CheckPeriod(message_id, static_cast<int64_t>(timestamp.tv_sec) * 1000000 +
+                                  timestamp.tv_usec);
     } else {
-      it->second.error_count = 0;
+      CheckPeriod(message_id, now);
     }
-    it->second.last_time = time;
   }
 }
 
@@ -307,10 +396,15 @@ void MessageManager<SensorType>::ParseSender(const uint32_t message_id,
   }
 
   received_ids_.insert(message_id);
+  CheckPeriod(message_id, Time::Now().ToNanosecond() / 1e3);
+}
+
+template <typename SensorType>
+void MessageManager<SensorType>::CheckPeriod(const uint32_t message_id,
+                                             const int64_t time) {
   // check if need to check period
   const auto it = check_ids_.find(message_id);
   if (it != check_ids_.end()) {
-    const int64_t time = Time::Now().ToNanosecond() / 1e3;
     it->second.real_period = time - it->second.last_time;
     // if period 1.5 large than base period, inc error_count
     const double period_multiplier = 1.5;
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <set>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -36,15 +37,45 @@ class MockProtocolData : public ProtocolData<::apollo::canbus::ChassisDetail> {
   MockProtocolData() {}
 };
 
+// the result depends on the order of the parsed messages
+class MockThrottleProtocolData
+    : public ProtocolData<::apollo::canbus::ChassisDetail> {
+ public:
+  static const int32_t ID = 0x112;
+  MockThrottleProtocolData() {}
+  void Parse(const uint8_t *bytes, int32_t length,
+             ::apollo::canbus::ChassisDetail *chassis_detail) const override {
+    auto *gas = chassis_detail->mutable_gas();
+    gas->set_throttle_input(bytes[0]);
+    gas->set_throttle_output(gas->throttle_output() * 2.0 + bytes[0]);
+  }
+};
+
 class MockMessageManager
     : public MessageManager<::apollo::canbus::ChassisDetail> {
  public:
   MockMessageManager() {
     AddRecvProtocolData<MockProtocolData, true>();
     AddSendProtocolData<MockProtocolData, true>();
+    AddRecvProtocolData<MockThrottleProtocolData, true>();
+  }
+
+  int32_t error_count(const uint32_t message_id) {
+    return check_ids_[message_id].error_count;
   }
 };
 
+CanFrame MockFrame(const uint32_t id, const uint8_t value,
+                   const int64_t time_us) {
+  CanFrame frame;
+  frame.id = id;
+  frame.len = 8;
+  frame.data[0] = value;
+  frame.timestamp.tv_sec = time_us / 1000000;
+  frame.timestamp.tv_usec = time_us % 1000000;
+  return frame;
+}
+
 TEST(MessageManagerTest, GetMutableProtocolDataById) {
   uint8_t mock_data = 1;
   MockMessageManager manager;
@@ -58,6 +89,48 @@ TEST(MessageManagerTest, GetMutableProtocolDataById) {
   EXPECT_EQ(manager.GetSensorData(nullptr), ErrorCode::CANBUS_ERROR);
 }
 
+TEST(MessageManagerTest, ParseBatch) {
+  std::vector<CanFrame> frames;
+  for (uint8_t i = 0; i < 10; ++i) {
+    frames.push_back(MockFrame(MockThrottleProtocolData::ID, i, 0));
+    frames.push_back(MockFrame(0x999, i, 0));
+    frames.push_back(MockFrame(MockProtocolData::ID, i, 0));
+  }
+  MockMessageManager serial;
+  for (const auto &frame : frames) {
+    serial.Parse(frame.id, frame.data, frame.len);
+  }
+  MockMessageManager batch;
+  batch.ParseBatch(frames);
+
+  ::apollo::canbus::ChassisDetail expected;
+  ::apollo::canbus::ChassisDetail chassis_detail;
+  EXPECT_EQ(serial.GetSensorData(&expected), ErrorCode::OK);
+  EXPECT_EQ(batch.GetSensorData(&chassis_detail), ErrorCode::OK);
+  EXPECT_EQ(expected.DebugString(), chassis_detail.DebugString());
+  EXPECT_DOUBLE_EQ(1013.0, chassis_detail.gas().throttle_output());
+  EXPECT_EQ(serial.GetSensorRecvData(&expected), ErrorCode::OK);
+  EXPECT_EQ(batch.GetSensorRecvData(&chassis_detail), ErrorCode::OK);
+  EXPECT_EQ(expected.DebugString(), chassis_detail.DebugString());
+  EXPECT_EQ(serial.GetSensorCheckRecvData(&expected), ErrorCode::OK);
+  EXPECT_EQ(batch.GetSensorCheckRecvData(&chassis_detail), ErrorCode::OK);
+  EXPECT_EQ(expected.DebugString(), chassis_detail.DebugString());
+}
+
+TEST(MessageManagerTest, ParseBatchPeriodByTimestamps) {
+  // the period of the mock protocol data is 100ms
+  const int64_t start = 1700000000000000;
+  MockMessageManager manager;
+  manager.ParseBatch({MockFrame(MockThrottleProtocolData::ID, 0, start)});
+  manager.ParseBatch(
+      {MockFrame(MockThrottleProtocolData::ID, 0, start + 100000),
+       MockFrame(MockThrottleProtocolData::ID, 0, start + 300000)});
+  EXPECT_EQ(1, manager.error_count(MockThrottleProtocolData::ID));
+  manager.ParseBatch(
+      {MockFrame(MockThrottleProtocolData::ID, 0, start + 400000)});
+  EXPECT_EQ(0, manager.error_count(MockThrottleProtocolData::ID));
+}
+
 }  // namespace canbus
 }  // namespace drivers
 }  // namespace apollo
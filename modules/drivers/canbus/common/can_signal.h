@@ -0,0 +1,144 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Defines the CanSignal class template.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <ratio>
+
+/**
+ * @namespace apollo::drivers::canbus
+ * @brief apollo::drivers::canbus
+ */
+namespace apollo {
+namespace drivers {
+namespace canbus {
+
+/**
+ * @brief The byte order of a signal, @0 (motorola) or @1 (intel) in dbc.
+ */
+enum class CanByteOrder { MOTOROLA, INTEL };
+
+/**
+ * @class CanSignal
+ * @brief A signal of a CAN frame as a dbc file describes it:
+ *        SG_ name : start_bit|length@order sign (factor,offset)
+ *        The layout and the scaling are template parameters, so a decode is a
+ *        load of the 8 bytes of the frame as one word, a shift and a mask,
+ *        without branches, and the scaling is folded into constants. The
+ *        factor and the offset are ratios to be exact, e.g. std::ratio<1, 100>
+ *        for 0.01. The frame must have 8 bytes.
+ */
+template <int kStartBit, int kLength, CanByteOrder kOrder, bool kSigned,
+          typename Factor = std::ratio<1>, typename Offset = std::ratio<0>>
+class CanSignal {
+ public:
+  static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+                "the frame is loaded as a little endian word");
+  static_assert(kStartBit >= 0 && kStartBit < 64, "start bit out of frame");
+  static_assert(kLength > 0 && kLength < 64, "length out of range");
+
+  /// the position of the lowest bit of the signal in the loaded frame
+  static constexpr int kShift =
+      kOrder == CanByteOrder::INTEL
+          ? kStartBit
+          : (7 - kStartBit / 8) * 8 + kStartBit % 8 - kLength + 1;
+  static_assert(kShift >= 0 && kShift + kLength <= 64, "signal out of frame");
+
+  static constexpr uint64_t kMask = (uint64_t{1} << kLength) - 1;
+  static constexpr double kFactor =
+      static_cast<double>(Factor::num) / static_cast<double>(Factor::den);
+  static constexpr double kOffset =
+      static_cast<double>(Offset::num) / static_cast<double>(Offset::den);
+
+  /**
+   * @brief Get the raw value of the signal, sign extended if it is signed.
+   * @param bytes The 8 bytes of the frame.
+   * @return The raw value.
+   */
+  static int64_t DecodeRaw(const uint8_t *bytes) {
+    const uint64_t raw = (Load(bytes) >> kShift) & kMask;
+    if constexpr (kSigned) {
+      return static_cast<int64_t>(raw << (64 - kLength)) >> (64 - kLength);
+    } else {
+      return static_cast<int64_t>(raw);
+    }
+  }
+
+  /**
+   * @brief Get the physical value of the signal, raw * factor + offset.
+   * @param bytes The 8 bytes of the frame.
+   * @return The physical value.
+   */
+  static double Decode(const uint8_t *bytes) {
+    const double value = static_cast<double>(DecodeRaw(bytes));
+    if constexpr (std::ratio_equal<Offset, std::ratio<0>>::value) {
+      return value * kFactor;
+    } else {
+      return value * kFactor + kOffset;
+    }
+  }
+
+  /**
+   * @brief Set the raw value of the signal, and keep the other bits.
+   * @param raw The raw value, of which the bits out of the signal are
+   *        dropped.
+   * @param bytes The 8 bytes of the frame.
+   */
+  static void EncodeRaw(const int64_t raw, uint8_t *bytes) {
+    const uint64_t word = (Load(bytes) & ~(kMask << kShift)) |
+                          ((static_cast<uint64_t>(raw) & kMask) << kShift);
+    Store(word, bytes);
+  }
+
+  /**
+   * @brief Set the physical value of the signal, and keep the other bits.
+   *        The raw value (value - offset) / factor is truncated toward zero.
+   * @param value The physical value.
+   * @param bytes The 8 bytes of the frame.
+   */
+  static void Encode(const double value, uint8_t *bytes) {
+    EncodeRaw(static_cast<int64_t>((value - kOffset) / kFactor), bytes);
+  }
+
+ private:
+  static uint64_t Load(const uint8_t *bytes) {
+    uint64_t word = 0;
+    std::memcpy(&word, bytes, sizeof(word));
+    if constexpr (kOrder == CanByteOrder::MOTOROLA) {
+      return __builtin_bswap64(word);
+    } else {
+      return word;
+    }
+  }
+
+  static void Store(uint64_t word, uint8_t *bytes) {
+    if constexpr (kOrder == CanByteOrder::MOTOROLA) {
+      word = __builtin_bswap64(word);
+    }
+    std::memcpy(bytes, &word, sizeof(word));
+  }
+};
+
+}  // namespace canbus
+}  // namespace drivers
+}  // namespace apollo
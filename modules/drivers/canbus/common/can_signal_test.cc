@@ -0,0 +1,190 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/drivers/canbus/common/can_signal.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "modules/drivers/canbus/common/byte.h"
+
+namespace apollo {
+namespace drivers {
+namespace canbus {
+
+namespace {
+
+// the decode of the protocols generated by gen_vehicle_protocol, byte by byte
+// from the msb
+int64_t ByteRaw(const uint8_t *bytes, int start_bit, int length,
+                CanByteOrder order, bool is_signed) {
+  struct ByteInfo {
+    int byte;
+    int start_bit;
+    int len;
+  };
+  std::vector<ByteInfo> byte_info;
+  int byte_idx = start_bit / 8;
+  int bit_start = start_bit % 8;
+  int left_len = length;
+  while (left_len > 0) {
+    ByteInfo info;
+    info.byte = byte_idx;
+    if (order == CanByteOrder::MOTOROLA) {
+      info.len = std::min(bit_start + 1, left_len);
+      info.start_bit = bit_start - info.len + 1;
+      bit_start = 7;
+    } else {
+      info.len = std::min(8 - bit_start, left_len);
+      info.start_bit = bit_start;
+      bit_start = 0;
+    }
+    byte_info.push_back(info);
+    left_len -= info.len;
+    ++byte_idx;
+  }
+  if (order == CanByteOrder::INTEL) {
+    std::reverse(byte_info.begin(), byte_info.end());
+  }
+  int64_t x = 0;
+  for (const auto &info : byte_info) {
+    Byte t(bytes + info.byte);
+    x = (x << info.len) | t.get_byte(info.start_bit, info.len);
+  }
+  if (is_signed && (x >> (length - 1)) != 0) {
+    x -= int64_t{1} << length;
+  }
+  return x;
+}
+
+template <typename Signal>
+void ExpectSameAsBytes(int start_bit, int length, CanByteOrder order,
+                       bool is_signed) {
+  std::mt19937 gen(start_bit * 64 + length);
+  std::uniform_int_distribution<int> byte(0, 255);
+  for (int i = 0; i < 1000; ++i) {
+    uint8_t bytes[8];
+    for (auto &b : bytes) {
+      b = static_cast<uint8_t>(byte(gen));
+    }
+    const int64_t expected =
+        ByteRaw(bytes, start_bit, length, order, is_signed);
+    EXPECT_EQ(expected, Signal::DecodeRaw(bytes));
+
+    // encoding into other bytes keeps their other bits
+    uint8_t encoded[8];
+    for (auto &b : encoded) {
+      b = static_cast<uint8_t>(byte(gen));
+    }
+    uint8_t original[8];
+    std::copy(encoded, encoded + 8, original);
+    Signal::EncodeRaw(expected, encoded);
+    EXPECT_EQ(expected, Signal::DecodeRaw(encoded));
+    uint8_t mask[8] = {0};
+    Signal::EncodeRaw(-1, mask);
+    for (int j = 0; j < 8; ++j) {
+      EXPECT_EQ(original[j] & ~mask[j], encoded[j] & ~mask[j]);
+      EXPECT_EQ(bytes[j] & mask[j], encoded[j] & mask[j]);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(CanSignalTest, DecodeRawSameAsBytes) {
+  using I = CanSignal<0, 16, CanByteOrder::INTEL, true>;
+  ExpectSameAsBytes<I>(0, 16, CanByteOrder::INTEL, true);
+  using I2 = CanSignal<52, 4, CanByteOrder::INTEL, false>;
+  ExpectSameAsBytes<I2>(52, 4, CanByteOrder::INTEL, false);
+  using I3 = CanSignal<13, 19, CanByteOrder::INTEL, true>;
+  ExpectSameAsBytes<I3>(13, 19, CanByteOrder::INTEL, true);
+  using I4 = CanSignal<35, 29, CanByteOrder::INTEL, false>;
+  ExpectSameAsBytes<I4>(35, 29, CanByteOrder::INTEL, false);
+  using I5 = CanSignal<63, 1, CanByteOrder::INTEL, false>;
+  ExpectSameAsBytes<I5>(63, 1, CanByteOrder::INTEL, false);
+
+  using M = CanSignal<7, 16, CanByteOrder::MOTOROLA, false>;
+  ExpectSameAsBytes<M>(7, 16, CanByteOrder::MOTOROLA, false);
+  using M2 = CanSignal<13, 12, CanByteOrder::MOTOROLA, true>;
+  ExpectSameAsBytes<M2>(13, 12, CanByteOrder::MOTOROLA, true);
+  using M3 = CanSignal<34, 3, CanByteOrder::MOTOROLA, false>;
+  ExpectSameAsBytes<M3>(34, 3, CanByteOrder::MOTOROLA, false);
+  using M4 = CanSignal<23, 32, CanByteOrder::MOTOROLA, true>;
+  ExpectSameAsBytes<M4>(23, 32, CanByteOrder::MOTOROLA, true);
+  using M5 = CanSignal<56, 1, CanByteOrder::MOTOROLA, false>;
+  ExpectSameAsBytes<M5>(56, 1, CanByteOrder::MOTOROLA, false);
+}
+
+TEST(CanSignalTest, Scaling) {
+  // -40 degree with 0.5 per bit
+  using Temperature = CanSignal<7, 8, CanByteOrder::MOTOROLA, false,
+                                std::ratio<1, 2>, std::ratio<-40>>;
+  uint8_t bytes[8] = {0};
+  bytes[0] = 100;
+  EXPECT_DOUBLE_EQ(10.0, Temperature::Decode(bytes));
+  Temperature::Encode(-12.5, bytes);
+  EXPECT_EQ(55, bytes[0]);
+  EXPECT_DOUBLE_EQ(-12.5, Temperature::Decode(bytes));
+
+  // the same double as the decimal factor of the generated protocols
+  using Speed = CanSignal<0, 16, CanByteOrder::INTEL, true, std::ratio<1, 100>>;
+  bytes[0] = 0x39;
+  bytes[1] = 0x30;
+  EXPECT_EQ(12345 * 0.010000, Speed::Decode(bytes));
+  bytes[1] = 0xCF;
+  EXPECT_EQ(-12487 * 0.010000, Speed::Decode(bytes));
+  Speed::Encode(0.3, bytes);
+  EXPECT_EQ(30, Speed::DecodeRaw(bytes));
+  Speed::Encode(-0.3, bytes);
+  EXPECT_EQ(-30, Speed::DecodeRaw(bytes));
+}
+
+TEST(CanSignalTest, EncodeSameAsGenerated) {
+  // the encode of the protocols generated by gen_vehicle_protocol, which
+  // divides by the precision printed with %f
+  using Speed = CanSignal<0, 16, CanByteOrder::INTEL, true, std::ratio<1, 100>>;
+  using Temperature = CanSignal<7, 8, CanByteOrder::MOTOROLA, false,
+                                std::ratio<1, 2>, std::ratio<-40>>;
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> dist(-300.0, 300.0);
+  uint8_t bytes[8] = {0};
+  for (int i = -30000; i <= 30000; ++i) {
+    // the decimal boundaries, where the truncation is the most sensitive
+    const double value = i * 0.01;
+    Speed::Encode(value, bytes);
+    EXPECT_EQ(static_cast<int>(value / 0.010000), Speed::DecodeRaw(bytes))
+        << value;
+    const double random_value = dist(gen);
+    Speed::Encode(random_value, bytes);
+    EXPECT_EQ(static_cast<int>(random_value / 0.010000),
+              Speed::DecodeRaw(bytes))
+        << random_value;
+  }
+  for (int i = 0; i < 256; ++i) {
+    const double value = i * 0.5 - 40.0 + 0.25;
+    Temperature::Encode(value, bytes);
+    EXPECT_EQ(static_cast<int>((value - -40.000000) / 0.500000),
+              Temperature::DecodeRaw(bytes))
+        << value;
+  }
+}
+
+}  // namespace canbus
+}  // namespace drivers
+}  // namespace apollo
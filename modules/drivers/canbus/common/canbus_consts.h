@@ -36,6 +36,8 @@ const int32_t MAX_CAN_RECV_FRAME_LEN = 10;
 
 const int32_t CANBUS_MESSAGE_LENGTH = 8;  // according to ISO-11891-1
 
+const uint32_t MAX_STANDARD_CAN_ID = 0x7FF;
+
 }  // namespace canbus
 }  // namespace drivers
 }  // namespace apollo
@@ -36,3 +36,8 @@ DEFINE_bool(esd_can_extended_frame, false,
 
 DEFINE_bool(enable_can_err_check, false,
             "check the can id err mask");
+
+DEFINE_bool(enable_can_batch_io, false,
+            "receive and send the socket can frames in batches with "
+            "recvmmsg/sendmmsg and kernel timestamps, and parse each received "
+            "batch under one lock");
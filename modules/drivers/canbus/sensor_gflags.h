@@ -35,3 +35,5 @@ DECLARE_string(sensor_node_name);
 DECLARE_bool(esd_can_extended_frame);
 
 DECLARE_bool(enable_can_err_check);
+
+DECLARE_bool(enable_can_batch_io);
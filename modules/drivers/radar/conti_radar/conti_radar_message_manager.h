@@ -21,6 +21,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "cyber/cyber.h"
 #include "modules/drivers/canbus/can_client/can_client_factory.h"
@@ -43,6 +44,12 @@ class ContiRadarMessageManager
   apollo::drivers::canbus::ProtocolData<ContiRadar> *GetMutableProtocolDataById(
       const uint32_t message_id);
   void Parse(const uint32_t message_id, const uint8_t *data, int32_t length);
+  void ParseBatch(
+      const std::vector<apollo::drivers::canbus::CanFrame> &frames) {
+    for (const auto &frame : frames) {
+      Parse(frame.id, frame.data, frame.len);
+    }
+  }
   void set_can_client(
       std::shared_ptr<apollo::drivers::canbus::CanClient> can_client);
 
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "modules/common_msgs/sensor_msgs/nano_radar.pb.h"
 
@@ -45,6 +46,12 @@ class NanoRadarMessageManager
   apollo::drivers::canbus::ProtocolData<NanoRadar> *GetMutableProtocolDataById(
       const uint32_t message_id);
   void Parse(const uint32_t message_id, const uint8_t *data, int32_t length);
+  void ParseBatch(
+      const std::vector<apollo::drivers::canbus::CanFrame> &frames) {
+    for (const auto &frame : frames) {
+      Parse(frame.id, frame.data, frame.len);
+    }
+  }
   void set_can_client(
       std::shared_ptr<apollo::drivers::canbus::CanClient> can_client);
 
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "cyber/cyber.h"
 
@@ -54,6 +55,12 @@ class RacobitRadarMessageManager : public MessageManager<RacobitRadar> {
   ProtocolData<RacobitRadar> *GetMutableProtocolDataById(
       const uint32_t message_id);
   void Parse(const uint32_t message_id, const uint8_t *data, int32_t length);
+  void ParseBatch(
+      const std::vector<apollo::drivers::canbus::CanFrame> &frames) {
+    for (const auto &frame : frames) {
+      Parse(frame.id, frame.data, frame.len);
+    }
+  }
   void set_can_client(std::shared_ptr<CanClient> can_client);
 
  private:
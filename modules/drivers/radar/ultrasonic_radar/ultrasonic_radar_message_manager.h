@@ -21,6 +21,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "cyber/cyber.h"
 
@@ -50,6 +51,12 @@ class UltrasonicRadarMessageManager : public MessageManager<Ultrasonic> {
       const std::shared_ptr<::apollo::cyber::Writer<Ultrasonic>> &writer);
   virtual ~UltrasonicRadarMessageManager() = default;
   void Parse(const uint32_t message_id, const uint8_t *data, int32_t length);
+  void ParseBatch(
+      const std::vector<apollo::drivers::canbus::CanFrame> &frames) {
+    for (const auto &frame : frames) {
+      Parse(frame.id, frame.data, frame.len);
+    }
+  }
   void set_can_client(std::shared_ptr<CanClient> can_client);
 
  private:
@@ -39,6 +39,14 @@ JunctionInfoConstPtr HDMap::GetJunctionById(const Id& id) const {
   return impl_.GetJunctionById(id);
 }
 
+LaneInfoConstPtr HDMap::GetLaneByIndex(const int index) const {
+  return impl_.GetLaneByIndex(index);
+}
+
+JunctionInfoConstPtr HDMap::GetJunctionByIndex(const int index) const {
+  return impl_.GetJunctionByIndex(index);
+}
+
 AreaInfoConstPtr HDMap::GetAreaById(const Id& id) const {
   return impl_.GetAreaById(id);
 }
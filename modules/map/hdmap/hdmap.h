@@ -69,6 +69,18 @@ class HDMap {
 
   LaneInfoConstPtr GetLaneById(const Id& id) const;
   JunctionInfoConstPtr GetJunctionById(const Id& id) const;
+  /**
+   * @brief get lane by the dense index assigned at map load
+   * @param index index of the lane, see LaneInfo::index()
+   * @return nullptr if the index is out of range
+   */
+  LaneInfoConstPtr GetLaneByIndex(const int index) const;
+  /**
+   * @brief get junction by the dense index assigned at map load
+   * @param index index of the junction, see JunctionInfo::index()
+   * @return nullptr if the index is out of range
+   */
+  JunctionInfoConstPtr GetJunctionByIndex(const int index) const;
   SignalInfoConstPtr GetSignalById(const Id& id) const;
   CrosswalkInfoConstPtr GetCrosswalkById(const Id& id) const;
   StopSignInfoConstPtr GetStopSignById(const Id& id) const;
@@ -485,6 +485,27 @@ bool LaneInfo::GetProjection(const Vec2d &point, const double heading,
 
 void LaneInfo::PostProcess(const HDMapImpl &map_instance) {
   UpdateOverlaps(map_instance);
+  UpdateLaneIndices(map_instance);
+}
+
+void LaneInfo::UpdateLaneIndices(const HDMapImpl &map_instance) {
+  auto to_indices = [&map_instance](
+                        const google::protobuf::RepeatedPtrField<Id> &ids,
+                        std::vector<int> *const indices) {
+    indices->clear();
+    for (const auto &id : ids) {
+      const int index = map_instance.GetLaneIndex(id);
+      if (index >= 0) {
+        indices->push_back(index);
+      }
+    }
+  };
+  to_indices(lane_.predecessor_id(), &predecessor_indices_);
+  to_indices(lane_.successor_id(), &successor_indices_);
+  to_indices(lane_.left_neighbor_forward_lane_id(),
+             &left_neighbor_forward_indices_);
+  to_indices(lane_.right_neighbor_forward_lane_id(),
+             &right_neighbor_forward_indices_);
 }
 
 void LaneInfo::UpdateOverlaps(const HDMapImpl &map_instance) {
@@ -150,6 +150,11 @@ class LaneInfo {
   explicit LaneInfo(const Lane &lane);
 
   const Id &id() const { return lane_.id(); }
+  /**
+   * @brief dense index of the lane assigned at map load, -1 if the lane is
+   *        not loaded from a map
+   */
+  int index() const { return index_; }
   const Id &road_id() const { return road_id_; }
   const Id &section_id() const { return section_id_; }
   const Lane &lane() const { return lane_; }
@@ -199,6 +204,20 @@ class LaneInfo {
     return pnc_junctions_;
   }
   const std::vector<OverlapInfoConstPtr> &areas() const { return areas_; }
+  // indices of the lanes connected to this lane, in the order of their ids
+  // in the lane proto and without the ids missing from the map
+  const std::vector<int> &predecessor_indices() const {
+    return predecessor_indices_;
+  }
+  const std::vector<int> &successor_indices() const {
+    return successor_indices_;
+  }
+  const std::vector<int> &left_neighbor_forward_indices() const {
+    return left_neighbor_forward_indices_;
+  }
+  const std::vector<int> &right_neighbor_forward_indices() const {
+    return right_neighbor_forward_indices_;
+  }
   double total_length() const { return total_length_; }
   using SampledWidth = std::pair<double, double>;
   const std::vector<SampledWidth> &sampled_left_width() const {
@@ -243,14 +262,21 @@ class LaneInfo {
   void Init();
   void PostProcess(const HDMapImpl &map_instance);
   void UpdateOverlaps(const HDMapImpl &map_instance);
+  void UpdateLaneIndices(const HDMapImpl &map_instance);
   double GetWidthFromSample(const std::vector<LaneInfo::SampledWidth> &samples,
                             const double s) const;
   void CreateKDTree();
   void set_road_id(const Id &road_id) { road_id_ = road_id; }
   void set_section_id(const Id &section_id) { section_id_ = section_id; }
+  void set_index(const int index) { index_ = index; }
 
  private:
   const Lane &lane_;
+  int index_ = -1;
+  std::vector<int> predecessor_indices_;
+  std::vector<int> successor_indices_;
+  std::vector<int> left_neighbor_forward_indices_;
+  std::vector<int> right_neighbor_forward_indices_;
   std::vector<apollo::common::math::Vec2d> points_;
   std::vector<apollo::common::math::Vec2d> unit_directions_;
   std::vector<double> headings_;
@@ -289,6 +315,11 @@ class JunctionInfo {
   explicit JunctionInfo(const Junction &junction);
 
   const Id &id() const { return junction_.id(); }
+  /**
+   * @brief dense index of the junction assigned at map load, -1 if the
+   *        junction is not loaded from a map
+   */
+  int index() const { return index_; }
   const Junction &junction() const { return junction_; }
   const apollo::common::math::Polygon2d &polygon() const { return polygon_; }
 
@@ -301,9 +332,11 @@ class JunctionInfo {
   void Init();
   void PostProcess(const HDMapImpl &map_instance);
   void UpdateOverlaps(const HDMapImpl &map_instance);
+  void set_index(const int index) { index_ = index; }
 
  private:
   const Junction &junction_;
+  int index_ = -1;
   apollo::common::math::Polygon2d polygon_;
 
   std::vector<Id> overlap_stop_sign_ids_;
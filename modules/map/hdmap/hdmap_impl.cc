@@ -149,6 +149,7 @@ int HDMapImpl::LoadMapFromProto(const Map& map_proto) {
       }
     }
   }
+  BuildLaneIndices();
   for (const auto& lane_ptr_pair : lane_table_) {
     lane_ptr_pair.second->PostProcess(*this);
   }
@@ -187,6 +188,19 @@ JunctionInfoConstPtr HDMapImpl::GetJunctionById(const Id& id) const {
   return it != junction_table_.end() ? it->second : nullptr;
 }
 
+LaneInfoConstPtr HDMapImpl::GetLaneByIndex(const int index) const {
+  return index >= 0 && index < NumLanes() ? lanes_[index] : nullptr;
+}
+
+JunctionInfoConstPtr HDMapImpl::GetJunctionByIndex(const int index) const {
+  return index >= 0 && index < NumJunctions() ? junctions_[index] : nullptr;
+}
+
+int HDMapImpl::GetLaneIndex(const Id& id) const {
+  LaneTable::const_iterator it = lane_table_.find(id.id());
+  return it != lane_table_.end() ? it->second->index() : -1;
+}
+
 AreaInfoConstPtr HDMapImpl::GetAreaById(const Id& id) const {
   AreaTable::const_iterator it = area_table_.find(id.id());
   return it != area_table_.end() ? it->second : nullptr;
@@ -1681,10 +1695,33 @@ int HDMapImpl::SearchObjects(const Vec2d& center, const double radius,
   return 0;
 }
 
+void HDMapImpl::BuildLaneIndices() {
+  // Indices follow the order of the map proto, so that they are the same
+  // every time the map is loaded.
+  lanes_.clear();
+  for (const auto& lane : map_.lane()) {
+    auto& lane_ptr = lane_table_[lane.id().id()];
+    if (lane_ptr->index() < 0) {
+      lane_ptr->set_index(static_cast<int>(lanes_.size()));
+      lanes_.push_back(lane_ptr);
+    }
+  }
+  junctions_.clear();
+  for (const auto& junction : map_.junction()) {
+    auto& junction_ptr = junction_table_[junction.id().id()];
+    if (junction_ptr->index() < 0) {
+      junction_ptr->set_index(static_cast<int>(junctions_.size()));
+      junctions_.push_back(junction_ptr);
+    }
+  }
+}
+
 void HDMapImpl::Clear() {
   map_.Clear();
   lane_table_.clear();
   junction_table_.clear();
+  lanes_.clear();
+  junctions_.clear();
   area_table_.clear();
   signal_table_.clear();
   barrier_gate_table_.clear();
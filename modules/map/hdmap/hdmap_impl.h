@@ -102,6 +102,26 @@ class HDMapImpl {
 
   LaneInfoConstPtr GetLaneById(const Id& id) const;
   JunctionInfoConstPtr GetJunctionById(const Id& id) const;
+  /**
+   * @brief get lane by its dense index, see LaneInfo::index()
+   * @param index index of the lane
+   * @return nullptr if the index is out of range
+   */
+  LaneInfoConstPtr GetLaneByIndex(const int index) const;
+  /**
+   * @brief get junction by its dense index, see JunctionInfo::index()
+   * @param index index of the junction
+   * @return nullptr if the index is out of range
+   */
+  JunctionInfoConstPtr GetJunctionByIndex(const int index) const;
+  /**
+   * @brief get the dense index of a lane
+   * @param id lane id
+   * @return -1 if there is no such lane
+   */
+  int GetLaneIndex(const Id& id) const;
+  int NumLanes() const { return static_cast<int>(lanes_.size()); }
+  int NumJunctions() const { return static_cast<int>(junctions_.size()); }
   SignalInfoConstPtr GetSignalById(const Id& id) const;
   CrosswalkInfoConstPtr GetCrosswalkById(const Id& id) const;
   StopSignInfoConstPtr GetStopSignById(const Id& id) const;
@@ -479,10 +499,15 @@ class HDMapImpl {
 
   void Clear();
 
+  void BuildLaneIndices();
+
  private:
   Map map_;
   LaneTable lane_table_;
   JunctionTable junction_table_;
+  // lanes and junctions by their dense indices
+  std::vector<std::shared_ptr<LaneInfo>> lanes_;
+  std::vector<std::shared_ptr<JunctionInfo>> junctions_;
   AreaTable area_table_;
   CrosswalkTable crosswalk_table_;
   SignalTable signal_table_;
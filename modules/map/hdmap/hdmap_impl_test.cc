@@ -53,6 +53,42 @@ TEST_F(HDMapImplTestSuite, GetLaneById) {
   EXPECT_STREQ(lane_id.id().c_str(), lane_ptr->id().id().c_str());
 }
 
+TEST_F(HDMapImplTestSuite, GetLaneByIndex) {
+  EXPECT_EQ(nullptr, hdmap_impl_.GetLaneByIndex(-1));
+  EXPECT_EQ(nullptr, hdmap_impl_.GetLaneByIndex(hdmap_impl_.NumLanes()));
+  Id lane_id;
+  lane_id.set_id("1");
+  EXPECT_EQ(-1, hdmap_impl_.GetLaneIndex(lane_id));
+  lane_id.set_id("1272_1_-1");
+  LaneInfoConstPtr lane_ptr = hdmap_impl_.GetLaneById(lane_id);
+  ASSERT_NE(nullptr, lane_ptr);
+  EXPECT_EQ(lane_ptr->index(), hdmap_impl_.GetLaneIndex(lane_id));
+  EXPECT_EQ(lane_ptr, hdmap_impl_.GetLaneByIndex(lane_ptr->index()));
+
+  for (int i = 0; i < hdmap_impl_.NumLanes(); ++i) {
+    LaneInfoConstPtr lane = hdmap_impl_.GetLaneByIndex(i);
+    ASSERT_NE(nullptr, lane);
+    EXPECT_EQ(i, lane->index());
+    EXPECT_EQ(lane, hdmap_impl_.GetLaneById(lane->id()));
+    ASSERT_EQ(lane->lane().successor_id_size(),
+              lane->successor_indices().size());
+    for (int j = 0; j < lane->lane().successor_id_size(); ++j) {
+      EXPECT_EQ(lane->lane().successor_id(j).id(),
+                hdmap_impl_.GetLaneByIndex(lane->successor_indices()[j])
+                    ->id()
+                    .id());
+    }
+    ASSERT_EQ(lane->lane().predecessor_id_size(),
+              lane->predecessor_indices().size());
+    for (int j = 0; j < lane->lane().predecessor_id_size(); ++j) {
+      EXPECT_EQ(lane->lane().predecessor_id(j).id(),
+                hdmap_impl_.GetLaneByIndex(lane->predecessor_indices()[j])
+                    ->id()
+                    .id());
+    }
+  }
+}
+
 TEST_F(HDMapImplTestSuite, GetJunctionById) {
   Id junction_id;
   junction_id.set_id("1");
@@ -24,6 +24,7 @@
 #include "absl/strings/str_join.h"
 
 #include "cyber/common/log.h"
+#include "modules/common/math/aabox2d.h"
 #include "modules/common/math/line_segment2d.h"
 #include "modules/common/math/math_utils.h"
 #include "modules/common/math/polygon2d.h"
@@ -32,6 +33,7 @@
 namespace apollo {
 namespace hdmap {
 
+using apollo::common::math::AABox2d;
 using apollo::common::math::Box2d;
 using apollo::common::math::kMathEpsilon;
 using apollo::common::math::LineSegment2d;
@@ -43,6 +45,8 @@ using std::placeholders::_1;
 namespace {
 
 const double kSampleDistance = 0.25;
+// Number of segments in a block of the nearest segment search.
+const int kSegmentBlockSize = 16;
 
 bool FindLaneSegment(const MapPathPoint& p1, const MapPathPoint& p2,
                      LaneSegment* const lane_segment) {
@@ -397,6 +401,27 @@ void Path::InitPoints() {
   CHECK_EQ(accumulated_s_.size(), static_cast<size_t>(num_points_));
   CHECK_EQ(unit_directions_.size(), static_cast<size_t>(num_points_));
   CHECK_EQ(segments_.size(), static_cast<size_t>(num_segments_));
+  InitSegmentBlocks();
+}
+
+void Path::InitSegmentBlocks() {
+  segment_block_centers_.clear();
+  segment_block_radii_.clear();
+  for (int start = 0; start < num_segments_; start += kSegmentBlockSize) {
+    const int end = std::min(num_segments_, start + kSegmentBlockSize);
+    // The segments are within the bounding circle of their end points.
+    AABox2d box(path_points_[start], path_points_[start + 1]);
+    for (int i = start + 2; i <= end; ++i) {
+      box.MergeFrom(path_points_[i]);
+    }
+    double radius = 0.0;
+    for (int i = start; i <= end; ++i) {
+      radius = std::max(radius, box.center().DistanceTo(path_points_[i]));
+    }
+    segment_block_centers_.push_back(box.center());
+    // Enlarge a little for the rounding errors.
+    segment_block_radii_.push_back(radius + kMathEpsilon);
+  }
 }
 
 void Path::InitLaneSegments() {
@@ -880,6 +905,76 @@ bool Path::GetProjection(const Vec2d& point, double* accumulate_s,
     }
   }
   *min_distance = std::sqrt(*min_distance);
+  GetProjectionOnSegment(point, min_index, *min_distance, accumulate_s,
+                         lateral);
+  return true;
+}
+
+bool Path::GetProjections(const std::vector<Vec2d>& points,
+                          std::vector<double>* accumulate_s,
+                          std::vector<double>* lateral) const {
+  if (segments_.empty()) {
+    return false;
+  }
+  if (accumulate_s == nullptr || lateral == nullptr) {
+    return false;
+  }
+  accumulate_s->resize(points.size());
+  lateral->resize(points.size());
+  if (use_path_approximation_) {
+    double min_distance = 0.0;
+    for (size_t i = 0; i < points.size(); ++i) {
+      if (!approximation_.GetProjection(*this, points[i], &(*accumulate_s)[i],
+                                        &(*lateral)[i], &min_distance)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  CHECK_GE(num_points_, 2);
+  int min_index = 0;
+  for (size_t i = 0; i < points.size(); ++i) {
+    double min_distance = 0.0;
+    min_index = FindNearestSegment(points[i], min_index, &min_distance);
+    GetProjectionOnSegment(points[i], min_index, min_distance,
+                           &(*accumulate_s)[i], &(*lateral)[i]);
+  }
+  return true;
+}
+
+int Path::FindNearestSegment(const Vec2d& point, const int hint_index,
+                             double* min_distance) const {
+  int min_index = hint_index;
+  double min_distance_sqr = segments_[hint_index].DistanceSquareTo(point);
+  const int num_blocks = static_cast<int>(segment_block_centers_.size());
+  for (int block = 0; block < num_blocks; ++block) {
+    // Skip the blocks which are farther than the nearest segment so far.
+    const double lower_bound =
+        point.DistanceTo(segment_block_centers_[block]) -
+        segment_block_radii_[block];
+    if (lower_bound > 0.0 && lower_bound * lower_bound > min_distance_sqr) {
+      continue;
+    }
+    const int end_index =
+        std::min(num_segments_, (block + 1) * kSegmentBlockSize);
+    for (int i = block * kSegmentBlockSize; i < end_index; ++i) {
+      const double distance = segments_[i].DistanceSquareTo(point);
+      // Take the first one of the nearest segments, as the full search does.
+      if (distance < min_distance_sqr ||
+          (distance == min_distance_sqr && i < min_index)) {
+        min_index = i;
+        min_distance_sqr = distance;
+      }
+    }
+  }
+  *min_distance = std::sqrt(min_distance_sqr);
+  return min_index;
+}
+
+void Path::GetProjectionOnSegment(const Vec2d& point, const int min_index,
+                                  const double min_distance,
+                                  double* accumulate_s,
+                                  double* lateral) const {
   const auto& nearest_seg = segments_[min_index];
   const auto prod = nearest_seg.ProductOntoUnit(point);
   const auto proj = nearest_seg.ProjectOntoUnit(point);
@@ -888,21 +983,20 @@ bool Path::GetProjection(const Vec2d& point, double* accumulate_s,
     if (proj < 0) {
       *lateral = prod;
     } else {
-      *lateral = (prod > 0.0 ? 1 : -1) * *min_distance;
+      *lateral = (prod > 0.0 ? 1 : -1) * min_distance;
     }
   } else if (min_index == num_segments_ - 1) {
     *accumulate_s = accumulated_s_[min_index] + std::max(0.0, proj);
     if (proj > 0) {
       *lateral = prod;
     } else {
-      *lateral = (prod > 0.0 ? 1 : -1) * *min_distance;
+      *lateral = (prod > 0.0 ? 1 : -1) * min_distance;
     }
   } else {
     *accumulate_s = accumulated_s_[min_index] +
                     std::max(0.0, std::min(proj, nearest_seg.length()));
-    *lateral = (prod > 0.0 ? 1 : -1) * *min_distance;
+    *lateral = (prod > 0.0 ? 1 : -1) * min_distance;
   }
-  return true;
 }
 
 bool Path::GetProjection(const Vec2d& point, const double heading,
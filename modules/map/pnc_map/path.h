@@ -271,6 +271,14 @@ class Path {
                      double* accumulate_s, double* lateral,
                      double* distance) const;
 
+  // Batch version of GetProjection(point, accumulate_s, lateral), gives the
+  // same results as projecting the points one by one. The nearest segment
+  // of the previous point bounds the search of the next one, so the far away
+  // segment blocks are skipped for the points close to each other.
+  bool GetProjections(const std::vector<common::math::Vec2d>& points,
+                      std::vector<double>* accumulate_s,
+                      std::vector<double>* lateral) const;
+
   bool GetHeadingAlongPath(const common::math::Vec2d& point,
                            double* heading) const;
 
@@ -357,6 +365,16 @@ class Path {
 
   double GetSample(const std::vector<double>& samples, const double s) const;
 
+  void InitSegmentBlocks();
+  // Find the nearest segment to the point, with the segment "hint_index" as
+  // the initial guess.
+  int FindNearestSegment(const common::math::Vec2d& point,
+                         const int hint_index, double* min_distance) const;
+  // Compute the projection onto the nearest segment.
+  void GetProjectionOnSegment(const common::math::Vec2d& point,
+                              const int min_index, const double min_distance,
+                              double* accumulate_s, double* lateral) const;
+
   using GetOverlapFromLaneFunc =
       std::function<const std::vector<OverlapInfoConstPtr>&(const LaneInfo&)>;
   void GetAllOverlaps(GetOverlapFromLaneFunc GetOverlaps_from_lane,
@@ -373,6 +391,9 @@ class Path {
   double length_ = 0.0;
   std::vector<double> accumulated_s_;
   std::vector<common::math::LineSegment2d> segments_;
+  // Bounding circles of every kSegmentBlockSize consecutive segments.
+  std::vector<common::math::Vec2d> segment_block_centers_;
+  std::vector<double> segment_block_radii_;
   bool use_path_approximation_ = false;
   PathApproximation approximation_;
 
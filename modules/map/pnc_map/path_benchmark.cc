@@ -0,0 +1,118 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// XY to SL projection of the points along a 500m curvy reference path, one
+// by one against in a batch. The points are sampled around the path like a
+// planned path or the corners of the obstacles on the road.
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "modules/map/pnc_map/path.h"
+
+namespace apollo {
+namespace hdmap {
+namespace {
+
+constexpr double kPathLength = 500.0;
+constexpr double kResolution = 0.5;
+
+class PathFixture {
+ public:
+  static PathFixture* Instance() {
+    static PathFixture* instance = new PathFixture();
+    return instance;
+  }
+
+  const Path& path() const { return *path_; }
+  const std::vector<common::math::Vec2d>& points() const { return points_; }
+
+ private:
+  PathFixture() {
+    Lane lane;
+    lane.mutable_id()->set_id("lane");
+    auto* line_segment =
+        lane.mutable_central_curve()->add_segment()->mutable_line_segment();
+    for (double s = 0.0; s <= kPathLength; s += kResolution) {
+      auto* point = line_segment->add_point();
+      point->set_x(s);
+      point->set_y(20.0 * std::sin(s / 50.0));
+    }
+    auto* left_sample = lane.add_left_sample();
+    left_sample->set_s(0.0);
+    left_sample->set_width(1.75);
+    auto* right_sample = lane.add_right_sample();
+    right_sample->set_s(0.0);
+    right_sample->set_width(1.75);
+    lane_info_.reset(new LaneInfo(lane));
+
+    std::vector<MapPathPoint> path_points;
+    for (size_t i = 0; i < lane_info_->points().size(); ++i) {
+      path_points.emplace_back(
+          lane_info_->points()[i], lane_info_->headings()[i],
+          LaneWaypoint(lane_info_, lane_info_->accumulate_s()[i]));
+    }
+    path_.reset(new Path(std::move(path_points)));
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> offset(-5.0, 5.0);
+    for (double s = 0.0; s < kPathLength; s += 1.0) {
+      const auto point = path_->GetSmoothPoint(s);
+      points_.emplace_back(point.x() + offset(rng), point.y() + offset(rng));
+    }
+  }
+
+  LaneInfoConstPtr lane_info_;
+  std::unique_ptr<Path> path_;
+  std::vector<common::math::Vec2d> points_;
+};
+
+void BM_GetProjection(benchmark::State& state) {  // NOLINT
+  const auto* fixture = PathFixture::Instance();
+  std::vector<double> accumulate_s(fixture->points().size());
+  std::vector<double> lateral(fixture->points().size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < fixture->points().size(); ++i) {
+      fixture->path().GetProjection(fixture->points()[i], &accumulate_s[i],
+                                    &lateral[i]);
+    }
+    benchmark::DoNotOptimize(accumulate_s.data());
+  }
+}
+
+void BM_GetProjections(benchmark::State& state) {  // NOLINT
+  const auto* fixture = PathFixture::Instance();
+  std::vector<double> accumulate_s;
+  std::vector<double> lateral;
+  for (auto _ : state) {
+    fixture->path().GetProjections(fixture->points(), &accumulate_s,
+                                   &lateral);
+    benchmark::DoNotOptimize(accumulate_s.data());
+  }
+}
+
+BENCHMARK(BM_GetProjection)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_GetProjections)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace hdmap
+}  // namespace apollo
+
+BENCHMARK_MAIN();
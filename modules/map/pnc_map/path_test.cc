@@ -648,6 +648,75 @@ TEST(TestSuite, hdmap_s_path) {
   }
 }
 
+TEST(TestSuite, hdmap_path_get_projections) {
+  const double kRadius = 50.0;
+  const int kNumSegments = 200;
+  Lane lane;
+  lane.mutable_id()->set_id("id");
+  auto* line_segment =
+      lane.mutable_central_curve()->add_segment()->mutable_line_segment();
+  for (int i = 0; i <= kNumSegments; ++i) {
+    if (i <= kNumSegments / 2) {
+      const double p = -M_PI_2 + 2.0 * M_PI * static_cast<double>(i) /
+                                     static_cast<double>(kNumSegments);
+      *line_segment->add_point() =
+          MakePoint(kRadius * cos(p), kRadius * (sin(p) - 1.0), 0);
+    } else {
+      const double p = M_PI_2 - 2.0 * M_PI * static_cast<double>(i) /
+                                    static_cast<double>(kNumSegments);
+      *line_segment->add_point() =
+          MakePoint(kRadius * cos(p), kRadius * (sin(p) + 1.0), 0);
+    }
+  }
+  *lane.add_left_sample() = MakeSample(0.0, 2.0);
+  *lane.add_right_sample() = MakeSample(0.0, 2.0);
+  LaneInfoConstPtr lane_info(new LaneInfo(lane));
+
+  std::vector<MapPathPoint> points;
+  for (int i = 0; i <= kNumSegments; ++i) {
+    points.emplace_back(lane_info->points()[i], 0.0,
+                        LaneWaypoint(lane_info, lane_info->accumulate_s()[i]));
+  }
+  // scattered points, and points moving along the path like the corners of
+  // the obstacles
+  std::vector<Vec2d> query_points;
+  for (int i = 0; i < 2000; ++i) {
+    query_points.emplace_back(RandomDouble(-kRadius * 1.5, kRadius * 1.5),
+                              RandomDouble(-kRadius * 2.5, kRadius * 2.5));
+  }
+  for (int i = 0; i < kNumSegments; ++i) {
+    const Vec2d center = (points[i] + points[i + 1]) * 0.5;
+    for (int j = 0; j < 4; ++j) {
+      query_points.emplace_back(center.x() + RandomDouble(-3.0, 3.0),
+                                center.y() + RandomDouble(-3.0, 3.0));
+    }
+  }
+
+  const Path path(points, {});
+  const Path path_approximation(points, {}, 2.0);
+  for (const Path* p : {&path, &path_approximation}) {
+    std::vector<double> accumulate_s;
+    std::vector<double> lateral;
+    EXPECT_TRUE(p->GetProjections(query_points, &accumulate_s, &lateral));
+    ASSERT_EQ(accumulate_s.size(), query_points.size());
+    ASSERT_EQ(lateral.size(), query_points.size());
+    for (size_t i = 0; i < query_points.size(); ++i) {
+      double expected_s = 0.0;
+      double expected_l = 0.0;
+      EXPECT_TRUE(
+          p->GetProjection(query_points[i], &expected_s, &expected_l));
+      EXPECT_EQ(expected_s, accumulate_s[i]);
+      EXPECT_EQ(expected_l, lateral[i]);
+    }
+  }
+
+  std::vector<double> accumulate_s;
+  std::vector<double> lateral;
+  EXPECT_TRUE(path.GetProjections({}, &accumulate_s, &lateral));
+  EXPECT_TRUE(accumulate_s.empty());
+  EXPECT_FALSE(path.GetProjections(query_points, nullptr, &lateral));
+}
+
 TEST(TestSuite, hdmap_path_get_smooth_point) {
   const double kRadius = 50.0;
   const int kNumSegments = 100;
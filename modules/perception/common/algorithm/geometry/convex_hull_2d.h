@@ -17,7 +17,6 @@
 
 #include <algorithm>
 #include <limits>
-#include <numeric>
 #include <vector>
 
 #include "Eigen/Dense"
@@ -185,17 +184,16 @@ bool ConvexHull2D<CLOUD_IN_TYPE, CLOUD_OUT_TYPE>::GetConvexHullMonotoneChain(
     return false;
   }
 
-  std::vector<std::size_t> sorted_indices(points_.size());
-  std::iota(sorted_indices.begin(), sorted_indices.end(), 0);
-
+  // sort the points themselves instead of their indices, which is the same
+  // order with contiguous accesses and no buffer to allocate
   static const double eps = 1e-9;
-  std::sort(sorted_indices.begin(), sorted_indices.end(),
-            [&](const std::size_t& lhs, const std::size_t& rhs) {
-              double dx = points_[lhs](0) - points_[rhs](0);
+  std::sort(points_.begin(), points_.end(),
+            [](const Eigen::Vector2d& lhs, const Eigen::Vector2d& rhs) {
+              double dx = lhs(0) - rhs(0);
               if (std::abs(dx) > eps) {
                 return dx < 0.0;
               }
-              return points_[lhs](1) < points_[rhs](1);
+              return lhs(1) < rhs(1);
             });
   int count = 0;
   int last_count = 1;
@@ -207,8 +205,7 @@ bool ConvexHull2D<CLOUD_IN_TYPE, CLOUD_OUT_TYPE>::GetConvexHullMonotoneChain(
     if (i == points_.size()) {
       last_count = count;
     }
-    const std::size_t& idx =
-        sorted_indices[(i < points_.size()) ? i : (size2 - 1 - i)];
+    const std::size_t idx = (i < points_.size()) ? i : (size2 - 1 - i);
     const auto& point = points_[idx];
     while (count > last_count &&
            !IsCounterClockWise(points_[polygon_indices_[count - 2]],
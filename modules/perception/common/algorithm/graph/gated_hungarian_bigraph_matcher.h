@@ -18,14 +18,17 @@
 
 #include <algorithm>
 #include <functional>
+#include <future>
 #include <map>
 #include <utility>
 #include <vector>
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 
 #include "modules/perception/common/algorithm/graph/connected_component_analysis.h"
 #include "modules/perception/common/algorithm/graph/hungarian_optimizer.h"
+#include "modules/perception/common/algorithm/graph/sparse_assignment_optimizer.h"
 
 namespace apollo {
 namespace perception {
@@ -52,6 +55,19 @@ class GatedHungarianMatcher {
   const SecureMat<T>& global_costs() const { return global_costs_; }
   SecureMat<T>* mutable_global_costs() { return &global_costs_; }
 
+  /* @brief: connected components with at least sparse_component_size rows
+   * or cols are optimized on their gated edges only, instead of the dense
+   * hungarian method on their local costs. 0 optimizes all of them densely.
+   * The assignments are the same, up to ties of the total cost. */
+  void set_sparse_component_size(size_t sparse_component_size) {
+    sparse_component_size_ = sparse_component_size;
+  }
+
+  /* @brief: the sparse components are optimized on num_threads threads */
+  void set_num_threads(size_t num_threads) {
+    num_threads_ = std::max(num_threads, static_cast<size_t>(1));
+  }
+
   void Match(T cost_thresh, OptimizeFlag opt_flag,
              std::vector<std::pair<size_t, size_t>>* assignments,
              std::vector<size_t>* unassigned_rows,
@@ -73,12 +89,27 @@ class GatedHungarianMatcher {
    * small sub-parts. */
   void ComputeConnectedComponents(
       std::vector<std::vector<size_t>>* row_components,
-      std::vector<std::vector<size_t>>* col_components) const;
+      std::vector<std::vector<size_t>>* col_components);
 
   /* Step 3:
    * optimize single connected component, which is part of the global one */
-  void OptimizeConnectedComponent(const std::vector<size_t>& row_component,
-                                  const std::vector<size_t>& col_component);
+  void OptimizeConnectedComponent(
+      const std::vector<size_t>& row_component,
+      const std::vector<size_t>& col_component,
+      std::vector<std::pair<size_t, size_t>>* assignments);
+
+  /* optimize the connected components, the large ones on their gated edges
+   * and in parallel, appending the assignments in the order of components */
+  void OptimizeConnectedComponents(
+      const std::vector<std::vector<size_t>>& row_components,
+      const std::vector<std::vector<size_t>>& col_components);
+
+  /* optimize single connected component on its gated edges only */
+  void OptimizeSparseConnectedComponent(
+      const std::vector<size_t>& row_component,
+      const std::vector<size_t>& col_component,
+      SparseAssignmentOptimizer<T>* optimizer,
+      std::vector<std::pair<size_t, size_t>>* assignments) const;
 
   /* Step 4:
    * generate the set of unassigned row or col index. */
@@ -103,6 +134,16 @@ class GatedHungarianMatcher {
   /* global costs matrix */
   SecureMat<T> global_costs_;
 
+  /* sparse optimization of the large components */
+  size_t sparse_component_size_ = 0;
+  size_t num_threads_ = 1;
+  SparseAssignmentOptimizer<T> sparse_optimizer_;
+
+  /* gated neighbors of rows and cols, cols after rows */
+  std::vector<std::vector<int>> nb_graph_;
+  /* index of each col in its component */
+  std::vector<size_t> local_col_indices_;
+
   /* input data */
   T cost_thresh_ = 0.0;
   T bound_value_ = 0.0;
@@ -156,8 +197,13 @@ void GatedHungarianMatcher<T>::Match(
   /* compute assignments */
   assignments_ptr_->clear();
   assignments_ptr_->reserve(std::max(rows_num_, cols_num_));
-  for (size_t i = 0; i < row_components.size(); ++i) {
-    this->OptimizeConnectedComponent(row_components[i], col_components[i]);
+  if (sparse_component_size_ > 0) {
+    this->OptimizeConnectedComponents(row_components, col_components);
+  } else {
+    for (size_t i = 0; i < row_components.size(); ++i) {
+      this->OptimizeConnectedComponent(row_components[i], col_components[i],
+                                       assignments_ptr_);
+    }
   }
 
   this->GenerateUnassignedData(unassigned_rows, unassigned_cols);
@@ -186,23 +232,29 @@ void GatedHungarianMatcher<T>::MatchInit() {
 template <typename T>
 void GatedHungarianMatcher<T>::ComputeConnectedComponents(
     std::vector<std::vector<size_t>>* row_components,
-    std::vector<std::vector<size_t>>* col_components) const {
+    std::vector<std::vector<size_t>>* col_components) {
   CHECK_NOTNULL(row_components);
   CHECK_NOTNULL(col_components);
 
-  std::vector<std::vector<int>> nb_graph;
-  nb_graph.resize(rows_num_ + cols_num_);
-  for (size_t i = 0; i < rows_num_; ++i) {
-    for (size_t j = 0; j < cols_num_; ++j) {
-      if (is_valid_cost_(global_costs_(i, j))) {
-        nb_graph[i].push_back(static_cast<int>(rows_num_) + j);
-        nb_graph[j + rows_num_].push_back(i);
+  nb_graph_.resize(rows_num_ + cols_num_);
+  for (auto& neighbors : nb_graph_) {
+    neighbors.clear();
+  }
+  /* scan the column major costs along the columns, which gives the same
+   * neighbors in the same order */
+  const bool minimize = opt_flag_ == OptimizeFlag::OPTMIN;
+  for (size_t j = 0; j < cols_num_; ++j) {
+    for (size_t i = 0; i < rows_num_; ++i) {
+      const T cost = global_costs_(i, j);
+      if (minimize ? cost_thresh_ > cost : cost_thresh_ < cost) {
+        nb_graph_[i].push_back(static_cast<int>(rows_num_) + j);
+        nb_graph_[j + rows_num_].push_back(i);
       }
     }
   }
 
   std::vector<std::vector<int>> components;
-  ConnectedComponentAnalysis(nb_graph, &components);
+  ConnectedComponentAnalysis(nb_graph_, &components);
   row_components->clear();
   row_components->resize(components.size());
   col_components->clear();
@@ -223,7 +275,8 @@ void GatedHungarianMatcher<T>::ComputeConnectedComponents(
 template <typename T>
 void GatedHungarianMatcher<T>::OptimizeConnectedComponent(
     const std::vector<size_t>& row_component,
-    const std::vector<size_t>& col_component) {
+    const std::vector<size_t>& col_component,
+    std::vector<std::pair<size_t, size_t>>* assignments) {
   size_t local_rows_num = row_component.size();
   size_t local_cols_num = col_component.size();
 
@@ -236,7 +289,7 @@ void GatedHungarianMatcher<T>::OptimizeConnectedComponent(
     size_t idx_r = row_component[0];
     size_t idx_c = col_component[0];
     if (is_valid_cost_(global_costs_(idx_r, idx_c))) {
-      assignments_ptr_->push_back(std::make_pair(idx_r, idx_c));
+      assignments->push_back(std::make_pair(idx_r, idx_c));
     }
     return;
   }
@@ -256,7 +309,96 @@ void GatedHungarianMatcher<T>::OptimizeConnectedComponent(
     if (!is_valid_cost_(global_costs_(global_row_idx, global_col_idx))) {
       continue;
     }
-    assignments_ptr_->push_back(std::make_pair(global_row_idx, global_col_idx));
+    assignments->push_back(std::make_pair(global_row_idx, global_col_idx));
+  }
+}
+
+template <typename T>
+void GatedHungarianMatcher<T>::OptimizeConnectedComponents(
+    const std::vector<std::vector<size_t>>& row_components,
+    const std::vector<std::vector<size_t>>& col_components) {
+  local_col_indices_.resize(cols_num_);
+  std::vector<size_t> sparse_components;
+  for (size_t i = 0; i < row_components.size(); ++i) {
+    if (std::max(row_components[i].size(), col_components[i].size()) >=
+        sparse_component_size_) {
+      sparse_components.push_back(i);
+      for (size_t j = 0; j < col_components[i].size(); ++j) {
+        local_col_indices_[col_components[i][j]] = j;
+      }
+    }
+  }
+
+  std::vector<std::vector<std::pair<size_t, size_t>>> sparse_assignments(
+      sparse_components.size());
+  const size_t num_threads = std::min(num_threads_, sparse_components.size());
+  if (num_threads > 1) {
+    std::vector<std::future<void>> results;
+    for (size_t t = 0; t < num_threads; ++t) {
+      results.push_back(cyber::Async([&, t, num_threads]() {
+        SparseAssignmentOptimizer<T> optimizer;
+        for (size_t k = t; k < sparse_components.size(); k += num_threads) {
+          OptimizeSparseConnectedComponent(
+              row_components[sparse_components[k]],
+              col_components[sparse_components[k]], &optimizer,
+              &sparse_assignments[k]);
+        }
+      }));
+    }
+    for (auto& result : results) {
+      result.get();
+    }
+  } else {
+    for (size_t k = 0; k < sparse_components.size(); ++k) {
+      OptimizeSparseConnectedComponent(row_components[sparse_components[k]],
+                                       col_components[sparse_components[k]],
+                                       &sparse_optimizer_,
+                                       &sparse_assignments[k]);
+    }
+  }
+
+  size_t k = 0;
+  for (size_t i = 0; i < row_components.size(); ++i) {
+    if (k < sparse_components.size() && sparse_components[k] == i) {
+      assignments_ptr_->insert(assignments_ptr_->end(),
+                               sparse_assignments[k].begin(),
+                               sparse_assignments[k].end());
+      ++k;
+    } else {
+      this->OptimizeConnectedComponent(row_components[i], col_components[i],
+                                       assignments_ptr_);
+    }
+  }
+}
+
+template <typename T>
+void GatedHungarianMatcher<T>::OptimizeSparseConnectedComponent(
+    const std::vector<size_t>& row_component,
+    const std::vector<size_t>& col_component,
+    SparseAssignmentOptimizer<T>* optimizer,
+    std::vector<std::pair<size_t, size_t>>* assignments) const {
+  /* the gain of a valid pair over the bound value the dense method assigns
+   * to the invalid ones, as a negative weight to minimize */
+  const T sign = opt_flag_ == OptimizeFlag::OPTMAX ? static_cast<T>(1)
+                                                   : static_cast<T>(-1);
+  std::vector<std::vector<typename SparseAssignmentOptimizer<T>::Edge>>
+      row_edges(row_component.size());
+  for (size_t i = 0; i < row_component.size(); ++i) {
+    const size_t row = row_component[i];
+    for (const int nb : nb_graph_[row]) {
+      const size_t col = static_cast<size_t>(nb) - rows_num_;
+      row_edges[i].emplace_back(
+          local_col_indices_[col],
+          sign * (bound_value_ - global_costs_(row, col)));
+    }
+  }
+
+  std::vector<std::pair<size_t, size_t>> local_assignments;
+  optimizer->Minimize(col_component.size(), row_edges, &local_assignments);
+  for (const auto& local_assignment : local_assignments) {
+    assignments->push_back(
+        std::make_pair(row_component[local_assignment.first],
+                       col_component[local_assignment.second]));
   }
 }
 
@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Synthetic scenes of 500 tracks and 500 measurements, the measurements
+// being the tracks moved by noise, on a square whose side sets how crowded
+// the scene is. The costs are the distances, gated at 2.5 m. Matched densely
+// per connected component, or sparsely for the components of at least the
+// given size.
+
+#include <random>
+
+#include "Eigen/Core"
+#include "benchmark/benchmark.h"
+
+#include "modules/perception/common/algorithm/graph/gated_hungarian_bigraph_matcher.h"
+
+namespace apollo {
+namespace perception {
+namespace algorithm {
+namespace {
+
+constexpr size_t kNum = 500;
+
+void FillScene(const float side, SecureMat<float>* costs) {
+  std::mt19937 gen(5);
+  std::uniform_real_distribution<float> position(0.0f, side);
+  std::normal_distribution<float> noise(0.0f, 0.8f);
+  std::vector<Eigen::Vector2f> tracks(kNum);
+  std::vector<Eigen::Vector2f> measurements(kNum);
+  for (size_t i = 0; i < kNum; ++i) {
+    tracks[i] = Eigen::Vector2f(position(gen), position(gen));
+    measurements[i] = tracks[i] + Eigen::Vector2f(noise(gen), noise(gen));
+  }
+  costs->Resize(kNum, kNum);
+  for (size_t i = 0; i < kNum; ++i) {
+    for (size_t j = 0; j < kNum; ++j) {
+      (*costs)(i, j) = (tracks[i] - measurements[j]).norm();
+    }
+  }
+}
+
+// args: side of the scene in meters; sparse component size, or dense if 0;
+// threads
+void BM_GatedHungarianMatch(benchmark::State& state) {  // NOLINT
+  GatedHungarianMatcher<float> matcher(1000);
+  FillScene(static_cast<float>(state.range(0)),
+            matcher.mutable_global_costs());
+  matcher.set_sparse_component_size(static_cast<size_t>(state.range(1)));
+  matcher.set_num_threads(static_cast<size_t>(state.range(2)));
+  std::vector<std::pair<size_t, size_t>> assignments;
+  std::vector<size_t> unassigned_rows;
+  std::vector<size_t> unassigned_cols;
+  for (auto _ : state) {
+    matcher.Match(2.5f, 10.0f,
+                  GatedHungarianMatcher<float>::OptimizeFlag::OPTMIN,
+                  &assignments, &unassigned_rows, &unassigned_cols);
+  }
+  state.counters["assignments"] = static_cast<double>(assignments.size());
+}
+
+BENCHMARK(BM_GatedHungarianMatch)
+    ->Args({200, 0, 1})
+    ->Args({200, 8, 1})
+    ->Args({100, 0, 1})
+    ->Args({100, 8, 1})
+    ->Args({60, 0, 1})
+    ->Args({60, 8, 1})
+    ->Args({60, 8, 4})
+    ->Args({30, 0, 1})
+    ->Args({30, 8, 1})
+    ->Args({30, 8, 4})
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace algorithm
+}  // namespace perception
+}  // namespace apollo
+
+BENCHMARK_MAIN();
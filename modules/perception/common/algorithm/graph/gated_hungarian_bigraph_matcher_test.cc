@@ -16,6 +16,9 @@
 
 #include "modules/perception/common/algorithm/graph/gated_hungarian_bigraph_matcher.h"
 
+#include <algorithm>
+#include <random>
+
 #include "Eigen/Core"
 #include "gtest/gtest.h"
 
@@ -551,6 +554,57 @@ TEST_F(GatedHungarianMatcherTest, test_Match_Maximize) {
   EXPECT_EQ(0, unassigned_rows.size());
 }
 
+TEST_F(GatedHungarianMatcherTest, test_Match_Sparse) {
+  /* tracks and measurements scattered over a scene, gated by distance */
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<float> position(0.0f, 60.0f);
+  std::normal_distribution<float> noise(0.0f, 0.8f);
+  const size_t rows = 200;
+  const size_t cols = 180;
+  std::vector<Eigen::Vector2f> tracks(rows);
+  std::vector<Eigen::Vector2f> measurements(cols);
+  for (size_t i = 0; i < rows; ++i) {
+    tracks[i] = Eigen::Vector2f(position(gen), position(gen));
+  }
+  for (size_t j = 0; j < cols; ++j) {
+    measurements[j] = j < rows ? tracks[j] + Eigen::Vector2f(noise(gen),
+                                                             noise(gen))
+                               : Eigen::Vector2f(position(gen), position(gen));
+  }
+  SecureMat<float>* global_costs = optimizer_->mutable_global_costs();
+  global_costs->Resize(rows, cols);
+  for (size_t i = 0; i < rows; ++i) {
+    for (size_t j = 0; j < cols; ++j) {
+      (*global_costs)(i, j) = (tracks[i] - measurements[j]).norm();
+    }
+  }
+
+  const float cost_thresh = 2.5f;
+  const float bound_value = 10.0f;
+  const auto opt_flag = GatedHungarianMatcher<float>::OptimizeFlag::OPTMIN;
+  std::vector<std::pair<size_t, size_t>> dense_assignments;
+  std::vector<size_t> dense_unassigned_rows;
+  std::vector<size_t> dense_unassigned_cols;
+  optimizer_->Match(cost_thresh, bound_value, opt_flag, &dense_assignments,
+                    &dense_unassigned_rows, &dense_unassigned_cols);
+  std::sort(dense_assignments.begin(), dense_assignments.end());
+  EXPECT_LT(100, dense_assignments.size());
+
+  for (size_t num_threads : {1, 4}) {
+    optimizer_->set_sparse_component_size(3);
+    optimizer_->set_num_threads(num_threads);
+    std::vector<std::pair<size_t, size_t>> assignments;
+    std::vector<size_t> unassigned_rows;
+    std::vector<size_t> unassigned_cols;
+    optimizer_->Match(cost_thresh, bound_value, opt_flag, &assignments,
+                      &unassigned_rows, &unassigned_cols);
+    std::sort(assignments.begin(), assignments.end());
+    EXPECT_EQ(dense_assignments, assignments);
+    EXPECT_EQ(dense_unassigned_rows, unassigned_rows);
+    EXPECT_EQ(dense_unassigned_cols, unassigned_cols);
+  }
+}
+
 }  // namespace algorithm
 }  // namespace perception
 }  // namespace apollo
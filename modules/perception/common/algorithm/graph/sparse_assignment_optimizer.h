@@ -0,0 +1,216 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace apollo {
+namespace perception {
+namespace algorithm {
+
+/* @brief: minimum weight matching of a sparse bipartite graph, where a row
+ * is either assigned to one of the cols of its edges, or left unassigned
+ * with weight 0. Only edges with negative weights are worth assigning.
+ *
+ * It is solved as the assignment of every row to either a col or a dummy
+ * col of its own, by shortest augmenting paths (Jonker-Volgenant) found with
+ * dijkstra on the edges only. All the weights are shifted to be
+ * non-negative, which does not change the optimum as every row is assigned
+ * exactly once. It takes O(rows * edges * log(cols)) instead of the
+ * O(n^3) of the dense hungarian method. The buffers are kept between calls.
+ */
+template <typename T>
+class SparseAssignmentOptimizer {
+ public:
+  typedef std::pair<size_t, T> Edge;
+
+  SparseAssignmentOptimizer() = default;
+  ~SparseAssignmentOptimizer() = default;
+
+  /* @params[IN] cols_num: number of cols
+   * @params[IN] row_edges: (col, weight) of the edges of each row
+   * @params[OUT] assignments: assigned (row, col) in the order of rows */
+  void Minimize(const size_t cols_num,
+                const std::vector<std::vector<Edge>>& row_edges,
+                std::vector<std::pair<size_t, size_t>>* assignments);
+
+ private:
+  /* find the shortest augmenting path from the free row, update the col
+   * potentials and augment along it */
+  void Augment(const size_t row,
+               const std::vector<std::vector<Edge>>& row_edges);
+
+  /* relax the edges of the row, reached at the distance with the potential
+   * of the row */
+  void RelaxRow(const size_t row, const T row_dist, const T row_potential,
+                const std::vector<std::vector<Edge>>& row_edges);
+
+  void Relax(const size_t row, const size_t col, const T weight,
+             const T dist);
+
+  size_t cols_num_ = 0;
+  /* shift of the weights, which is the weight of the dummy cols */
+  T shift_ = static_cast<T>(0);
+
+  /* potentials of cols, with dummy cols after the real ones */
+  std::vector<T> col_potentials_;
+  std::vector<int> col_rows_;
+  std::vector<int> row_cols_;
+  /* weight of the edge each row is assigned to */
+  std::vector<T> row_weights_;
+
+  /* dijkstra state */
+  std::vector<T> dists_;
+  std::vector<int> pred_rows_;
+  std::vector<T> pred_weights_;
+  std::vector<bool> scanned_;
+  std::vector<size_t> scanned_cols_;
+  std::vector<size_t> touched_cols_;
+  std::priority_queue<std::pair<T, size_t>, std::vector<std::pair<T, size_t>>,
+                      std::greater<std::pair<T, size_t>>>
+      heap_;
+};  // class SparseAssignmentOptimizer
+
+template <typename T>
+void SparseAssignmentOptimizer<T>::Minimize(
+    const size_t cols_num, const std::vector<std::vector<Edge>>& row_edges,
+    std::vector<std::pair<size_t, size_t>>* assignments) {
+  assignments->clear();
+  const size_t rows_num = row_edges.size();
+  cols_num_ = cols_num;
+  const size_t all_cols_num = cols_num + rows_num;
+
+  shift_ = static_cast<T>(0);
+  for (const auto& edges : row_edges) {
+    for (const auto& edge : edges) {
+      shift_ = std::max(shift_, -edge.second);
+    }
+  }
+  col_potentials_.assign(all_cols_num, static_cast<T>(0));
+  col_rows_.assign(all_cols_num, -1);
+  row_cols_.assign(rows_num, -1);
+  row_weights_.assign(rows_num, shift_);
+  dists_.assign(all_cols_num, std::numeric_limits<T>::max());
+  pred_rows_.assign(all_cols_num, -1);
+  pred_weights_.assign(all_cols_num, shift_);
+  scanned_.assign(all_cols_num, false);
+
+  for (size_t row = 0; row < rows_num; ++row) {
+    Augment(row, row_edges);
+  }
+
+  for (size_t row = 0; row < rows_num; ++row) {
+    const size_t col = static_cast<size_t>(row_cols_[row]);
+    if (col < cols_num) {
+      assignments->push_back(std::make_pair(row, col));
+    }
+  }
+}
+
+template <typename T>
+void SparseAssignmentOptimizer<T>::Augment(
+    const size_t row, const std::vector<std::vector<Edge>>& row_edges) {
+  scanned_cols_.clear();
+  touched_cols_.clear();
+  /* the potential of the free row is 0 */
+  RelaxRow(row, static_cast<T>(0), static_cast<T>(0), row_edges);
+
+  /* the dummy col of the row is always free, so a free col is reached */
+  size_t sink = cols_num_ + row;
+  while (!heap_.empty()) {
+    const auto top = heap_.top();
+    heap_.pop();
+    const size_t col = top.second;
+    if (scanned_[col] || top.first > dists_[col]) {
+      continue;
+    }
+    scanned_[col] = true;
+    if (col_rows_[col] < 0) {
+      sink = col;
+      break;
+    }
+    scanned_cols_.push_back(col);
+    const size_t next_row = static_cast<size_t>(col_rows_[col]);
+    /* the assigned edge is tight */
+    const T row_potential = row_weights_[next_row] - col_potentials_[col];
+    RelaxRow(next_row, dists_[col], row_potential, row_edges);
+  }
+  heap_ = decltype(heap_)();
+
+  /* keep the reduced weights non-negative and the assigned edges tight,
+   * while the free cols stay at potential 0 */
+  const T sink_dist = dists_[sink];
+  for (const size_t col : scanned_cols_) {
+    col_potentials_[col] += dists_[col] - sink_dist;
+  }
+
+  /* augment along the path */
+  size_t col = sink;
+  while (true) {
+    const size_t pred_row = static_cast<size_t>(pred_rows_[col]);
+    const int prev_col = row_cols_[pred_row];
+    row_cols_[pred_row] = static_cast<int>(col);
+    row_weights_[pred_row] = pred_weights_[col];
+    col_rows_[col] = static_cast<int>(pred_row);
+    if (pred_row == row) {
+      break;
+    }
+    col = static_cast<size_t>(prev_col);
+  }
+
+  for (const size_t touched_col : touched_cols_) {
+    dists_[touched_col] = std::numeric_limits<T>::max();
+    scanned_[touched_col] = false;
+  }
+}
+
+template <typename T>
+void SparseAssignmentOptimizer<T>::RelaxRow(
+    const size_t row, const T row_dist, const T row_potential,
+    const std::vector<std::vector<Edge>>& row_edges) {
+  for (const auto& edge : row_edges[row]) {
+    const T weight = edge.second + shift_;
+    Relax(row, edge.first, weight,
+          row_dist + weight - col_potentials_[edge.first] - row_potential);
+  }
+  const size_t dummy_col = cols_num_ + row;
+  Relax(row, dummy_col, shift_,
+        row_dist + shift_ - col_potentials_[dummy_col] - row_potential);
+}
+
+template <typename T>
+void SparseAssignmentOptimizer<T>::Relax(const size_t row, const size_t col,
+                                         const T weight, const T dist) {
+  if (scanned_[col] || dist >= dists_[col]) {
+    return;
+  }
+  if (dists_[col] == std::numeric_limits<T>::max()) {
+    touched_cols_.push_back(col);
+  }
+  dists_[col] = dist;
+  pred_rows_[col] = static_cast<int>(row);
+  pred_weights_[col] = weight;
+  heap_.push(std::make_pair(dist, col));
+}
+
+}  // namespace algorithm
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,112 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/perception/common/algorithm/graph/sparse_assignment_optimizer.h"
+
+#include <random>
+#include <set>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace algorithm {
+
+namespace {
+
+typedef std::vector<std::vector<SparseAssignmentOptimizer<double>::Edge>>
+    RowEdges;
+
+/* minimum weight of the matchings of the rows from row on, by enumeration */
+double BruteForceMinimize(const RowEdges& row_edges, const size_t row,
+                          std::vector<bool>* used_cols) {
+  if (row == row_edges.size()) {
+    return 0.0;
+  }
+  double best = BruteForceMinimize(row_edges, row + 1, used_cols);
+  for (const auto& edge : row_edges[row]) {
+    if (used_cols->at(edge.first)) {
+      continue;
+    }
+    used_cols->at(edge.first) = true;
+    best = std::min(best, edge.second + BruteForceMinimize(row_edges, row + 1,
+                                                           used_cols));
+    used_cols->at(edge.first) = false;
+  }
+  return best;
+}
+
+}  // namespace
+
+TEST(SparseAssignmentOptimizerTest, test_Minimize) {
+  SparseAssignmentOptimizer<double> optimizer;
+  std::vector<std::pair<size_t, size_t>> assignments;
+
+  /* case 1: the gain of 0->1 and 1->0 beats the one of 0->0 */
+  RowEdges row_edges = {{{0, -3.0}, {1, -2.0}}, {{0, -2.0}}};
+  optimizer.Minimize(2, row_edges, &assignments);
+  ASSERT_EQ(2, assignments.size());
+  EXPECT_EQ(std::make_pair(size_t(0), size_t(1)), assignments[0]);
+  EXPECT_EQ(std::make_pair(size_t(1), size_t(0)), assignments[1]);
+
+  /* case 2: edges of non-negative weight are not assigned */
+  row_edges = {{{0, 1.0}}, {{1, 0.0}, {0, -1.0}}, {}};
+  optimizer.Minimize(3, row_edges, &assignments);
+  ASSERT_EQ(1, assignments.size());
+  EXPECT_EQ(std::make_pair(size_t(1), size_t(0)), assignments[0]);
+
+  /* case 3: random graphs against enumeration */
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> weight(-5.0, 1.0);
+  std::uniform_int_distribution<size_t> size(0, 7);
+  for (int n = 0; n < 300; ++n) {
+    const size_t rows_num = size(gen);
+    const size_t cols_num = size(gen);
+    row_edges.assign(rows_num, {});
+    for (size_t i = 0; i < rows_num; ++i) {
+      for (size_t j = 0; j < cols_num; ++j) {
+        if (gen() % 3 != 0) {
+          row_edges[i].emplace_back(j, weight(gen));
+        }
+      }
+    }
+    optimizer.Minimize(cols_num, row_edges, &assignments);
+
+    double total = 0.0;
+    std::set<size_t> rows;
+    std::set<size_t> cols;
+    for (const auto& assignment : assignments) {
+      rows.insert(assignment.first);
+      cols.insert(assignment.second);
+      bool found = false;
+      for (const auto& edge : row_edges[assignment.first]) {
+        if (edge.first == assignment.second) {
+          total += edge.second;
+          found = true;
+        }
+      }
+      EXPECT_TRUE(found);
+    }
+    EXPECT_EQ(assignments.size(), rows.size());
+    EXPECT_EQ(assignments.size(), cols.size());
+    std::vector<bool> used_cols(cols_num, false);
+    EXPECT_NEAR(BruteForceMinimize(row_edges, 0, &used_cols), total, 1e-9);
+  }
+}
+
+}  // namespace algorithm
+}  // namespace perception
+}  // namespace apollo
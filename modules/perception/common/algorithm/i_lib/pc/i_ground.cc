@@ -16,8 +16,10 @@
 #include "modules/perception/common/algorithm/i_lib/pc/i_ground.h"
 
 #include <algorithm>
+#include <future>
 #include <limits>
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 
 namespace apollo {
 namespace perception {
@@ -48,6 +50,7 @@ void PlaneFitGroundDetectorParam::SetDefault() {
   use_math_optimize = false;
   single_frame_detect = false;
   debug_output = false;
+  nr_threads = 1;
 }
 
 bool PlaneFitGroundDetectorParam::Validate() const {
@@ -55,6 +58,7 @@ bool PlaneFitGroundDetectorParam::Validate() const {
       nr_grids_coarse > nr_grids_fine || nr_points_max == 0 ||
       nr_samples_min_threshold == 0 || nr_samples_max_threshold == 0 ||
       nr_inliers_min_threshold == 0 || nr_ransac_iter_threshold == 0 ||
+      nr_threads == 0 ||
       roi_region_rad_x <= 0.f || roi_region_rad_y <= 0.f ||
       roi_region_rad_z <= 0.f ||
       planefit_dist_threshold_near > planefit_dist_threshold_far) {
@@ -149,6 +153,42 @@ void PlaneFitGroundDetector::InitOrderTable(const VoxelGridXY<float> *vg,
   }
 }
 
+void PlaneFitGroundDetector::InitOrderLevels() {
+  // a grid uses the planes of the neighbors fitted before it in the order
+  // table, and the ones of the last frame for the others. So it is one level
+  // after the neighbors before it, and the grids of a level are independent.
+  unsigned int nr_grids = vg_coarse_->NrVoxel();
+  std::vector<unsigned int> ranks(nr_grids, 0);
+  std::vector<unsigned int> levels(nr_grids, 0);
+  unsigned int i = 0;
+  for (i = 0; i < nr_grids; ++i) {
+    ranks[order_table_[i].first * param_.nr_grids_coarse +
+          order_table_[i].second] = i;
+  }
+  order_levels_.clear();
+  std::vector<std::pair<int, int>> neighbors;
+  for (i = 0; i < nr_grids; ++i) {
+    int r = order_table_[i].first;
+    int c = order_table_[i].second;
+    unsigned int level = 0;
+    neighbors.clear();
+    GetNeighbors(r, c, param_.nr_grids_coarse, param_.nr_grids_coarse,
+                 &neighbors);
+    for (const auto &neighbor : neighbors) {
+      unsigned int index =
+          neighbor.first * param_.nr_grids_coarse + neighbor.second;
+      if (ranks[index] < i) {
+        level = IMax(level, levels[index] + 1);
+      }
+    }
+    levels[r * param_.nr_grids_coarse + c] = level;
+    if (level >= order_levels_.size()) {
+      order_levels_.resize(level + 1);
+    }
+    order_levels_[level].push_back(order_table_[i]);
+  }
+}
+
 bool PlaneFitGroundDetector::Init() {
   unsigned int r = 0;
   unsigned int c = 0;
@@ -186,6 +226,7 @@ bool PlaneFitGroundDetector::Init() {
   // Init order lookup table
   order_table_ = IAlloc<std::pair<int, int>>(vg_fine_->NrVoxel());
   InitOrderTable(vg_coarse_, order_table_);
+  InitOrderLevels();
 
   // ground plane:
   ground_planes_ =
@@ -227,14 +268,15 @@ bool PlaneFitGroundDetector::Init() {
       local_candis_[r][c].Reserve(capacity);
     }
   }
-  // threeds in ransac, in inhomogeneous coordinates:
-  pf_threeds_ =
-      IAllocAligned<float>(param_.nr_samples_max_threshold * dim_point_, 4);
+  // threeds in ransac, in inhomogeneous coordinates, one slice per thread:
+  pf_threeds_ = IAllocAligned<float>(
+      param_.nr_samples_max_threshold * dim_point_ * param_.nr_threads, 4);
   if (!pf_threeds_) {
     return false;
   }
   memset(reinterpret_cast<void *>(pf_threeds_), 0,
-         param_.nr_samples_max_threshold * dim_point_ * sizeof(float));
+         param_.nr_samples_max_threshold * dim_point_ * param_.nr_threads *
+             sizeof(float));
   // labels:
   labels_ = IAllocAligned<char>(param_.nr_points_max, 4);
   if (!labels_) {
@@ -464,19 +506,27 @@ void PlaneFitGroundDetector::ComputeSignedGroundHeight(
   for (r = 0; r < nr_points; ++r) {
     height_above_ground[r] = std::numeric_limits<float>::max();
   }
-  ComputeSignedGroundHeightLine(
-      point_cloud, ground_planes_[0], ground_planes_[0], ground_planes_[1],
-      height_above_ground, 0, nr_points, nr_point_elements);
-  for (r = 1; r < nm1; ++r) {
-    ComputeSignedGroundHeightLine(point_cloud, ground_planes_[r - 1],
-                                  ground_planes_[r], ground_planes_[r + 1],
-                                  height_above_ground, r, nr_points,
-                                  nr_point_elements);
+  auto compute_lines = [&](unsigned int begin, unsigned int step) {
+    for (unsigned int l = begin; l <= nm1; l += step) {
+      ComputeSignedGroundHeightLine(
+          point_cloud, ground_planes_[l == 0 ? 0 : l - 1], ground_planes_[l],
+          ground_planes_[l == nm1 ? nm1 : l + 1], height_above_ground, l,
+          nr_points, nr_point_elements);
+    }
+  };
+  // the lines write the heights of their own points only
+  unsigned int nr_tasks = IMin(param_.nr_threads, param_.nr_grids_coarse);
+  std::vector<std::future<void>> futures;
+  for (unsigned int t = 1; t < nr_tasks; ++t) {
+    futures.emplace_back(
+        cyber::Async([&compute_lines, t, nr_tasks]() {
+          compute_lines(t, nr_tasks);
+        }));
+  }
+  compute_lines(0, nr_tasks);
+  for (auto &future : futures) {
+    future.get();
   }
-  ComputeSignedGroundHeightLine(point_cloud, ground_planes_[nm1 - 1],
-                                ground_planes_[nm1], ground_planes_[nm1],
-                                height_above_ground, nm1, nr_points,
-                                nr_point_elements);
 }
 
 void PlaneFitGroundDetector::ComputeSignedGroundHeightLine(
@@ -484,104 +534,115 @@ void PlaneFitGroundDetector::ComputeSignedGroundHeightLine(
     const GroundPlaneLiDAR *cn, const GroundPlaneLiDAR *dn,
     float *height_above_ground, unsigned int r, unsigned int nr_points,
     unsigned int nr_point_elements) {
-  unsigned int i = 0;
   unsigned int c = 0;
-  unsigned int id = 0;
-  int pos = 0;
-  char label = 0;
-  const float *cptr = nullptr;
-  float dist[] = {0, 0, 0, 0, 0};
   const float *plane[] = {nullptr, nullptr, nullptr, nullptr, nullptr};
-  float min_abs_dist = 0.0f;
   unsigned int nm1 = param_.nr_grids_coarse - 1;
   assert(param_.nr_grids_coarse >= 2);
   plane[0] = cn[0].IsValid() ? cn[0].params : nullptr;
   plane[1] = cn[1].IsValid() ? cn[1].params : nullptr;
   plane[2] = up[0].IsValid() ? up[0].params : nullptr;
   plane[3] = dn[0].IsValid() ? dn[0].params : nullptr;
-  std::vector<int>::const_iterator iter = (*vg_coarse_)(r, 0).indices_.cbegin();
-  while (iter < (*vg_coarse_)(r, 0).indices_.cend()) {
-    pos = *iter;
-    assert(pos < static_cast<int>(nr_points));
-    label = labels_[pos];
-    cptr = point_cloud + (nr_point_elements * pos);
-    dist[0] = plane[0] != nullptr
-                  ? IPlaneToPointSignedDistanceWUnitNorm(plane[0], cptr)
-                  : std::numeric_limits<float>::max();
-    min_abs_dist = IAbs(dist[0]);
-    id = 0;
-    // for candidates we take min dist:
-    if (label) {
-      dist[1] = plane[1] != nullptr
-                    ? IPlaneToPointSignedDistanceWUnitNorm(plane[1], cptr)
-                    : std::numeric_limits<float>::max();
-      dist[2] = plane[2] != nullptr
-                    ? IPlaneToPointSignedDistanceWUnitNorm(plane[2], cptr)
-                    : std::numeric_limits<float>::max();
-      dist[3] = plane[3] != nullptr
-                    ? IPlaneToPointSignedDistanceWUnitNorm(plane[3], cptr)
-                    : std::numeric_limits<float>::max();
-      for (i = 1; i < 4; ++i) {
-        if (min_abs_dist > IAbs(dist[i])) {
-          min_abs_dist = IAbs(dist[i]);
-          id = i;
-        }
-      }
-    }
-    height_above_ground[pos] = dist[id];
-    ++iter;
-  }
-
+  ComputeSignedGroundHeightGrid(point_cloud, plane, 4,
+                                (*vg_coarse_)(r, 0).indices_,
+                                height_above_ground, nr_points,
+                                nr_point_elements);
   for (c = 1; c < nm1; ++c) {
     plane[0] = cn[c].IsValid() ? cn[c].params : nullptr;
     plane[1] = cn[c - 1].IsValid() ? cn[c - 1].params : nullptr;
     plane[2] = cn[c + 1].IsValid() ? cn[c + 1].params : nullptr;
     plane[3] = up[c].IsValid() ? up[c].params : nullptr;
     plane[4] = dn[c].IsValid() ? dn[c].params : nullptr;
-    iter = (*vg_coarse_)(r, c).indices_.cbegin();
-    while (iter < (*vg_coarse_)(r, c).indices_.cend()) {
-      pos = *iter;
-      assert(pos < static_cast<int>(nr_points));
-      label = labels_[pos];
-      cptr = point_cloud + (nr_point_elements * pos);
-      dist[0] = plane[0] != nullptr
-                    ? IPlaneToPointSignedDistanceWUnitNorm(plane[0], cptr)
-                    : std::numeric_limits<float>::max();
-      min_abs_dist = IAbs(dist[0]);
-      id = 0;
-      if (label) {
-        dist[1] = plane[1] != nullptr
-                      ? IPlaneToPointSignedDistanceWUnitNorm(plane[1], cptr)
-                      : std::numeric_limits<float>::max();
-        dist[2] = plane[2] != nullptr
-                      ? IPlaneToPointSignedDistanceWUnitNorm(plane[2], cptr)
-                      : std::numeric_limits<float>::max();
-        dist[3] = plane[3] != nullptr
-                      ? IPlaneToPointSignedDistanceWUnitNorm(plane[3], cptr)
-                      : std::numeric_limits<float>::max();
-        dist[4] = plane[4] != nullptr
-                      ? IPlaneToPointSignedDistanceWUnitNorm(plane[4], cptr)
-                      : std::numeric_limits<float>::max();
-        for (i = 1; i < 5; ++i) {
-          if (min_abs_dist > IAbs(dist[i])) {
-            min_abs_dist = IAbs(dist[i]);
-            id = i;
-          }
-        }
-      }
-      height_above_ground[pos] = dist[id];
-      ++iter;
-    }
+    ComputeSignedGroundHeightGrid(point_cloud, plane, 5,
+                                  (*vg_coarse_)(r, c).indices_,
+                                  height_above_ground, nr_points,
+                                  nr_point_elements);
   }
   plane[0] = cn[nm1].IsValid() ? cn[nm1].params : nullptr;
   plane[1] = cn[nm1 - 1].IsValid() ? cn[nm1 - 1].params : nullptr;
   plane[2] = up[nm1].IsValid() ? up[nm1].params : nullptr;
   plane[3] = dn[nm1].IsValid() ? dn[nm1].params : nullptr;
-  iter = (*vg_coarse_)(r, nm1).indices_.cbegin();
-  while (iter < (*vg_coarse_)(r, nm1).indices_.cend()) {
-    pos = *iter;
+  ComputeSignedGroundHeightGrid(point_cloud, plane, 4,
+                                (*vg_coarse_)(r, nm1).indices_,
+                                height_above_ground, nr_points,
+                                nr_point_elements);
+}
+
+void PlaneFitGroundDetector::ComputeSignedGroundHeightGrid(
+    const float *point_cloud, const float *const *plane,
+    unsigned int nr_planes, const std::vector<int> &indices,
+    float *height_above_ground, unsigned int nr_points,
+    unsigned int nr_point_elements) {
+  unsigned int i = 0;
+  unsigned int k = 0;
+  unsigned int id = 0;
+  int pos = 0;
+  const float *cptr = nullptr;
+  float dist[] = {0, 0, 0, 0, 0};
+  float min_abs_dist = 0.0f;
+  unsigned int nr_indices = static_cast<unsigned int>(indices.size());
+  unsigned int nr_fast_processed = ((nr_indices >> 2) << 2);
+
+  // four points at a time, with the same operations in the same order as
+  // IPlaneToPointSignedDistanceWUnitNorm, so the heights are the same
+  __m128 v_planes[5][4];
+  for (k = 0; k < nr_planes; ++k) {
+    if (plane[k] != nullptr) {
+      v_planes[k][0] = _mm_set_ps1(plane[k][0]);
+      v_planes[k][1] = _mm_set_ps1(plane[k][1]);
+      v_planes[k][2] = _mm_set_ps1(plane[k][2]);
+      v_planes[k][3] = _mm_set_ps1(plane[k][3]);
+    }
+  }
+  const __m128 v_max = _mm_set_ps1(std::numeric_limits<float>::max());
+  const __m128 v_sign = _mm_set_ps1(-0.0f);
+  const __m128 v_zero = _mm_setzero_ps();
+  __m128 v_xs, v_ys, v_zs, v_labels, v_dist, v_abs_dist, v_best, v_best_abs,
+      v_closer;
+  const float *p[4] = {nullptr, nullptr, nullptr, nullptr};
+  float heights[4];
+  for (i = 0; i < nr_fast_processed; i += 4) {
+    for (k = 0; k < 4; ++k) {
+      assert(indices[i + k] < static_cast<int>(nr_points));
+      p[k] = point_cloud + (nr_point_elements * indices[i + k]);
+    }
+    v_xs = _mm_setr_ps(p[0][0], p[1][0], p[2][0], p[3][0]);
+    v_ys = _mm_setr_ps(p[0][1], p[1][1], p[2][1], p[3][1]);
+    v_zs = _mm_setr_ps(p[0][2], p[1][2], p[2][2], p[3][2]);
+    // for candidates we take min dist:
+    v_labels = _mm_cmpneq_ps(
+        _mm_setr_ps(labels_[indices[i]], labels_[indices[i + 1]],
+                    labels_[indices[i + 2]], labels_[indices[i + 3]]),
+        v_zero);
+    for (k = 0; k < nr_planes; ++k) {
+      if (plane[k] != nullptr) {
+        v_dist = _mm_add_ps(
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(v_planes[k][0], v_xs),
+                                  _mm_mul_ps(v_planes[k][1], v_ys)),
+                       _mm_mul_ps(v_planes[k][2], v_zs)),
+            v_planes[k][3]);
+      } else {
+        v_dist = v_max;
+      }
+      v_abs_dist = _mm_andnot_ps(v_sign, v_dist);
+      if (k == 0) {
+        v_best = v_dist;
+        v_best_abs = v_abs_dist;
+        continue;
+      }
+      v_closer = _mm_and_ps(_mm_cmpgt_ps(v_best_abs, v_abs_dist), v_labels);
+      v_best = _mm_blendv_ps(v_best, v_dist, v_closer);
+      v_best_abs = _mm_blendv_ps(v_best_abs, v_abs_dist, v_closer);
+    }
+    _mm_storeu_ps(heights, v_best);
+    for (k = 0; k < 4; ++k) {
+      height_above_ground[indices[i + k]] = heights[k];
+    }
+  }
+
+  // handling remaining points
+  for (; i < nr_indices; ++i) {
+    pos = indices[i];
     assert(pos < static_cast<int>(nr_points));
-    label = labels_[pos];
     cptr = point_cloud + (nr_point_elements * pos);
     dist[0] = plane[0] != nullptr
                   ? IPlaneToPointSignedDistanceWUnitNorm(plane[0], cptr)
@@ -589,25 +650,18 @@ void PlaneFitGroundDetector::ComputeSignedGroundHeightLine(
     min_abs_dist = IAbs(dist[0]);
     id = 0;
     // for candidates we take min dist:
-    if (label) {
-      dist[1] = plane[1] != nullptr
-                    ? IPlaneToPointSignedDistanceWUnitNorm(plane[1], cptr)
-                    : std::numeric_limits<float>::max();
-      dist[2] = plane[2] != nullptr
-                    ? IPlaneToPointSignedDistanceWUnitNorm(plane[2], cptr)
-                    : std::numeric_limits<float>::max();
-      dist[3] = plane[3] != nullptr
-                    ? IPlaneToPointSignedDistanceWUnitNorm(plane[3], cptr)
-                    : std::numeric_limits<float>::max();
-      for (i = 1; i < 4; ++i) {
-        if (min_abs_dist > IAbs(dist[i])) {
-          min_abs_dist = IAbs(dist[i]);
-          id = i;
+    if (labels_[pos]) {
+      for (k = 1; k < nr_planes; ++k) {
+        dist[k] = plane[k] != nullptr
+                      ? IPlaneToPointSignedDistanceWUnitNorm(plane[k], cptr)
+                      : std::numeric_limits<float>::max();
+        if (min_abs_dist > IAbs(dist[k])) {
+          min_abs_dist = IAbs(dist[k]);
+          id = k;
         }
       }
     }
     height_above_ground[pos] = dist[id];
-    ++iter;
   }
 }
 
@@ -882,7 +936,8 @@ inline float calculate_two_angles(const GroundPlaneLiDAR &p1,
 
 int PlaneFitGroundDetector::FitGridWithNeighbors(
     int r, int c, const float *point_cloud, GroundPlaneLiDAR *groundplane,
-    unsigned int nr_points, unsigned int nr_point_element, float dist_thre) {
+    unsigned int nr_points, unsigned int nr_point_element, float dist_thre,
+    float *threeds) {
   // initialize the best plane
   groundplane->ForceInvalid();
   // not enough samples, failed and return
@@ -922,7 +977,7 @@ int PlaneFitGroundDetector::FitGridWithNeighbors(
   float samples[9];
   // copy 3D points
   float *psrc = nullptr;
-  float *pdst = pf_threeds_;
+  float *pdst = threeds;
   int r_n = 0;
   int c_n = 0;
   float angle = -1.f;
@@ -935,9 +990,9 @@ int PlaneFitGroundDetector::FitGridWithNeighbors(
   for (int i = 0; i < param_.nr_ransac_iter_threshold; ++i) {
     IRandomSample(indices_trial, 3, nr_samples, &rseed);
     IScale3(indices_trial, dim_point_);
-    ICopy3(pf_threeds_ + indices_trial[0], samples);
-    ICopy3(pf_threeds_ + indices_trial[1], samples + 3);
-    ICopy3(pf_threeds_ + indices_trial[2], samples + 6);
+    ICopy3(threeds + indices_trial[0], samples);
+    ICopy3(threeds + indices_trial[1], samples + 3);
+    ICopy3(threeds + indices_trial[2], samples + 6);
     IPlaneFitDestroyed(samples, hypothesis[i].params);
     // check if the plane hypothesis has valid geometry
     if (hypothesis[i].GetDegreeNormalToZ() > param_.planefit_orien_threshold) {
@@ -945,7 +1000,7 @@ int PlaneFitGroundDetector::FitGridWithNeighbors(
     }
     // iterate samples and check if the point to plane distance is below
     // threshold
-    psrc = pf_threeds_;
+    psrc = threeds;
     nr_inliers = 0;
     for (int j = 0; j < nr_samples; ++j) {
       ptp_dist = IPlaneToPointDistanceWUnitNorm(hypothesis[i].params, psrc);
@@ -969,7 +1024,7 @@ int PlaneFitGroundDetector::FitGridWithNeighbors(
     if (ground_planes_[r_n][c_n].IsValid()) {
       hypothesis[i + param_.nr_ransac_iter_threshold] =
           ground_planes_[r_n][c_n];
-      psrc = pf_threeds_;
+      psrc = threeds;
       nr_inliers = 0;
       for (int j = 0; j < nr_samples; ++j) {
         ptp_dist = IPlaneToPointDistanceWUnitNorm(
@@ -1025,8 +1080,8 @@ int PlaneFitGroundDetector::FitGridWithNeighbors(
   // iterate samples and check if the point to plane distance is within
   // threshold
   nr_inliers = 0;
-  psrc = pf_threeds_;
-  pdst = pf_threeds_;
+  psrc = threeds;
+  pdst = threeds;
   for (int i = 0; i < nr_samples; ++i) {
     ptp_dist = IPlaneToPointDistanceWUnitNorm(groundplane->params, psrc);
     if (ptp_dist < dist_thre) {
@@ -1038,8 +1093,8 @@ int PlaneFitGroundDetector::FitGridWithNeighbors(
   }
   groundplane->SetNrSupport(nr_inliers);
 
-  // note that pf_threeds_ will be destroyed after calling this routine
-  IPlaneFitTotalLeastSquare(pf_threeds_, groundplane->params, nr_inliers);
+  // note that threeds will be destroyed after calling this routine
+  IPlaneFitTotalLeastSquare(threeds, groundplane->params, nr_inliers);
   if (angle_best <= CalculateAngleDist(*groundplane, neighbors)) {
     *groundplane = hypothesis[best];
     groundplane->SetStatus(true);
@@ -1092,13 +1147,15 @@ int PlaneFitGroundDetector::FitInOrder() {
   unsigned int j = 0;
   int r = 0;
   int c = 0;
-  GroundPlaneLiDAR gp;
   for (i = 0; i < param_.nr_grids_coarse; ++i) {
     for (j = 0; j < param_.nr_grids_coarse; ++j) {
       ground_z_[i][j].first = 0.f;
       ground_z_[i][j].second = false;
     }
   }
+  if (param_.nr_threads > 1 && !param_.debug_output) {
+    return FitInWavefront();
+  }
   std::stringstream sstr;
   sstr << "[GroundFitInfo] " << std::to_string(frame_timestamp_) << std::endl;
   size_t count = 0;
@@ -1137,18 +1194,8 @@ int PlaneFitGroundDetector::FitInOrder() {
         sstr << " min_z =  " << min_z << " max_z= " << max_z;
     }
     count += local_candis_[r][c].Size();
-    if (FitGridWithNeighbors(
-            r, c, vg_coarse_->const_data(), &gp, vg_coarse_->NrPoints(),
-            vg_coarse_->NrPointElement(), pf_thresholds_[r][c]) >=
-        static_cast<int>(param_.nr_inliers_min_threshold)) {
-      IPlaneEucliToSpher(gp, &ground_planes_sphe_[r][c]);
-      ground_planes_[r][c] = gp;
-      nr_grids++;
-    } else {
-      ground_planes_sphe_[r][c].ForceInvalid();
-      ground_planes_[r][c].ForceInvalid();
-    }
-    
+    nr_grids += FitGridInOrder(r, c, pf_threeds_);
+
     if (param_.debug_output) {
         sstr << " [AfterNeighborFilter] count = " << local_candis_[r][c].Size()
              << " [AfterGridPlaneFit] ground_z_valid = " << ground_z_[r][c].second
@@ -1173,6 +1220,56 @@ int PlaneFitGroundDetector::FitInOrder() {
   return nr_grids;
 }
 
+int PlaneFitGroundDetector::FitGridInOrder(int r, int c, float *threeds) {
+  GroundPlaneLiDAR gp;
+  if (FitGridWithNeighbors(r, c, vg_coarse_->const_data(), &gp,
+                           vg_coarse_->NrPoints(),
+                           vg_coarse_->NrPointElement(), pf_thresholds_[r][c],
+                           threeds) >=
+      static_cast<int>(param_.nr_inliers_min_threshold)) {
+    IPlaneEucliToSpher(gp, &ground_planes_sphe_[r][c]);
+    ground_planes_[r][c] = gp;
+    return 1;
+  }
+  ground_planes_sphe_[r][c].ForceInvalid();
+  ground_planes_[r][c].ForceInvalid();
+  return 0;
+}
+
+int PlaneFitGroundDetector::FitInWavefront() {
+  // the grids of a level only read the grids of the other levels, so they are
+  // fitted concurrently with the same results as in the order table
+  unsigned int nr_threads = param_.nr_threads;
+  unsigned int stride = param_.nr_samples_max_threshold * dim_point_;
+  std::vector<int> nr_grids(nr_threads, 0);
+  std::vector<std::future<void>> futures;
+  for (const auto &level : order_levels_) {
+    unsigned int nr_tasks = IMin(nr_threads,
+                                 static_cast<unsigned int>(level.size()));
+    futures.clear();
+    for (unsigned int t = 1; t < nr_tasks; ++t) {
+      futures.emplace_back(cyber::Async([&, t]() {
+        for (size_t i = t; i < level.size(); i += nr_tasks) {
+          nr_grids[t] += FitGridInOrder(level[i].first, level[i].second,
+                                        pf_threeds_ + t * stride);
+        }
+      }));
+    }
+    for (size_t i = 0; i < level.size(); i += nr_tasks) {
+      nr_grids[0] +=
+          FitGridInOrder(level[i].first, level[i].second, pf_threeds_);
+    }
+    for (auto &future : futures) {
+      future.get();
+    }
+  }
+  int sum = 0;
+  for (int n : nr_grids) {
+    sum += n;
+  }
+  return sum;
+}
+
 void PlaneFitGroundDetector::GetNeighbors(
     int r, int c, int rows, int cols,
     std::vector<std::pair<int, int>> *neighbors) {
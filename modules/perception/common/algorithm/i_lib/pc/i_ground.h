@@ -209,6 +209,9 @@ struct PlaneFitGroundDetectorParam {
   bool use_math_optimize;
   bool single_frame_detect;
   bool debug_output;
+  // fit the independent grids of a wavefront and compute the heights of the
+  // lines concurrently, with the same results as on a single thread
+  unsigned int nr_threads;
 };
 
 struct PlaneFitPointCandIndices {
@@ -286,12 +289,15 @@ class PlaneFitGroundDetector : public BaseGroundDetector {
  protected:
   void CleanUp();
   void InitOrderTable(const VoxelGridXY<float> *vg, std::pair<int, int> *order);
+  void InitOrderLevels();
   int Fit();
   int FitLine(unsigned int r);
   int FitGrid(const float *point_cloud, PlaneFitPointCandIndices *candi,
               GroundPlaneLiDAR *groundplane, unsigned int nr_points,
               unsigned int nr_point_element, float dist_thre);
   int FitInOrder();
+  int FitInWavefront();
+  int FitGridInOrder(int r, int c, float *threeds);
   int FilterCandidates(int r, int c, const float *point_cloud,
                        PlaneFitPointCandIndices *candi,
                        std::vector<std::pair<int, int>> *neighbors,
@@ -299,7 +305,8 @@ class PlaneFitGroundDetector : public BaseGroundDetector {
   int FitGridWithNeighbors(int r, int c, const float *point_cloud,
                            GroundPlaneLiDAR *groundplane,
                            unsigned int nr_points,
-                           unsigned int nr_point_element, float dist_thre);
+                           unsigned int nr_point_element, float dist_thre,
+                           float *threeds);
   void GetNeighbors(int r, int c, int rows, int cols,
                     std::vector<std::pair<int, int>> *neighbors);
   float CalculateAngleDist(const GroundPlaneLiDAR &plane,
@@ -341,6 +348,13 @@ class PlaneFitGroundDetector : public BaseGroundDetector {
                                      float *height_above_ground, unsigned int r,
                                      unsigned int nr_points,
                                      unsigned int nr_point_elements);
+  void ComputeSignedGroundHeightGrid(const float *point_cloud,
+                                     const float *const *plane,
+                                     unsigned int nr_planes,
+                                     const std::vector<int> &indices,
+                                     float *height_above_ground,
+                                     unsigned int nr_points,
+                                     unsigned int nr_point_elements);
 
  protected:
   VoxelGridXY<float> *vg_fine_;
@@ -358,6 +372,8 @@ class PlaneFitGroundDetector : public BaseGroundDetector {
   int *sampled_indices_;
   int age_ = 0;
   std::pair<int, int> *order_table_;
+  // grids of the order table grouped by wavefront level
+  std::vector<std::vector<std::pair<int, int>>> order_levels_;
   double frame_timestamp_ = 0.0;
 
   // global optimize
@@ -0,0 +1,64 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Ground detection of a frame of 120k points on a sloped and bumpy ground
+// with boxes on it, with the grid of the spatio-temporal ground detector, by
+// a number of threads. The frames alternate between two scenes so that the
+// planes of the last frame are not the answer.
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "modules/perception/common/algorithm/i_lib/pc/i_ground.h"
+#include "modules/perception/common/algorithm/i_lib/pc/i_ground_test_utils.h"
+
+namespace apollo {
+namespace perception {
+namespace algorithm {
+namespace {
+
+constexpr unsigned int kNumPoints = 120000;
+
+// args: threads
+void BM_PlaneFitGroundDetector(benchmark::State &state) {  // NOLINT
+  PlaneFitGroundDetectorParam param =
+      GroundSceneParam(static_cast<unsigned int>(state.range(0)));
+  PlaneFitGroundDetector detector(param);
+  detector.Init();
+  const std::vector<float> scenes[] = {GroundScene(0, kNumPoints),
+                                       GroundScene(1, kNumPoints)};
+  std::vector<float> heights(kNumPoints);
+  int frame = 0;
+  for (auto _ : state) {
+    detector.Detect(scenes[frame].data(), heights.data(), kNumPoints, 3);
+    frame = 1 - frame;
+  }
+}
+
+BENCHMARK(BM_PlaneFitGroundDetector)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace algorithm
+}  // namespace perception
+}  // namespace apollo
+
+BENCHMARK_MAIN();
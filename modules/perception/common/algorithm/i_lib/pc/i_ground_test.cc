@@ -0,0 +1,69 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/common/algorithm/i_lib/pc/i_ground.h"
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "modules/perception/common/algorithm/i_lib/pc/i_ground_test_utils.h"
+
+namespace apollo {
+namespace perception {
+namespace algorithm {
+
+TEST(PlaneFitGroundDetectorTest, ParallelSameAsSerial) {
+  const unsigned int nr_points = 60000;
+  PlaneFitGroundDetectorParam serial_param = GroundSceneParam(1);
+  PlaneFitGroundDetectorParam parallel_param = GroundSceneParam(4);
+  PlaneFitGroundDetector serial(serial_param);
+  PlaneFitGroundDetector parallel(parallel_param);
+  ASSERT_TRUE(serial.Init());
+  ASSERT_TRUE(parallel.Init());
+
+  // the planes of the last frame are used by the next ones
+  std::vector<float> serial_heights(nr_points);
+  std::vector<float> parallel_heights(nr_points);
+  for (int frame = 0; frame < 3; ++frame) {
+    const std::vector<float> points = GroundScene(frame, nr_points);
+    ASSERT_TRUE(
+        serial.Detect(points.data(), serial_heights.data(), nr_points, 3));
+    ASSERT_TRUE(
+        parallel.Detect(points.data(), parallel_heights.data(), nr_points, 3));
+
+    EXPECT_EQ(0, std::memcmp(serial.GetLabel(), parallel.GetLabel(),
+                             nr_points * sizeof(char)));
+    EXPECT_EQ(0, std::memcmp(serial_heights.data(), parallel_heights.data(),
+                             nr_points * sizeof(float)));
+    int nr_valid = 0;
+    for (unsigned int r = 0; r < serial.GetGridDimY(); ++r) {
+      for (unsigned int c = 0; c < serial.GetGridDimX(); ++c) {
+        const GroundPlaneLiDAR *serial_plane = serial.GetGroundPlane(r, c);
+        const GroundPlaneLiDAR *parallel_plane = parallel.GetGroundPlane(r, c);
+        EXPECT_EQ(serial_plane->IsValid(), parallel_plane->IsValid());
+        EXPECT_EQ(0, std::memcmp(serial_plane->params, parallel_plane->params,
+                                 sizeof(serial_plane->params)));
+        nr_valid += serial_plane->IsValid() ? 1 : 0;
+      }
+    }
+    EXPECT_LT(100, nr_valid);
+  }
+}
+
+}  // namespace algorithm
+}  // namespace perception
+}  // namespace apollo
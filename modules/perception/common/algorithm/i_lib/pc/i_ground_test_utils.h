@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "modules/perception/common/algorithm/i_lib/pc/i_ground.h"
+
+namespace apollo {
+namespace perception {
+namespace algorithm {
+
+// A sloped and bumpy ground with boxes on it, seen from the lidar at the
+// origin, shifted by the frame.
+inline std::vector<float> GroundScene(int frame, unsigned int nr_points) {
+  std::mt19937 gen(frame);
+  std::uniform_real_distribution<float> angle(0.f, 6.2831853f);
+  std::uniform_real_distribution<float> unit(0.f, 1.f);
+  std::normal_distribution<float> noise(0.f, 0.03f);
+  std::vector<float> points;
+  points.reserve(nr_points * 3);
+  const float shift = 0.5f * static_cast<float>(frame);
+  for (unsigned int i = 0; i < nr_points; ++i) {
+    const float theta = angle(gen);
+    const float range = 2.f + 70.f * unit(gen) * unit(gen);
+    const float x = range * std::cos(theta);
+    const float y = range * std::sin(theta);
+    float z = -1.8f + 0.02f * (x + shift) + 0.3f * std::sin(0.1f * y) +
+              noise(gen);
+    if (std::fmod(std::fabs(x + shift), 12.f) < 2.f &&
+        std::fmod(std::fabs(y), 9.f) < 4.f) {
+      z += 2.f * unit(gen);
+    }
+    points.push_back(x);
+    points.push_back(y);
+    points.push_back(z);
+  }
+  return points;
+}
+
+// The grid of the spatio-temporal ground detector.
+inline PlaneFitGroundDetectorParam GroundSceneParam(unsigned int nr_threads) {
+  PlaneFitGroundDetectorParam param;
+  param.roi_region_rad_x = 80.f;
+  param.roi_region_rad_y = 80.f;
+  param.roi_region_rad_z = 80.f;
+  param.nr_grids_fine = 256;
+  param.nr_grids_coarse = 32;
+  param.nr_inliers_min_threshold = 6;
+  param.nr_smooth_iter = 5;
+  param.nr_threads = nr_threads;
+  return param;
+}
+
+}  // namespace algorithm
+}  // namespace perception
+}  // namespace apollo
@@ -17,10 +17,12 @@
 #include "modules/perception/common/lidar/common/object_builder.h"
 
 #include <algorithm>
+#include <atomic>
+#include <future>
 #include <limits>
 
+#include "cyber/task/task.h"
 #include "modules/perception/common/algorithm/geometry/common.h"
-#include "modules/perception/common/algorithm/geometry/convex_hull_2d.h"
 #include "modules/perception/common/perception_gflags.h"
 
 namespace apollo {
@@ -37,22 +39,61 @@ bool ObjectBuilder::Build(const ObjectBuilderOptions& options,
     return false;
   }
   std::vector<ObjectPtr>* objects = &(frame->segmented_objects);
-  for (size_t i = 0; i < objects->size(); ++i) {
-    if (objects->at(i)) {
-      objects->at(i)->id = static_cast<int>(i);
-      ComputePolygon2D(objects->at(i));
-      ComputePolygonSizeCenter(objects->at(i));
-      ComputeOtherObjectInformation(objects->at(i));
-      ComputeHeightAboveGround(objects->at(i));
-      if (FLAGS_need_judge_front_critical) {
-          JudgeFrontCritical(objects->at(i), frame->lidar2novatel_extrinsics);
+  const size_t num_threads =
+      static_cast<size_t>(std::max(1, FLAGS_object_builder_num_threads));
+  while (hulls_.size() < num_threads) {
+    hulls_.emplace_back(new ConvexHull);
+  }
+  const size_t num_tasks = std::min(num_threads, objects->size());
+  if (num_tasks <= 1) {
+    for (size_t i = 0; i < objects->size(); ++i) {
+      if (objects->at(i)) {
+        objects->at(i)->id = static_cast<int>(i);
+        BuildObject(objects->at(i), frame, hulls_[0].get());
+      }
+    }
+  } else {
+    // the objects are taken one by one, as their clouds differ a lot in size
+    std::atomic<size_t> next(0);
+    auto build_objects = [&](ConvexHull* hull) {
+      for (size_t i = next++; i < objects->size(); i = next++) {
+        if (objects->at(i)) {
+          objects->at(i)->id = static_cast<int>(i);
+          BuildObject(objects->at(i), frame, hull);
+        }
       }
+    };
+    std::vector<std::future<void>> futures;
+    for (size_t t = 1; t < num_tasks; ++t) {
+      ConvexHull* hull = hulls_[t].get();
+      futures.emplace_back(
+          cyber::Async([&build_objects, hull]() { build_objects(hull); }));
+    }
+    build_objects(hulls_[0].get());
+    for (auto& future : futures) {
+      future.get();
     }
   }
   return true;
 }
 
+void ObjectBuilder::BuildObject(ObjectPtr object, LidarFrame* frame,
+                                ConvexHull* hull) {
+  ComputePolygon2D(object, hull);
+  ComputePolygonSizeCenter(object);
+  ComputeOtherObjectInformation(object);
+  ComputeHeightAboveGround(object);
+  if (FLAGS_need_judge_front_critical) {
+    JudgeFrontCritical(object, frame->lidar2novatel_extrinsics);
+  }
+}
+
 void ObjectBuilder::ComputePolygon2D(ObjectPtr object) {
+  ConvexHull hull;
+  ComputePolygon2D(object, &hull);
+}
+
+void ObjectBuilder::ComputePolygon2D(ObjectPtr object, ConvexHull* hull) {
   Eigen::Vector3f min_pt;
   Eigen::Vector3f max_pt;
   PointFCloud& cloud = object->lidar_supplement.cloud;
@@ -62,8 +103,7 @@ void ObjectBuilder::ComputePolygon2D(ObjectPtr object) {
     return;
   }
   LinePerturbation(&cloud);
-  algorithm::ConvexHull2D<PointFCloud, PolygonDType> hull;
-  hull.GetConvexHull(cloud, &(object->polygon));
+  hull->GetConvexHull(cloud, &(object->polygon));
 }
 
 void ObjectBuilder::ComputeOtherObjectInformation(ObjectPtr object) {
@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 
+#include "modules/perception/common/algorithm/geometry/convex_hull_2d.h"
 #include "modules/perception/common/base/object.h"
 #include "modules/perception/common/base/point.h"
 #include "modules/perception/common/base/point_cloud.h"
@@ -71,7 +72,8 @@ class ObjectBuilder {
       const ObjectBuilderInitOptions& options = ObjectBuilderInitOptions());
 
   /**
-   * @brief Calculate and fill object size, center, directions.
+   * @brief Calculate and fill object size, center, directions. The objects
+   * are built by FLAGS_object_builder_num_threads threads.
    * 
    * @param options object builder options
    * @param frame lidar frame
@@ -136,6 +138,17 @@ class ObjectBuilder {
   void GetMinMax3D(const apollo::perception::base::PointCloud<
                        apollo::perception::base::PointF>& cloud,
                    Eigen::Vector3f* min_pt, Eigen::Vector3f* max_pt);
+
+ private:
+  typedef algorithm::ConvexHull2D<PointFCloud, PolygonDType> ConvexHull;
+
+  // @brief: build the object with the buffers of the hull.
+  void BuildObject(ObjectPtr object, LidarFrame* frame, ConvexHull* hull);
+
+  void ComputePolygon2D(ObjectPtr object, ConvexHull* hull);
+
+  // hull with its buffers of each thread, kept between frames
+  std::vector<std::unique_ptr<ConvexHull>> hulls_;
 };  // class ObjectBuilder
 
 }  // namespace lidar
@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/common/lidar/common/object_builder.h"
+
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "modules/perception/common/perception_gflags.h"
+
+namespace apollo {
+namespace perception {
+namespace lidar {
+
+namespace {
+
+// objects of a few to thousands of points, and a line of points
+void RandomObjects(LidarFrame* frame) {
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<float> unit(0.f, 1.f);
+  frame->segmented_objects.clear();
+  for (int i = 0; i < 60; ++i) {
+    auto object = std::make_shared<base::Object>();
+    const int num_points = i % 10 == 0 ? 3 : static_cast<int>(
+        4 + 3000 * unit(gen) * unit(gen) * unit(gen));
+    const float cx = 80.f * unit(gen) - 40.f;
+    const float cy = 80.f * unit(gen) - 40.f;
+    const float length = 0.5f + 5.f * unit(gen);
+    const float yaw = 3.14f * unit(gen);
+    for (int j = 0; j < num_points; ++j) {
+      const float u = length * (unit(gen) - 0.5f);
+      const float v = i == 1 ? 0.f : 0.4f * length * (unit(gen) - 0.5f);
+      base::PointF point;
+      point.x = cx + u * std::cos(yaw) - v * std::sin(yaw);
+      point.y = cy + u * std::sin(yaw) + v * std::cos(yaw);
+      point.z = 2.f * unit(gen) - 1.5f;
+      object->lidar_supplement.cloud.push_back(point, 0.1 * j, point.z + 1.8f);
+    }
+    frame->segmented_objects.push_back(object);
+  }
+}
+
+}  // namespace
+
+TEST(ObjectBuilderTest, ParallelSameAsSerial) {
+  LidarFrame serial_frame;
+  LidarFrame parallel_frame;
+  RandomObjects(&serial_frame);
+  RandomObjects(&parallel_frame);
+
+  ObjectBuilder serial;
+  ObjectBuilder parallel;
+  ASSERT_TRUE(serial.Init());
+  ASSERT_TRUE(parallel.Init());
+  ObjectBuilderOptions options;
+  FLAGS_object_builder_num_threads = 1;
+  ASSERT_TRUE(serial.Build(options, &serial_frame));
+  FLAGS_object_builder_num_threads = 4;
+  ASSERT_TRUE(parallel.Build(options, &parallel_frame));
+  FLAGS_object_builder_num_threads = 1;
+
+  ASSERT_EQ(serial_frame.segmented_objects.size(),
+            parallel_frame.segmented_objects.size());
+  for (size_t i = 0; i < serial_frame.segmented_objects.size(); ++i) {
+    const auto& expected = serial_frame.segmented_objects[i];
+    const auto& object = parallel_frame.segmented_objects[i];
+    EXPECT_EQ(static_cast<int>(i), object->id);
+    ASSERT_EQ(expected->polygon.size(), object->polygon.size());
+    EXPECT_LE(3u, object->polygon.size());
+    for (size_t j = 0; j < object->polygon.size(); ++j) {
+      EXPECT_EQ(expected->polygon[j].x, object->polygon[j].x);
+      EXPECT_EQ(expected->polygon[j].y, object->polygon[j].y);
+      EXPECT_EQ(expected->polygon[j].z, object->polygon[j].z);
+    }
+    EXPECT_EQ(expected->center, object->center);
+    EXPECT_EQ(expected->size, object->size);
+    EXPECT_EQ(expected->direction, object->direction);
+    EXPECT_EQ(expected->latest_tracked_time, object->latest_tracked_time);
+    EXPECT_EQ(expected->lidar_supplement.height_above_ground,
+              object->lidar_supplement.height_above_ground);
+
+    // every point is inside the counter clockwise polygon
+    const auto& polygon = object->polygon;
+    if (object->lidar_supplement.cloud.size() < 4u) {
+      continue;
+    }
+    for (size_t p = 0; p < object->lidar_supplement.cloud.size(); ++p) {
+      const auto& point = object->lidar_supplement.cloud[p];
+      for (size_t j = 0; j < polygon.size(); ++j) {
+        const auto& a = polygon[j];
+        const auto& b = polygon[(j + 1) % polygon.size()];
+        EXPECT_GE((b.x - a.x) * (point.y - a.y) - (b.y - a.y) * (point.x - a.x),
+                  -1e-4);
+      }
+    }
+  }
+}
+
+}  // namespace lidar
+}  // namespace perception
+}  // namespace apollo
@@ -110,5 +110,17 @@ DEFINE_double(cone_y_front, 5.0, "cone reserve range smaller than Y");
 DEFINE_double(cone_y_back, 0.0, "cone reserve range bigger than Y");
 DEFINE_double(cone_reserve_time, 10000.0, "cone reserve time");
 
+// gated hungarian assignment
+DEFINE_int32(hm_sparse_component_size, 0,
+             "connected components of at least this number of tracks or "
+             "objects are matched on their gated pairs only, 0 to match all "
+             "of them on the dense costs");
+DEFINE_int32(hm_assignment_num_threads, 1,
+             "threads matching the sparse connected components");
+
+// lidar object builder
+DEFINE_int32(object_builder_num_threads, 1,
+             "threads building the polygons and shapes of the objects");
+
 }  // namespace perception
 }  // namespace apollo
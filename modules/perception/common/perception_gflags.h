@@ -77,5 +77,12 @@ DECLARE_double(cone_y_front);
 DECLARE_double(cone_y_back);
 DECLARE_double(cone_reserve_time);
 
+// gated hungarian assignment
+DECLARE_int32(hm_sparse_component_size);
+DECLARE_int32(hm_assignment_num_threads);
+
+// lidar object builder
+DECLARE_int32(object_builder_num_threads);
+
 }  // namespace perception
 }  // namespace apollo
@@ -177,9 +177,9 @@ void StrategyFilter::MergeInclusiveObjects(LidarFrame* frame) {
         }
     }
 
+    algorithm::ConvexHull2D<base::PointFCloud, base::PolygonDType> hull;
     for (auto& obj : sorted_objects) {
         if (obj.need_refine) {
-            algorithm::ConvexHull2D<base::PointFCloud, base::PolygonDType> hull;
             if (objects[obj.index]->lidar_supplement.cloud.size() > 2) {
                 hull.GetConvexHull(objects[obj.index]->lidar_supplement.cloud,
                     &objects[obj.index]->polygon);
@@ -38,6 +38,10 @@ struct BipartiteGraphMatcherInitOptions : public BaseInitOptions {};
 struct BipartiteGraphMatcherOptions {
   float cost_thresh = 4.0f;
   float bound_value = 100.0f;
+  // components of at least this size are matched on their gated pairs only,
+  // if the matcher supports it; 0 to match them on the dense costs
+  size_t sparse_component_size = 0;
+  size_t num_threads = 1;
 };
 
 class BaseBipartiteGraphMatcher {
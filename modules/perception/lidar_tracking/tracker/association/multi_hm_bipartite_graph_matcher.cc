@@ -38,6 +38,8 @@ void MultiHmBipartiteGraphMatcher::Match(
     std::vector<size_t> *unassigned_cols) {
   algorithm::GatedHungarianMatcher<float>::OptimizeFlag opt_flag =
       algorithm::GatedHungarianMatcher<float>::OptimizeFlag::OPTMIN;
+  optimizer_.set_sparse_component_size(options.sparse_component_size);
+  optimizer_.set_num_threads(options.num_threads);
   optimizer_.Match(options.cost_thresh, options.bound_value, opt_flag,
                    assignments, unassigned_rows, unassigned_cols);
 }
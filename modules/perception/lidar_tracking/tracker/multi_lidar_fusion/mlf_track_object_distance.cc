@@ -52,7 +52,7 @@ bool MlfTrackObjectDistance::Init(
   for (int i = 0; i < config.foreground_weights_size(); ++i) {
     const auto& fgws = config.foreground_weights(i);
     const std::string& name = fgws.sensor_name_pair();
-    std::vector<float> weights(7, 0.f);
+    std::vector<float> weights(8, 0.f);
     weights[0] = fgws.location_dist_weight();
     weights[1] = fgws.direction_dist_weight();
     weights[2] = fgws.bbox_size_dist_weight();
@@ -83,78 +83,85 @@ bool MlfTrackObjectDistance::Init(
 float MlfTrackObjectDistance::ComputeDistance(
     const TrackedObjectConstPtr& object,
     const MlfTrackDataConstPtr& track) const {
-  bool is_background = object->is_background;
   const TrackedObjectConstPtr latest_object = track->GetLatestObject().second;
-  std::string key = latest_object->sensor_info.name + object->sensor_info.name;
-  const std::vector<float>* weights = nullptr;
+  const std::vector<float>* weights =
+      GetWeights(latest_object->sensor_info.name, object->sensor_info.name,
+                 object->is_background);
+  if (weights == nullptr || weights->size() < 7) {
+    AERROR << "Invalid weights";
+    return 1e+10f;
+  }
+
+  double current_time = object->object_ptr->latest_tracked_time;
+  track->PredictState(current_time);
+  return ComputeDistance(object, track, track->predict_.state, *weights);
+}
+
+const std::vector<float>* MlfTrackObjectDistance::GetWeights(
+    const std::string& track_sensor, const std::string& object_sensor,
+    bool is_background) const {
+  std::string key = track_sensor + object_sensor;
   if (is_background) {
     auto iter = background_weight_table_.find(key);
     if (iter == background_weight_table_.end()) {
-      weights = &kBackgroundDefaultWeight;
-    } else {
-      weights = &iter->second;
-    }
-  } else {
-    auto iter = foreground_weight_table_.find(key);
-    if (iter == foreground_weight_table_.end()) {
-      weights = &kForegroundDefaultWeight;
-    } else {
-      weights = &iter->second;
+      return &kBackgroundDefaultWeight;
     }
+    return &iter->second;
   }
-  if (weights == nullptr || weights->size() < 7) {
-    AERROR << "Invalid weights";
-    return 1e+10f;
+  auto iter = foreground_weight_table_.find(key);
+  if (iter == foreground_weight_table_.end()) {
+    return &kForegroundDefaultWeight;
   }
+  return &iter->second;
+}
+
+float MlfTrackObjectDistance::ComputeDistance(
+    const TrackedObjectConstPtr& object, const MlfTrackDataConstPtr& track,
+    const Eigen::VectorXf& track_predict,
+    const std::vector<float>& weights) const {
+  const TrackedObjectConstPtr latest_object = track->GetLatestObject().second;
   float distance = 0.f;
   float delta = 1e-10f;
 
   double current_time = object->object_ptr->latest_tracked_time;
-  track->PredictState(current_time);
-
   double time_diff =
       track->age_ ? current_time - track->latest_visible_time_ : 0;
 
   // gate
   float euclidean_distance =
-    EuclideanDistance(latest_object, track->predict_.state, object, time_diff);
+    EuclideanDistance(latest_object, track_predict, object, time_diff);
   if (euclidean_distance > euclidean_distance_threshold_) {
     return out_gate_match_cost_;
   }
 
-  if (weights->at(0) > delta) {
-    distance +=
-        weights->at(0) * LocationDistance(latest_object, track->predict_.state,
-                                          object, time_diff);
+  if (weights[0] > delta) {
+    distance += weights[0] * LocationDistance(latest_object, track_predict,
+                                              object, time_diff);
   }
-  if (weights->at(1) > delta) {
-    distance +=
-        weights->at(1) * DirectionDistance(latest_object, track->predict_.state,
-                                           object, time_diff);
+  if (weights[1] > delta) {
+    distance += weights[1] * DirectionDistance(latest_object, track_predict,
+                                               object, time_diff);
   }
-  if (weights->at(2) > delta) {
-    distance +=
-        weights->at(2) * BboxSizeDistance(latest_object, track->predict_.state,
-                                          object, time_diff);
+  if (weights[2] > delta) {
+    distance += weights[2] * BboxSizeDistance(latest_object, track_predict,
+                                              object, time_diff);
   }
-  if (weights->at(3) > delta) {
-    distance +=
-        weights->at(3) * PointNumDistance(latest_object, track->predict_.state,
-                                          object, time_diff);
+  if (weights[3] > delta) {
+    distance += weights[3] * PointNumDistance(latest_object, track_predict,
+                                              object, time_diff);
   }
-  if (weights->at(4) > delta) {
-    distance +=
-        weights->at(4) * HistogramDistance(latest_object, track->predict_.state,
-                                           object, time_diff);
+  if (weights[4] > delta) {
+    distance += weights[4] * HistogramDistance(latest_object, track_predict,
+                                               object, time_diff);
   }
-  if (weights->at(5) > delta) {
-    distance += weights->at(5) * CentroidShiftDistance(latest_object,
-                                                       track->predict_.state,
-                                                       object, time_diff);
+  if (weights[5] > delta) {
+    distance += weights[5] * CentroidShiftDistance(latest_object,
+                                                   track_predict, object,
+                                                   time_diff);
   }
-  if (weights->at(6) > delta) {
-    distance += weights->at(6) *
-                BboxIouDistance(latest_object, track->predict_.state, object,
+  if (weights[6] > delta) {
+    distance += weights[6] *
+                BboxIouDistance(latest_object, track_predict, object,
                                 time_diff, background_object_match_threshold_);
   }
 
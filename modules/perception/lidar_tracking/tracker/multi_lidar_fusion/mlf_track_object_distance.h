@@ -57,6 +57,50 @@ class MlfTrackObjectDistance {
   float ComputeDistance(const TrackedObjectConstPtr& object,
                         const MlfTrackDataConstPtr& track) const;
 
+  /**
+   * @brief Compute object track distance with the track already predicted
+   * to the object time, without touching the track, so that it can be
+   * called concurrently
+   *
+   * @param object
+   * @param track track data
+   * @param track_predict predicted state of the track at the object time
+   * @param weights distance weights of the sensor pair
+   * @return float distance
+   */
+  float ComputeDistance(const TrackedObjectConstPtr& object,
+                        const MlfTrackDataConstPtr& track,
+                        const Eigen::VectorXf& track_predict,
+                        const std::vector<float>& weights) const;
+
+  /**
+   * @brief Get distance weights of the sensor pair
+   *
+   * @param track_sensor sensor name of the latest object of the track
+   * @param object_sensor sensor name of the new object
+   * @param is_background whether the new object is background
+   * @return const std::vector<float>* weights
+   */
+  const std::vector<float>* GetWeights(const std::string& track_sensor,
+                                       const std::string& object_sensor,
+                                       bool is_background) const;
+
+  /**
+   * @brief Get the gate of the euclidean distance
+   *
+   * @return float
+   */
+  float euclidean_distance_threshold() const {
+    return euclidean_distance_threshold_;
+  }
+
+  /**
+   * @brief Get the distance of the pairs out of the gate
+   *
+   * @return float
+   */
+  float out_gate_match_cost() const { return out_gate_match_cost_; }
+
   /**
    * @brief Get class name
    *
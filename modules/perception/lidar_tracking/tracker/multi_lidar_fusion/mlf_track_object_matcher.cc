@@ -16,14 +16,40 @@
 
 #include "modules/perception/lidar_tracking/tracker/multi_lidar_fusion/mlf_track_object_matcher.h"
 
+#include <algorithm>
+#include <cmath>
+#include <future>
 #include <numeric>
 
 #include "cyber/common/file.h"
+#include "cyber/task/task.h"
 #include "modules/perception/lidar_tracking/tracker/multi_lidar_fusion/proto/multi_lidar_fusion_config.pb.h"
 
 namespace apollo {
 namespace perception {
 namespace lidar {
+namespace {
+
+// grid coordinates beyond it are not packed into the cell key
+constexpr double kMaxCellCoord = 1.0e9;
+
+bool CellCoord(const float x, const float y, const float cell_size,
+               int64_t *cell_x, int64_t *cell_y) {
+  const double cx = std::floor(static_cast<double>(x) / cell_size);
+  const double cy = std::floor(static_cast<double>(y) / cell_size);
+  if (!(std::fabs(cx) < kMaxCellCoord && std::fabs(cy) < kMaxCellCoord)) {
+    return false;
+  }
+  *cell_x = static_cast<int64_t>(cx);
+  *cell_y = static_cast<int64_t>(cy);
+  return true;
+}
+
+int64_t CellKey(const int64_t cell_x, const int64_t cell_y) {
+  return cell_x * (2 * static_cast<int64_t>(kMaxCellCoord) + 1) + cell_y;
+}
+
+}  // namespace
 
 bool MlfTrackObjectMatcher::Init(
     const MlfTrackObjectMatcherInitOptions &options) {
@@ -53,6 +79,11 @@ bool MlfTrackObjectMatcher::Init(
 
   bound_value_ = config.bound_value();
   max_match_distance_ = config.max_match_distance();
+  use_association_grid_ = config.use_association_grid();
+  association_thread_num_ =
+      std::max(static_cast<size_t>(config.association_thread_num()),
+               static_cast<size_t>(1));
+  sparse_component_size_ = config.sparse_component_size();
   return true;
 }
 
@@ -77,6 +108,8 @@ void MlfTrackObjectMatcher::Match(
   BipartiteGraphMatcherOptions matcher_options;
   matcher_options.cost_thresh = max_match_distance_;
   matcher_options.bound_value = bound_value_;
+  matcher_options.sparse_component_size = sparse_component_size_;
+  matcher_options.num_threads = association_thread_num_;
 
   BaseBipartiteGraphMatcher *matcher =
       objects[0]->is_background ? background_matcher_ : foreground_matcher_;
@@ -84,7 +117,11 @@ void MlfTrackObjectMatcher::Match(
   algorithm::SecureMat<float> *association_mat = matcher->cost_matrix();
 
   association_mat->Resize(tracks.size(), objects.size());
-  ComputeAssociateMatrix(tracks, objects, association_mat);
+  if (use_association_grid_) {
+    ComputeGatedAssociateMatrix(tracks, objects, association_mat);
+  } else {
+    ComputeAssociateMatrix(tracks, objects, association_mat);
+  }
   matcher->Match(matcher_options, assignments, unassigned_tracks,
                  unassigned_objects);
   for (size_t i = 0; i < assignments->size(); ++i) {
@@ -107,6 +144,132 @@ void MlfTrackObjectMatcher::ComputeAssociateMatrix(
   }
 }
 
+void MlfTrackObjectMatcher::ComputeGatedAssociateMatrix(
+    const std::vector<MlfTrackDataPtr> &tracks,
+    const std::vector<TrackedObjectPtr> &new_objects,
+    algorithm::SecureMat<float> *association_mat) {
+  // the objects of a frame share the timestamp to predict the tracks to
+  const double current_time = new_objects[0]->object_ptr->latest_tracked_time;
+  for (const auto &object : new_objects) {
+    if (object->object_ptr->latest_tracked_time != current_time) {
+      ComputeAssociateMatrix(tracks, new_objects, association_mat);
+      return;
+    }
+  }
+
+  // sensors of the latest objects of the tracks and of the new objects
+  std::vector<std::string> sensor_names;
+  auto sensor_index = [&sensor_names](const std::string &name) {
+    auto iter = std::find(sensor_names.begin(), sensor_names.end(), name);
+    if (iter != sensor_names.end()) {
+      return static_cast<size_t>(iter - sensor_names.begin());
+    }
+    sensor_names.push_back(name);
+    return sensor_names.size() - 1;
+  };
+  std::vector<size_t> track_sensors(tracks.size());
+  std::vector<Eigen::VectorXf> track_predicts(tracks.size());
+  for (size_t i = 0; i < tracks.size(); ++i) {
+    track_sensors[i] =
+        sensor_index(tracks[i]->GetLatestObject().second->sensor_info.name);
+    tracks[i]->PredictState(current_time);
+    track_predicts[i] = tracks[i]->predict_.state;
+  }
+  std::vector<size_t> object_sensors(new_objects.size());
+  for (size_t j = 0; j < new_objects.size(); ++j) {
+    object_sensors[j] = sensor_index(new_objects[j]->sensor_info.name);
+  }
+
+  // weights of each sensor pair, for foreground and background objects
+  const size_t sensor_num = sensor_names.size();
+  std::vector<const std::vector<float> *> weights(sensor_num * sensor_num * 2);
+  for (size_t a = 0; a < sensor_num; ++a) {
+    for (size_t b = 0; b < sensor_num; ++b) {
+      for (size_t is_background = 0; is_background < 2; ++is_background) {
+        const std::vector<float> *pair_weights =
+            track_object_distance_->GetWeights(
+                sensor_names[a], sensor_names[b], is_background != 0);
+        if (pair_weights == nullptr || pair_weights->size() < 7) {
+          ComputeAssociateMatrix(tracks, new_objects, association_mat);
+          return;
+        }
+        weights[(a * sensor_num + b) * 2 + is_background] = pair_weights;
+      }
+    }
+  }
+
+  // grid over the objects, with cells a little larger than the gate so that
+  // the pairs within the gate are in neighbor cells despite the rounding
+  const float cell_size =
+      track_object_distance_->euclidean_distance_threshold() * 1.01f;
+  bool use_grid = cell_size > 0.f;
+  std::vector<std::pair<int64_t, size_t>> object_cells;
+  for (size_t j = 0; use_grid && j < new_objects.size(); ++j) {
+    const Eigen::Vector3f barycenter = new_objects[j]->barycenter.cast<float>();
+    int64_t cell_x = 0;
+    int64_t cell_y = 0;
+    use_grid = CellCoord(barycenter(0), barycenter(1), cell_size, &cell_x,
+                         &cell_y);
+    object_cells.emplace_back(CellKey(cell_x, cell_y), j);
+  }
+  std::sort(object_cells.begin(), object_cells.end());
+
+  const float out_gate_cost = track_object_distance_->out_gate_match_cost();
+  auto compute_rows = [&](size_t begin, size_t end) {
+    std::vector<size_t> candidates;
+    for (size_t i = begin; i < end; ++i) {
+      candidates.clear();
+      int64_t cell_x = 0;
+      int64_t cell_y = 0;
+      if (use_grid && CellCoord(track_predicts[i](0), track_predicts[i](1),
+                                cell_size, &cell_x, &cell_y)) {
+        for (int64_t dx = -1; dx <= 1; ++dx) {
+          for (int64_t dy = -1; dy <= 1; ++dy) {
+            const int64_t key = CellKey(cell_x + dx, cell_y + dy);
+            for (auto iter = std::lower_bound(
+                     object_cells.begin(), object_cells.end(),
+                     std::make_pair(key, static_cast<size_t>(0)));
+                 iter != object_cells.end() && iter->first == key; ++iter) {
+              candidates.push_back(iter->second);
+            }
+          }
+        }
+      } else {
+        candidates.resize(new_objects.size());
+        std::iota(candidates.begin(), candidates.end(), 0);
+      }
+      for (size_t j = 0; j < new_objects.size(); ++j) {
+        (*association_mat)(i, j) = out_gate_cost;
+      }
+      for (const size_t j : candidates) {
+        const std::vector<float> &pair_weights =
+            *weights[(track_sensors[i] * sensor_num + object_sensors[j]) * 2 +
+                     (new_objects[j]->is_background ? 1 : 0)];
+        (*association_mat)(i, j) = track_object_distance_->ComputeDistance(
+            new_objects[j], tracks[i], track_predicts[i], pair_weights);
+      }
+    }
+  };
+
+  const size_t thread_num = std::min(association_thread_num_, tracks.size());
+  if (thread_num <= 1) {
+    compute_rows(0, tracks.size());
+    return;
+  }
+  std::vector<std::future<void>> results;
+  const size_t rows_per_thread = (tracks.size() + thread_num - 1) / thread_num;
+  for (size_t begin = 0; begin < tracks.size(); begin += rows_per_thread) {
+    const size_t end = std::min(begin + rows_per_thread, tracks.size());
+    results.push_back(
+        cyber::Async([&compute_rows, begin, end]() {
+          compute_rows(begin, end);
+        }));
+  }
+  for (auto &result : results) {
+    result.get();
+  }
+}
+
 }  // namespace lidar
 }  // namespace perception
 }  // namespace apollo
@@ -87,6 +87,20 @@ class MlfTrackObjectMatcher {
                               const std::vector<TrackedObjectPtr> &new_objects,
                               algorithm::SecureMat<float> *association_mat);
 
+  /**
+   * @brief Compute association matrix with each track predicted once, and
+   * only the pairs close enough to pass the euclidean gate scored. The rows
+   * are scored on association_thread_num_ threads.
+   *
+   * @param tracks maintained tracks for matching
+   * @param new_objects new detected objects for matching
+   * @param association_mat matrix of association distance
+   */
+  void ComputeGatedAssociateMatrix(
+      const std::vector<MlfTrackDataPtr> &tracks,
+      const std::vector<TrackedObjectPtr> &new_objects,
+      algorithm::SecureMat<float> *association_mat);
+
  protected:
   std::unique_ptr<MlfTrackObjectDistance> track_object_distance_;
   BaseBipartiteGraphMatcher *foreground_matcher_;
@@ -95,6 +109,9 @@ class MlfTrackObjectMatcher {
   float bound_value_ = 100.f;
   float max_match_distance_ = 4.0f;
   bool use_semantic_map = false;
+  bool use_association_grid_ = false;
+  size_t association_thread_num_ = 1;
+  size_t sparse_component_size_ = 0;
 
  private:
   DISALLOW_COPY_AND_ASSIGN(MlfTrackObjectMatcher);
@@ -0,0 +1,148 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/perception/lidar_tracking/tracker/multi_lidar_fusion/mlf_track_object_matcher.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace lidar {
+
+class MlfTrackObjectMatcherTest : public testing::Test {
+ protected:
+  // Exposes both association matrices, with the default distance weights.
+  class TestMatcher : public MlfTrackObjectMatcher {
+   public:
+    TestMatcher() {
+      track_object_distance_.reset(new MlfTrackObjectDistance);
+    }
+    void ComputeAssociateMatrix(
+        const std::vector<MlfTrackDataPtr> &tracks,
+        const std::vector<TrackedObjectPtr> &new_objects,
+        algorithm::SecureMat<float> *association_mat) {
+      MlfTrackObjectMatcher::ComputeAssociateMatrix(tracks, new_objects,
+                                                    association_mat);
+    }
+    void ComputeGatedAssociateMatrix(
+        const size_t thread_num, const std::vector<MlfTrackDataPtr> &tracks,
+        const std::vector<TrackedObjectPtr> &new_objects,
+        algorithm::SecureMat<float> *association_mat) {
+      association_thread_num_ = thread_num;
+      MlfTrackObjectMatcher::ComputeGatedAssociateMatrix(tracks, new_objects,
+                                                         association_mat);
+    }
+  };
+
+  TrackedObjectPtr MakeObject(const double timestamp, const double x,
+                              const double y) {
+    std::uniform_real_distribution<double> noise(-1.0, 1.0);
+    std::bernoulli_distribution flip(0.5);
+    auto object = std::make_shared<base::Object>();
+    object->latest_tracked_time = timestamp;
+    object->center = Eigen::Vector3d(x, y, 0.0);
+    object->anchor_point = object->center;
+    object->size = Eigen::Vector3f(4.0f, 2.0f, 1.5f);
+    object->direction = Eigen::Vector3f(1.0f, 0.0f, 0.0f);
+    object->velocity = Eigen::Vector3f(static_cast<float>(noise(rng_)),
+                                       static_cast<float>(noise(rng_)), 0.0f);
+    for (int k = 0; k < 10; ++k) {
+      base::PointF point;
+      point.x = static_cast<float>(x + noise(rng_));
+      point.y = static_cast<float>(y + noise(rng_));
+      object->lidar_supplement.cloud.push_back(point);
+      object->lidar_supplement.cloud_world.push_back(
+          base::PointD{point.x, point.y, 0.0});
+    }
+    object->polygon.resize(4);
+    auto tracked_object = std::make_shared<TrackedObject>();
+    tracked_object->AttachObject(object, Eigen::Affine3d::Identity(),
+                                 Eigen::Vector3d::Zero(), base::SensorInfo(),
+                                 timestamp);
+    tracked_object->sensor_info.name = flip(rng_) ? "velodyne64" : "velodyne16";
+    tracked_object->is_background = flip(rng_);
+    tracked_object->output_velocity =
+        Eigen::Vector3d(noise(rng_), noise(rng_), 0.0);
+    tracked_object->belief_anchor_point = tracked_object->anchor_point;
+    return tracked_object;
+  }
+
+  // Tracks spread over the area, each observed again close to its last
+  // position, and objects without a track.
+  void MakeScene(const size_t num_tracks, const size_t num_new_objects) {
+    std::uniform_real_distribution<double> position(-60.0, 60.0);
+    std::uniform_real_distribution<double> motion(-1.5, 1.5);
+    tracks_.clear();
+    objects_.clear();
+    for (size_t i = 0; i < num_tracks; ++i) {
+      const double x = position(rng_);
+      const double y = position(rng_);
+      auto track = std::make_shared<MlfTrackData>();
+      track->Reset();
+      track->PushTrackedObjectToTrack(MakeObject(1.0, x, y));
+      track->age_ = 3;
+      track->latest_visible_time_ = 1.0;
+      tracks_.push_back(track);
+      objects_.push_back(MakeObject(1.1, x + motion(rng_), y + motion(rng_)));
+    }
+    for (size_t j = 0; j < num_new_objects; ++j) {
+      objects_.push_back(MakeObject(1.1, position(rng_), position(rng_)));
+    }
+    std::shuffle(objects_.begin(), objects_.end(), rng_);
+  }
+
+  std::mt19937 rng_{2024};
+  std::vector<MlfTrackDataPtr> tracks_;
+  std::vector<TrackedObjectPtr> objects_;
+};
+
+TEST_F(MlfTrackObjectMatcherTest, GatedMatrixEqualsFullMatrix) {
+  TestMatcher matcher;
+  for (int scene = 0; scene < 5; ++scene) {
+    MakeScene(50 * (scene + 1), 10 * scene);
+    algorithm::SecureMat<float> full_mat;
+    full_mat.Resize(tracks_.size(), objects_.size());
+    matcher.ComputeAssociateMatrix(tracks_, objects_, &full_mat);
+    for (const size_t thread_num : {1, 4}) {
+      algorithm::SecureMat<float> gated_mat;
+      gated_mat.Resize(tracks_.size(), objects_.size());
+      matcher.ComputeGatedAssociateMatrix(thread_num, tracks_, objects_,
+                                          &gated_mat);
+      size_t in_gate = 0;
+      for (size_t i = 0; i < tracks_.size(); ++i) {
+        for (size_t j = 0; j < objects_.size(); ++j) {
+          ASSERT_EQ(full_mat(i, j), gated_mat(i, j))
+              << "track " << i << " object " << j << " threads "
+              << thread_num;
+          if (full_mat(i, j) < 4.0f) {
+            ++in_gate;
+          }
+        }
+      }
+      // the tracks are matched by their own objects at least
+      EXPECT_GE(in_gate, tracks_.size() / 2);
+    }
+  }
+}
+
+}  // namespace lidar
+}  // namespace perception
+}  // namespace apollo
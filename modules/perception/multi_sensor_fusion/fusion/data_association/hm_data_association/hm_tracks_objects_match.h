@@ -15,11 +15,13 @@
  *****************************************************************************/
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
 #include "cyber/common/macros.h"
 #include "modules/perception/common/algorithm/graph/gated_hungarian_bigraph_matcher.h"
+#include "modules/perception/common/perception_gflags.h"
 #include "modules/perception/multi_sensor_fusion/fusion/data_association/hm_data_association/track_object_distance.h"
 #include "modules/perception/multi_sensor_fusion/interface/base_data_association.h"
 
@@ -42,6 +44,10 @@ class HMTrackersObjectsAssociation : public BaseDataAssociation {
   bool Init(const AssociationInitOptions &options) override {
     track_object_distance_.set_distance_thresh(
         static_cast<float>(s_match_distance_thresh_));
+    optimizer_.set_sparse_component_size(
+        static_cast<size_t>(std::max(FLAGS_hm_sparse_component_size, 0)));
+    optimizer_.set_num_threads(
+        static_cast<size_t>(std::max(FLAGS_hm_assignment_num_threads, 1)));
     return true;
   }
 
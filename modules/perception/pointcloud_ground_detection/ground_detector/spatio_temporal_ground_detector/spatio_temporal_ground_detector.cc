@@ -78,6 +78,7 @@ bool SpatioTemporalGroundDetector::Init(
   param_->use_math_optimize = config_params.use_math_optimize();
   param_->debug_output = config_params.debug_output();
   param_->single_frame_detect = config_params.single_ground_detect();
+  param_->nr_threads = config_params.nr_threads();
 
   pfdetector_ = new algorithm::PlaneFitGroundDetector(*param_);
   pfdetector_->Init();
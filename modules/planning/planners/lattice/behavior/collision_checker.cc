@@ -37,6 +37,7 @@ using apollo::common::PathPoint;
 using apollo::common::TrajectoryPoint;
 using apollo::common::math::Box2d;
 using apollo::common::math::PathMatcher;
+using apollo::common::math::ShapeKDTree2d;
 using apollo::common::math::Vec2d;
 
 CollisionChecker::CollisionChecker(
@@ -84,7 +85,7 @@ bool CollisionChecker::InCollision(
 }
 
 bool CollisionChecker::InCollision(
-    const DiscretizedTrajectory& discretized_trajectory) {
+    const DiscretizedTrajectory& discretized_trajectory) const {
   CHECK_LE(discretized_trajectory.NumOfPoints(),
            predicted_bounding_rectangles_.size());
   const auto& vehicle_config =
@@ -105,8 +106,9 @@ bool CollisionChecker::InCollision(
                     shift_distance * std::sin(ego_theta)};
     ego_box.Shift(shift_vec);
 
-    for (const auto& obstacle_box : predicted_bounding_rectangles_[i]) {
-      if (ego_box.HasOverlap(obstacle_box)) {
+    for (const auto* obstacle_box :
+         predicted_box_indices_[i]->GetOverlapCandidates(ego_box)) {
+      if (ego_box.HasOverlap(obstacle_box->shape())) {
         return true;
       }
     }
@@ -153,6 +155,12 @@ void CollisionChecker::BuildPredictedEnvironment(
     predicted_bounding_rectangles_.push_back(std::move(predicted_env));
     relative_time += FLAGS_trajectory_time_resolution;
   }
+
+  predicted_box_indices_.reserve(predicted_bounding_rectangles_.size());
+  for (const auto& predicted_env : predicted_bounding_rectangles_) {
+    predicted_box_indices_.push_back(
+        std::make_shared<const ShapeKDTree2d<Box2d>>(predicted_env));
+  }
 }
 
 bool CollisionChecker::IsEgoVehicleInLane(const double ego_vehicle_s,
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "modules/common/math/box2d.h"
+#include "modules/common/math/shape_kdtree2d.h"
 #include "modules/planning/planners/lattice/behavior/path_time_graph.h"
 #include "modules/planning/planning_base/common/obstacle.h"
 #include "modules/planning/planning_base/common/reference_line_info.h"
@@ -41,7 +42,7 @@ class CollisionChecker {
       const ReferenceLineInfo* ptr_reference_line_info,
       const std::shared_ptr<PathTimeGraph>& ptr_path_time_graph);
 
-  bool InCollision(const DiscretizedTrajectory& discretized_trajectory);
+  bool InCollision(const DiscretizedTrajectory& discretized_trajectory) const;
 
   static bool InCollision(const std::vector<const Obstacle*>& obstacles,
                           const DiscretizedTrajectory& ego_trajectory,
@@ -65,6 +66,11 @@ class CollisionChecker {
   const ReferenceLineInfo* ptr_reference_line_info_;
   std::shared_ptr<PathTimeGraph> ptr_path_time_graph_;
   std::vector<std::vector<common::math::Box2d>> predicted_bounding_rectangles_;
+  // kd-trees over the predicted obstacle boxes of each time step, immutable
+  // once built so that the copies of the checker can share them.
+  std::vector<std::shared_ptr<const common::math::ShapeKDTree2d<
+      common::math::Box2d>>>
+      predicted_box_indices_;
 };
 
 }  // namespace planning
@@ -20,6 +20,7 @@
 
 #include "modules/planning/planners/lattice/lattice_planner.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -34,9 +35,9 @@
 #include "modules/planning/planners/lattice/behavior/path_time_graph.h"
 #include "modules/planning/planners/lattice/behavior/prediction_querier.h"
 #include "modules/planning/planners/lattice/trajectory_generation/backup_trajectory_generator.h"
+#include "modules/planning/planners/lattice/trajectory_generation/candidate_evaluator.h"
 #include "modules/planning/planners/lattice/trajectory_generation/lattice_trajectory1d.h"
 #include "modules/planning/planners/lattice/trajectory_generation/trajectory1d_generator.h"
-#include "modules/planning/planners/lattice/trajectory_generation/trajectory_combiner.h"
 #include "modules/planning/planners/lattice/trajectory_generation/trajectory_evaluator.h"
 #include "modules/planning/planning_base/gflags/planning_gflags.h"
 #include "modules/planning/planning_base/math/constraint_checker/constraint_checker.h"
@@ -233,104 +234,126 @@ Status LatticePlanner::PlanOnReferenceLine(
 
   size_t num_lattice_traj = 0;
 
-  while (trajectory_evaluator.has_more_trajectory_pairs()) {
-    double trajectory_pair_cost =
-        trajectory_evaluator.top_trajectory_pair_cost();
-    auto trajectory_pair = trajectory_evaluator.next_top_trajectory_pair();
-
-    // combine two 1d trajectories to one 2d trajectory
-    auto combined_trajectory = TrajectoryCombiner::Combine(
-        *ptr_reference_line, *trajectory_pair.first, *trajectory_pair.second,
-        planning_init_point.relative_time());
-
-    // check longitudinal and lateral acceleration
-    // considering trajectory curvatures
-    auto result = ConstraintChecker::ValidTrajectory(combined_trajectory);
-    if (result != ConstraintChecker::Result::VALID) {
-      ++combined_constraint_failure_count;
-
-      switch (result) {
-        case ConstraintChecker::Result::LON_VELOCITY_OUT_OF_BOUND:
-          lon_vel_failure_count += 1;
-          break;
-        case ConstraintChecker::Result::LON_ACCELERATION_OUT_OF_BOUND:
-          lon_acc_failure_count += 1;
-          break;
-        case ConstraintChecker::Result::LON_JERK_OUT_OF_BOUND:
-          lon_jerk_failure_count += 1;
-          break;
-        case ConstraintChecker::Result::CURVATURE_OUT_OF_BOUND:
-          curvature_failure_count += 1;
-          break;
-        case ConstraintChecker::Result::LAT_ACCELERATION_OUT_OF_BOUND:
-          lat_acc_failure_count += 1;
-          break;
-        case ConstraintChecker::Result::LAT_JERK_OUT_OF_BOUND:
-          lat_jerk_failure_count += 1;
-          break;
-        case ConstraintChecker::Result::VALID:
-        default:
-          // Intentional empty
-          break;
-      }
-      continue;
+  // the best pairs are combined and checked in batches, the first feasible
+  // pair of a batch in cost order is taken, same as checking one by one.
+  const size_t candidate_batch_size =
+      static_cast<size_t>(std::max(1, FLAGS_lattice_parallel_candidate_num));
+  std::vector<CandidateEvaluator::TrajectoryPair> candidate_pairs;
+  std::vector<double> candidate_costs;
+  std::vector<CandidateEvaluation> candidate_evaluations;
+  const CandidateEvaluator candidate_evaluator(
+      *ptr_reference_line, planning_init_point.relative_time(),
+      [&collision_checker](const DiscretizedTrajectory& trajectory) {
+        return collision_checker.InCollision(trajectory);
+      });
+  bool found_trajectory = false;
+
+  while (!found_trajectory &&
+         trajectory_evaluator.has_more_trajectory_pairs()) {
+    candidate_pairs.clear();
+    candidate_costs.clear();
+    while (candidate_pairs.size() < candidate_batch_size &&
+           trajectory_evaluator.has_more_trajectory_pairs()) {
+      candidate_costs.push_back(
+          trajectory_evaluator.top_trajectory_pair_cost());
+      candidate_pairs.push_back(
+          trajectory_evaluator.next_top_trajectory_pair());
     }
+    candidate_evaluator.EvaluateBatch(candidate_pairs, &candidate_evaluations);
+
+    for (size_t i = 0; i < candidate_pairs.size(); ++i) {
+      const double trajectory_pair_cost = candidate_costs[i];
+      const auto& trajectory_pair = candidate_pairs[i];
+      const auto& combined_trajectory = candidate_evaluations[i].trajectory;
+      const auto result = candidate_evaluations[i].result;
+      if (result != ConstraintChecker::Result::VALID) {
+        ++combined_constraint_failure_count;
+
+        switch (result) {
+          case ConstraintChecker::Result::LON_VELOCITY_OUT_OF_BOUND:
+            lon_vel_failure_count += 1;
+            break;
+          case ConstraintChecker::Result::LON_ACCELERATION_OUT_OF_BOUND:
+            lon_acc_failure_count += 1;
+            break;
+          case ConstraintChecker::Result::LON_JERK_OUT_OF_BOUND:
+            lon_jerk_failure_count += 1;
+            break;
+          case ConstraintChecker::Result::CURVATURE_OUT_OF_BOUND:
+            curvature_failure_count += 1;
+            break;
+          case ConstraintChecker::Result::LAT_ACCELERATION_OUT_OF_BOUND:
+            lat_acc_failure_count += 1;
+            break;
+          case ConstraintChecker::Result::LAT_JERK_OUT_OF_BOUND:
+            lat_jerk_failure_count += 1;
+            break;
+          case ConstraintChecker::Result::VALID:
+          default:
+            // Intentional empty
+            break;
+        }
+        continue;
+      }
 
-    // check collision with other obstacles
-    if (collision_checker.InCollision(combined_trajectory)) {
-      ++collision_failure_count;
-      continue;
-    }
+      if (candidate_evaluations[i].in_collision) {
+        ++collision_failure_count;
+        continue;
+      }
 
-    // put combine trajectory into debug data
-    const auto& combined_trajectory_points = combined_trajectory;
-    num_lattice_traj += 1;
-    reference_line_info->SetTrajectory(combined_trajectory);
-    reference_line_info->SetCost(reference_line_info->PriorityCost() +
-                                 trajectory_pair_cost);
-    reference_line_info->SetDrivable(true);
+      // put combine trajectory into debug data
+      const auto& combined_trajectory_points = combined_trajectory;
+      num_lattice_traj += 1;
+      reference_line_info->SetTrajectory(combined_trajectory);
+      reference_line_info->SetCost(reference_line_info->PriorityCost() +
+                                   trajectory_pair_cost);
+      reference_line_info->SetDrivable(true);
 
-    // Print the chosen end condition and start condition
-    ADEBUG << "Starting Lon. State: s = " << init_s[0] << " ds = " << init_s[1]
-           << " dds = " << init_s[2];
-    // cast
-    auto lattice_traj_ptr =
-        std::dynamic_pointer_cast<LatticeTrajectory1d>(trajectory_pair.first);
-    if (!lattice_traj_ptr) {
-      ADEBUG << "Dynamically casting trajectory1d ptr. failed.";
-    }
+      // Print the chosen end condition and start condition
+      ADEBUG << "Starting Lon. State: s = " << init_s[0]
+             << " ds = " << init_s[1] << " dds = " << init_s[2];
+      // cast
+      auto lattice_traj_ptr =
+          std::dynamic_pointer_cast<LatticeTrajectory1d>(trajectory_pair.first);
+      if (!lattice_traj_ptr) {
+        ADEBUG << "Dynamically casting trajectory1d ptr. failed.";
+      }
 
-    if (lattice_traj_ptr->has_target_position()) {
-      ADEBUG << "Ending Lon. State s = " << lattice_traj_ptr->target_position()
-             << " ds = " << lattice_traj_ptr->target_velocity()
-             << " t = " << lattice_traj_ptr->target_time();
-    }
+      if (lattice_traj_ptr->has_target_position()) {
+        ADEBUG << "Ending Lon. State s = "
+               << lattice_traj_ptr->target_position()
+               << " ds = " << lattice_traj_ptr->target_velocity()
+               << " t = " << lattice_traj_ptr->target_time();
+      }
 
-    ADEBUG << "InputPose";
-    ADEBUG << "XY: " << planning_init_point.ShortDebugString();
-    ADEBUG << "S: (" << init_s[0] << ", " << init_s[1] << "," << init_s[2]
-           << ")";
-    ADEBUG << "L: (" << init_d[0] << ", " << init_d[1] << "," << init_d[2]
-           << ")";
-
-    ADEBUG << "Reference_line_priority_cost = "
-           << reference_line_info->PriorityCost();
-    ADEBUG << "Total_Trajectory_Cost = " << trajectory_pair_cost;
-    ADEBUG << "OutputTrajectory";
-    for (uint i = 0; i < 10; ++i) {
-      ADEBUG << combined_trajectory_points[i].ShortDebugString();
-    }
+      ADEBUG << "InputPose";
+      ADEBUG << "XY: " << planning_init_point.ShortDebugString();
+      ADEBUG << "S: (" << init_s[0] << ", " << init_s[1] << "," << init_s[2]
+             << ")";
+      ADEBUG << "L: (" << init_d[0] << ", " << init_d[1] << "," << init_d[2]
+             << ")";
+
+      ADEBUG << "Reference_line_priority_cost = "
+             << reference_line_info->PriorityCost();
+      ADEBUG << "Total_Trajectory_Cost = " << trajectory_pair_cost;
+      ADEBUG << "OutputTrajectory";
+      for (uint k = 0; k < 10; ++k) {
+        ADEBUG << combined_trajectory_points[k].ShortDebugString();
+      }
 
-    break;
-    /*
-    auto combined_trajectory_path =
-        ptr_debug->mutable_planning_data()->add_trajectory_path();
-    for (uint i = 0; i < combined_trajectory_points.size(); ++i) {
-      combined_trajectory_path->add_trajectory_point()->CopyFrom(
-          combined_trajectory_points[i]);
+      found_trajectory = true;
+      break;
+      /*
+      auto combined_trajectory_path =
+          ptr_debug->mutable_planning_data()->add_trajectory_path();
+      for (uint i = 0; i < combined_trajectory_points.size(); ++i) {
+        combined_trajectory_path->add_trajectory_point()->CopyFrom(
+            combined_trajectory_points[i]);
+      }
+      combined_trajectory_path->set_lattice_trajectory_cost(
+          trajectory_pair_cost);
+      */
     }
-    combined_trajectory_path->set_lattice_trajectory_cost(trajectory_pair_cost);
-    */
   }
 
   ADEBUG << "Trajectory_Evaluation_Time = "
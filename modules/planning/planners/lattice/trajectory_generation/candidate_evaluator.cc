@@ -0,0 +1,70 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/planners/lattice/trajectory_generation/candidate_evaluator.h"
+
+#include "modules/planning/planners/lattice/trajectory_generation/trajectory_combiner.h"
+#include "modules/planning/planning_base/common/util/planning_thread_pool.h"
+
+namespace apollo {
+namespace planning {
+
+CandidateEvaluator::CandidateEvaluator(
+    const std::vector<common::PathPoint>& reference_line,
+    const double init_relative_time,
+    const std::function<bool(const DiscretizedTrajectory&)>& in_collision)
+    : reference_line_(reference_line),
+      init_relative_time_(init_relative_time),
+      in_collision_(in_collision) {}
+
+void CandidateEvaluator::Evaluate(const TrajectoryPair& trajectory_pair,
+                                  CandidateEvaluation* evaluation) const {
+  // combine two 1d trajectories to one 2d trajectory
+  evaluation->trajectory = TrajectoryCombiner::Combine(
+      reference_line_, *trajectory_pair.first, *trajectory_pair.second,
+      init_relative_time_);
+
+  // check longitudinal and lateral acceleration
+  // considering trajectory curvatures
+  evaluation->result =
+      ConstraintChecker::ValidTrajectory(evaluation->trajectory);
+  if (evaluation->result != ConstraintChecker::Result::VALID) {
+    evaluation->in_collision = false;
+    return;
+  }
+
+  // check collision with other obstacles
+  evaluation->in_collision = in_collision_(evaluation->trajectory);
+}
+
+void CandidateEvaluator::EvaluateBatch(
+    const std::vector<TrajectoryPair>& trajectory_pairs,
+    std::vector<CandidateEvaluation>* evaluations) const {
+  evaluations->clear();
+  evaluations->resize(trajectory_pairs.size());
+  // a single pair is evaluated by the caller
+  PlanningThreadPool::ParallelFor(
+      0, trajectory_pairs.size(), 1, [&](size_t i) {
+        Evaluate(trajectory_pairs[i], &(*evaluations)[i]);
+      });
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,76 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "modules/common_msgs/basic_msgs/pnc_point.pb.h"
+
+#include "modules/planning/planning_base/common/trajectory/discretized_trajectory.h"
+#include "modules/planning/planning_base/math/constraint_checker/constraint_checker.h"
+#include "modules/planning/planning_base/math/curve1d/curve1d.h"
+
+namespace apollo {
+namespace planning {
+
+struct CandidateEvaluation {
+  DiscretizedTrajectory trajectory;
+  ConstraintChecker::Result result = ConstraintChecker::Result::VALID;
+  bool in_collision = false;
+};
+
+/**
+ * @class CandidateEvaluator
+ * @brief Combines the longitudinal and lateral trajectories of the candidate
+ * pairs, and checks the combined trajectories against the constraints and
+ * the obstacles.
+ */
+class CandidateEvaluator {
+ public:
+  typedef std::pair<std::shared_ptr<Curve1d>, std::shared_ptr<Curve1d>>
+      TrajectoryPair;
+
+  CandidateEvaluator(
+      const std::vector<common::PathPoint>& reference_line,
+      const double init_relative_time,
+      const std::function<bool(const DiscretizedTrajectory&)>& in_collision);
+
+  void Evaluate(const TrajectoryPair& trajectory_pair,
+                CandidateEvaluation* evaluation) const;
+
+  /**
+   * @brief Evaluate a batch of pairs, on the planning thread pool if there
+   * are several. The collision check must be safe to run concurrently.
+   */
+  void EvaluateBatch(const std::vector<TrajectoryPair>& trajectory_pairs,
+                     std::vector<CandidateEvaluation>* evaluations) const;
+
+ private:
+  const std::vector<common::PathPoint>& reference_line_;
+  const double init_relative_time_;
+  std::function<bool(const DiscretizedTrajectory&)> in_collision_;
+};
+
+}  // namespace planning
+}  // namespace apollo
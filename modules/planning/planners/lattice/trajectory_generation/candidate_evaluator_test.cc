@@ -0,0 +1,157 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/planners/lattice/trajectory_generation/candidate_evaluator.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "modules/common/math/box2d.h"
+#include "modules/planning/planners/lattice/trajectory_generation/lattice_trajectory1d.h"
+#include "modules/planning/planning_base/gflags/planning_gflags.h"
+#include "modules/planning/planning_base/math/curve1d/quartic_polynomial_curve1d.h"
+#include "modules/planning/planning_base/math/curve1d/quintic_polynomial_curve1d.h"
+
+namespace apollo {
+namespace planning {
+
+using apollo::common::PathPoint;
+using apollo::common::math::Box2d;
+using apollo::common::math::Vec2d;
+
+namespace {
+
+std::vector<PathPoint> StraightReferenceLine() {
+  std::vector<PathPoint> reference_line;
+  for (double s = 0.0; s <= 200.0; s += 0.5) {
+    PathPoint point;
+    point.set_x(s);
+    point.set_y(0.0);
+    point.set_theta(0.0);
+    point.set_kappa(0.0);
+    point.set_dkappa(0.0);
+    point.set_s(s);
+    reference_line.push_back(point);
+  }
+  return reference_line;
+}
+
+// the pairs of lateral offsets and target speeds, in a fixed order standing
+// for the cost order, of which the first ones collide with an obstacle ahead
+// or break the constraints
+std::vector<CandidateEvaluator::TrajectoryPair> CandidatePairs() {
+  std::vector<CandidateEvaluator::TrajectoryPair> pairs;
+  for (const double d : {3.5, 0.0, 0.5, -0.5, -1.5}) {
+    for (const double v : {30.0, 12.0, 10.0, 6.0, 0.0}) {
+      auto lon = std::make_shared<LatticeTrajectory1d>(
+          std::make_shared<QuarticPolynomialCurve1d>(0.0, 10.0, 0.0, v, 0.0,
+                                                     FLAGS_trajectory_time_length));
+      auto lat = std::make_shared<LatticeTrajectory1d>(
+          std::make_shared<QuinticPolynomialCurve1d>(0.0, 0.0, 0.0, d, 0.0,
+                                                     0.0, 30.0));
+      pairs.emplace_back(lon, lat);
+    }
+  }
+  return pairs;
+}
+
+bool InCollision(const DiscretizedTrajectory& trajectory) {
+  const Box2d obstacle(Vec2d(45.0, 0.0), 0.0, 4.0, 8.0);
+  for (const auto& point : trajectory) {
+    const Box2d ego(Vec2d(point.path_point().x(), point.path_point().y()),
+                    point.path_point().theta(), 4.0, 2.0);
+    if (ego.HasOverlap(obstacle)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// the index of the first feasible pair in cost order, as the lattice planner
+// picks it
+size_t FirstFeasible(const std::vector<CandidateEvaluation>& evaluations) {
+  for (size_t i = 0; i < evaluations.size(); ++i) {
+    if (evaluations[i].result == ConstraintChecker::Result::VALID &&
+        !evaluations[i].in_collision) {
+      return i;
+    }
+  }
+  return evaluations.size();
+}
+
+}  // namespace
+
+TEST(CandidateEvaluatorTest, BatchPicksSameAsSerial) {
+  FLAGS_planning_thread_pool_size = 4;
+  const std::vector<PathPoint> reference_line = StraightReferenceLine();
+  const std::vector<CandidateEvaluator::TrajectoryPair> pairs =
+      CandidatePairs();
+  const CandidateEvaluator evaluator(reference_line, 0.0, &InCollision);
+
+  // one by one
+  std::vector<CandidateEvaluation> serial_evaluations(pairs.size());
+  for (size_t i = 0; i < pairs.size(); ++i) {
+    evaluator.Evaluate(pairs[i], &serial_evaluations[i]);
+  }
+  const size_t serial_index = FirstFeasible(serial_evaluations);
+  ASSERT_LT(serial_index, pairs.size());
+  ASSERT_GT(serial_index, 0u);
+
+  for (const size_t batch_size : {2, 4, 7}) {
+    size_t begin = 0;
+    size_t parallel_index = pairs.size();
+    std::vector<CandidateEvaluation> evaluations;
+    while (parallel_index == pairs.size() && begin < pairs.size()) {
+      const size_t end = std::min(begin + batch_size, pairs.size());
+      evaluator.EvaluateBatch(
+          std::vector<CandidateEvaluator::TrajectoryPair>(
+              pairs.begin() + begin, pairs.begin() + end),
+          &evaluations);
+      for (size_t i = 0; i < evaluations.size(); ++i) {
+        EXPECT_EQ(serial_evaluations[begin + i].result, evaluations[i].result);
+        EXPECT_EQ(serial_evaluations[begin + i].in_collision,
+                  evaluations[i].in_collision);
+      }
+      const size_t index = FirstFeasible(evaluations);
+      if (index < evaluations.size()) {
+        parallel_index = begin + index;
+      }
+      begin = end;
+    }
+    EXPECT_EQ(serial_index, parallel_index) << "batch size " << batch_size;
+
+    const size_t index = parallel_index - (begin - evaluations.size());
+    const DiscretizedTrajectory& expected =
+        serial_evaluations[serial_index].trajectory;
+    const DiscretizedTrajectory& actual = evaluations[index].trajectory;
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(expected[i].path_point().x(), actual[i].path_point().x());
+      EXPECT_EQ(expected[i].path_point().y(), actual[i].path_point().y());
+      EXPECT_EQ(expected[i].v(), actual[i].v());
+    }
+  }
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -214,15 +214,23 @@ bool PathData::XYToSL(const DiscretizedPath &discretized_path,
   ACHECK(reference_line_);
   std::vector<common::FrenetFramePoint> frenet_frame_points;
   const double max_len = reference_line_->Length();
+  // Project the whole path at once, the path points are close to each other.
+  std::vector<common::math::Vec2d> xy_points;
+  xy_points.reserve(discretized_path.size());
   for (const auto &path_point : discretized_path) {
+    xy_points.emplace_back(path_point.x(), path_point.y());
+  }
+  std::vector<SLPoint> sl_points;
+  if (!reference_line_->XYToSL(xy_points, &sl_points)) {
+    AERROR << "Fail to transfer cartesian point to frenet point.";
+    return false;
+  }
+  for (size_t i = 0; i < discretized_path.size(); ++i) {
+    const auto &path_point = discretized_path[i];
+    const auto &sl_point = sl_points[i];
     common::FrenetFramePoint frenet_point =
-        reference_line_->GetFrenetPoint(path_point);
+        reference_line_->GetFrenetPoint(path_point, sl_point);
     if (!frenet_point.has_s()) {
-      SLPoint sl_point;
-      if (!reference_line_->XYToSL(path_point, &sl_point)) {
-        AERROR << "Fail to transfer cartesian point to frenet point.";
-        return false;
-      }
       common::FrenetFramePoint frenet_point;
       // NOTICE: does not set dl and ddl here. Add if needed.
       frenet_point.set_s(std::max(0.0, std::min(sl_point.s(), max_len)));
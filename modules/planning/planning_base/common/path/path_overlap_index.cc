@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file path_overlap_index.cc
+ **/
+
+#include "modules/planning/planning_base/common/path/path_overlap_index.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace apollo {
+namespace planning {
+
+using apollo::common::PathPoint;
+using apollo::common::math::AABox2d;
+using apollo::common::math::Box2d;
+using apollo::common::math::Polygon2d;
+using apollo::common::math::ShapeKDTree2d;
+using apollo::common::math::Vec2d;
+
+namespace {
+// Slack of the broad phase search radius, it only adds candidates, so the
+// exact tests with their own tolerances never miss an overlap.
+constexpr double kSearchBuffer = 0.1;
+}  // namespace
+
+PathOverlapIndex::PathOverlapIndex(
+    const std::vector<PathPoint>& path_points,
+    const common::VehicleParam& vehicle_param, const double l_buffer) {
+  if (path_points.empty()) {
+    return;
+  }
+  std::vector<Box2d> adc_boxes;
+  adc_boxes.reserve(path_points.size());
+  for (size_t i = 0; i < path_points.size(); ++i) {
+    const PathPoint& path_point = path_points[i];
+    // Convert reference point from center of rear axis to center of ADC.
+    Vec2d ego_center_map_frame((vehicle_param.front_edge_to_center() -
+                                vehicle_param.back_edge_to_center()) *
+                                   0.5,
+                               (vehicle_param.left_edge_to_center() -
+                                vehicle_param.right_edge_to_center()) *
+                                   0.5);
+    ego_center_map_frame.SelfRotate(path_point.theta());
+    ego_center_map_frame.set_x(ego_center_map_frame.x() + path_point.x());
+    ego_center_map_frame.set_y(ego_center_map_frame.y() + path_point.y());
+    adc_boxes.emplace_back(ego_center_map_frame, path_point.theta(),
+                           vehicle_param.length(),
+                           vehicle_param.width() + l_buffer * 2);
+  }
+  kdtree_.reset(new ShapeKDTree2d<Box2d>(adc_boxes));
+}
+
+std::vector<size_t> PathOverlapIndex::GetCandidateIndices(
+    const Box2d& obs_box) const {
+  return GetCandidateIndices(obs_box.center(), obs_box.diagonal() / 2.0);
+}
+
+std::vector<size_t> PathOverlapIndex::GetCandidateIndices(
+    const Polygon2d& obs_polygon) const {
+  if (obs_polygon.num_points() == 0) {
+    return {};
+  }
+  const AABox2d aabox = obs_polygon.AABoundingBox();
+  return GetCandidateIndices(aabox.center(),
+                             std::hypot(aabox.length(), aabox.width()) / 2.0);
+}
+
+std::vector<size_t> PathOverlapIndex::GetCandidateIndices(
+    const Vec2d& center, const double radius) const {
+  std::vector<size_t> indices;
+  if (kdtree_ == nullptr) {
+    return indices;
+  }
+  // an ADC box overlapping with the obstacle is within the radius of the
+  // obstacle from its center
+  for (const auto* adc_box :
+       kdtree_->GetObjects(center, radius + kSearchBuffer)) {
+    indices.push_back(adc_box->index());
+  }
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file path_overlap_index.h
+ **/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "modules/common_msgs/basic_msgs/pnc_point.pb.h"
+#include "modules/common_msgs/config_msgs/vehicle_config.pb.h"
+
+#include "modules/common/math/box2d.h"
+#include "modules/common/math/polygon2d.h"
+#include "modules/common/math/shape_kdtree2d.h"
+#include "modules/common/math/vec2d.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class PathOverlapIndex
+ * @brief Broad phase of the overlap checks between the ADC along a path and
+ *        the obstacles. The ADC boxes at the path points are put into a
+ *        kd-tree once, so an obstacle only runs the exact tests at the path
+ *        points around it.
+ */
+class PathOverlapIndex {
+ public:
+  /**
+   * @param path_points The path points of the center of rear-axis for ADC.
+   * @param vehicle_param The vehicle param to build the ADC boxes.
+   * @param l_buffer The extra lateral buffer on each side of the ADC.
+   */
+  PathOverlapIndex(const std::vector<common::PathPoint>& path_points,
+                   const common::VehicleParam& vehicle_param,
+                   const double l_buffer);
+
+  /**
+   * @brief Get the indices of the path points where the ADC box may overlap
+   *        with the obstacle box, in ascending order. Every path point with
+   *        an actual overlap is included.
+   */
+  std::vector<size_t> GetCandidateIndices(
+      const common::math::Box2d& obs_box) const;
+
+  /**
+   * @brief Same as above for an obstacle polygon.
+   */
+  std::vector<size_t> GetCandidateIndices(
+      const common::math::Polygon2d& obs_polygon) const;
+
+  size_t size() const { return kdtree_ == nullptr ? 0 : kdtree_->size(); }
+
+ private:
+  std::vector<size_t> GetCandidateIndices(const common::math::Vec2d& center,
+                                          const double radius) const;
+
+  std::unique_ptr<common::math::ShapeKDTree2d<common::math::Box2d>> kdtree_;
+};
+
+}  // namespace planning
+}  // namespace apollo
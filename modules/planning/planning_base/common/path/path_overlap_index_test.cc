@@ -0,0 +1,131 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file path_overlap_index_test.cc
+ **/
+
+#include "modules/planning/planning_base/common/path/path_overlap_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "modules/common/configs/vehicle_config_helper.h"
+#include "modules/common/util/point_factory.h"
+
+namespace apollo {
+namespace planning {
+
+using apollo::common::PathPoint;
+using apollo::common::math::Box2d;
+using apollo::common::math::Polygon2d;
+using apollo::common::math::Vec2d;
+using apollo::common::util::PointFactory;
+
+namespace {
+
+Box2d ADCBox(const PathPoint& path_point,
+             const common::VehicleParam& vehicle_param,
+             const double l_buffer) {
+  Vec2d ego_center_map_frame((vehicle_param.front_edge_to_center() -
+                              vehicle_param.back_edge_to_center()) *
+                                 0.5,
+                             (vehicle_param.left_edge_to_center() -
+                              vehicle_param.right_edge_to_center()) *
+                                 0.5);
+  ego_center_map_frame.SelfRotate(path_point.theta());
+  ego_center_map_frame.set_x(ego_center_map_frame.x() + path_point.x());
+  ego_center_map_frame.set_y(ego_center_map_frame.y() + path_point.y());
+  return Box2d(ego_center_map_frame, path_point.theta(),
+               vehicle_param.length(), vehicle_param.width() + l_buffer * 2);
+}
+
+// an s-shaped path with 0.2m spacing
+std::vector<PathPoint> SPath() {
+  std::vector<PathPoint> path_points;
+  double s = 0.0;
+  for (int i = 0; i < 500; ++i) {
+    const double x = 0.2 * i;
+    const double y = 5.0 * std::sin(x / 15.0);
+    const double theta = std::atan(5.0 / 15.0 * std::cos(x / 15.0));
+    if (!path_points.empty()) {
+      s += std::hypot(x - path_points.back().x(), y - path_points.back().y());
+    }
+    PathPoint path_point = PointFactory::ToPathPoint(x, y, 0.0, s);
+    path_point.set_theta(theta);
+    path_points.push_back(path_point);
+  }
+  return path_points;
+}
+
+}  // namespace
+
+TEST(PathOverlapIndexTest, empty_path) {
+  const auto& vehicle_param =
+      common::VehicleConfigHelper::GetConfig().vehicle_param();
+  PathOverlapIndex index({}, vehicle_param, 0.5);
+  EXPECT_EQ(0, index.size());
+  EXPECT_TRUE(index.GetCandidateIndices(Box2d({0.0, 0.0}, 0.0, 4.0, 2.0))
+                  .empty());
+}
+
+TEST(PathOverlapIndexTest, same_as_brute_force) {
+  const auto& vehicle_param =
+      common::VehicleConfigHelper::GetConfig().vehicle_param();
+  const double l_buffer = 0.4;
+  const auto path_points = SPath();
+  PathOverlapIndex index(path_points, vehicle_param, l_buffer);
+  ASSERT_EQ(path_points.size(), index.size());
+
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> x_dist(-10.0, 110.0);
+  std::uniform_real_distribution<double> y_dist(-12.0, 12.0);
+  std::uniform_real_distribution<double> heading_dist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> size_dist(0.5, 12.0);
+  int num_overlapping = 0;
+  for (int k = 0; k < 500; ++k) {
+    const Box2d obs_box({x_dist(gen), y_dist(gen)}, heading_dist(gen),
+                        size_dist(gen), size_dist(gen) / 2.0);
+    const Polygon2d obs_polygon(obs_box);
+    const auto box_candidates = index.GetCandidateIndices(obs_box);
+    const auto polygon_candidates = index.GetCandidateIndices(obs_polygon);
+    EXPECT_TRUE(
+        std::is_sorted(box_candidates.begin(), box_candidates.end()));
+    EXPECT_TRUE(
+        std::is_sorted(polygon_candidates.begin(), polygon_candidates.end()));
+    for (size_t i = 0; i < path_points.size(); ++i) {
+      const Box2d adc_box = ADCBox(path_points[i], vehicle_param, l_buffer);
+      if (obs_box.HasOverlap(adc_box)) {
+        ++num_overlapping;
+        EXPECT_TRUE(std::binary_search(box_candidates.begin(),
+                                       box_candidates.end(), i))
+            << k << ", " << i;
+      }
+      if (obs_polygon.HasOverlap(Polygon2d(adc_box))) {
+        EXPECT_TRUE(std::binary_search(polygon_candidates.begin(),
+                                       polygon_candidates.end(), i))
+            << k << ", " << i;
+      }
+    }
+  }
+  EXPECT_GT(num_overlapping, 0);
+}
+
+}  // namespace planning
+}  // namespace apollo
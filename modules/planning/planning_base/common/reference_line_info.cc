@@ -33,6 +33,7 @@
 #include "modules/common/util/util.h"
 #include "modules/map/hdmap/hdmap_common.h"
 #include "modules/map/hdmap/hdmap_util.h"
+#include "modules/planning/planning_base/common/util/planning_thread_pool.h"
 #include "modules/planning/planning_base/common/util/print_debug_info.h"
 
 namespace apollo {
@@ -441,13 +442,12 @@ Obstacle* ReferenceLineInfo::AddObstacle(const Obstacle* obstacle) {
 bool ReferenceLineInfo::AddObstacles(
     const std::vector<const Obstacle*>& obstacles) {
   if (FLAGS_use_multi_thread_to_add_obstacles) {
-    std::vector<std::future<Obstacle*>> results;
-    for (const auto* obstacle : obstacles) {
-      results.push_back(
-          cyber::Async(&ReferenceLineInfo::AddObstacle, this, obstacle));
-    }
-    for (auto& result : results) {
-      if (!result.get()) {
+    std::vector<Obstacle*> results(obstacles.size(), nullptr);
+    PlanningThreadPool::ParallelFor(0, obstacles.size(), 1, [&](size_t i) {
+      results[i] = AddObstacle(obstacles[i]);
+    });
+    for (const auto* result : results) {
+      if (result == nullptr) {
         AERROR << "Fail to add obstacles.";
         return false;
       }
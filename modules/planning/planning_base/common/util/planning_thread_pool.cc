@@ -0,0 +1,53 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/planning/planning_base/common/util/planning_thread_pool.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "cyber/scheduler/scheduler_factory.h"
+
+#include "modules/planning/planning_base/gflags/planning_gflags.h"
+
+namespace apollo {
+namespace planning {
+
+namespace {
+
+std::unique_ptr<cyber::base::WorkStealingExecutor> CreateExecutor() {
+  std::unique_ptr<cyber::base::WorkStealingExecutor> executor(
+      new cyber::base::WorkStealingExecutor(static_cast<std::size_t>(
+          std::max(FLAGS_planning_thread_pool_size, 0))));
+  // The workers are plain threads out of the cyber scheduler, so they take
+  // the affinity and the priority of the inner thread "planning_pool"
+  for (std::size_t i = 0; i < executor->thread_num(); ++i) {
+    cyber::scheduler::Instance()->SetInnerThreadAttr("planning_pool",
+                                                     executor->worker(i));
+  }
+  return executor;
+}
+
+}  // namespace
+
+cyber::base::WorkStealingExecutor* PlanningThreadPool::Instance() {
+  static const std::unique_ptr<cyber::base::WorkStealingExecutor> executor =
+      CreateExecutor();
+  return executor.get();
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,49 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "cyber/base/work_stealing_executor.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class PlanningThreadPool
+ * @brief The pool of the fine grained parallel loops of planning, e.g. over
+ * the obstacles or the cells of a dp graph, with
+ * FLAGS_planning_thread_pool_size workers.
+ */
+class PlanningThreadPool {
+ public:
+  static cyber::base::WorkStealingExecutor* Instance();
+
+  /**
+   * @brief f(i) for i in [begin, end), in chunks of grain indices run by the
+   * caller and the workers.
+   */
+  template <typename F>
+  static void ParallelFor(std::size_t begin, std::size_t end,
+                          std::size_t grain, F&& f) {
+    Instance()->ParallelFor(begin, end, grain, std::forward<F>(f));
+  }
+};
+
+}  // namespace planning
+}  // namespace apollo
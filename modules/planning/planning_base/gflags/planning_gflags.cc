@@ -209,6 +209,13 @@ DEFINE_double(speed_fallback_distance, 3.0,
 /// thread pool
 DEFINE_bool(use_multi_thread_to_add_obstacles, false,
             "use multiple thread to add obstacles.");
+DEFINE_bool(enable_multi_thread_in_st_boundary_mapping, false,
+            "use multiple thread to map obstacles onto the ST-graph.");
+DEFINE_int32(planning_thread_pool_size, 4,
+             "number of threads of the pool for the parallel loops. They are "
+             "plain threads out of the cyber scheduler, with the affinity and "
+             "priority of the inner thread planning_pool of the scheduler "
+             "conf if set, and 0 runs the loops serially.");
 
 /// Lattice Planner
 DEFINE_double(numerical_epsilon, 1e-6, "Epsilon in lattice planner.");
@@ -268,6 +275,9 @@ DEFINE_double(polynomial_minimal_param, 0.01,
               "Minimal time parameter in polynomials.");
 DEFINE_double(lattice_stop_buffer, 0.02,
               "The buffer before the stop s to check trajectories.");
+DEFINE_int32(lattice_parallel_candidate_num, 1,
+             "Number of the best trajectory pairs the lattice planner "
+             "combines and checks in parallel, 1 to check them one by one.");
 
 DEFINE_bool(lateral_optimization, true,
             "whether using optimization for lateral trajectory generation");
@@ -339,6 +349,10 @@ DEFINE_bool(
 DEFINE_bool(enable_osqp_debug, false,
             "True to turn on OSQP verbose debug output in log.");
 
+DEFINE_bool(enable_piecewise_jerk_workspace_cache, false,
+            "True to reuse and warm start the osqp workspace of piecewise "
+            "jerk problems with the same shape across planning cycles.");
+
 DEFINE_bool(export_chart, false, "export chart in planning");
 DEFINE_bool(enable_record_debug, true,
             "True to enable record debug info in chart format");
@@ -102,6 +102,8 @@ DECLARE_double(slowdown_profile_deceleration);
 DECLARE_double(speed_fallback_distance);
 /// thread pool
 DECLARE_bool(use_multi_thread_to_add_obstacles);
+DECLARE_bool(enable_multi_thread_in_st_boundary_mapping);
+DECLARE_int32(planning_thread_pool_size);
 
 DECLARE_double(numerical_epsilon);
 DECLARE_double(default_cruise_speed);
@@ -147,6 +149,7 @@ DECLARE_double(time_min_density);
 DECLARE_double(comfort_acceleration_factor);
 DECLARE_double(polynomial_minimal_param);
 DECLARE_double(lattice_stop_buffer);
+DECLARE_int32(lattice_parallel_candidate_num);
 DECLARE_double(max_s_lateral_optimization);
 DECLARE_double(default_delta_s_lateral_optimization);
 DECLARE_double(bound_buffer);
@@ -172,6 +175,7 @@ DECLARE_bool(enable_parallel_trajectory_smoothing);
 DECLARE_bool(enable_parallel_hybrid_a);
 
 DECLARE_bool(enable_osqp_debug);
+DECLARE_bool(enable_piecewise_jerk_workspace_cache);
 DECLARE_bool(export_chart);
 DECLARE_bool(enable_record_debug);
 DECLARE_bool(enable_print_curve);
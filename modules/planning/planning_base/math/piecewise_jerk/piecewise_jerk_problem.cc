@@ -16,6 +16,9 @@
 
 #include "modules/planning/planning_base/math/piecewise_jerk/piecewise_jerk_problem.h"
 
+#include <list>
+#include <typeindex>
+
 #include "cyber/common/log.h"
 #include "modules/planning/planning_base/gflags/planning_gflags.h"
 
@@ -24,6 +27,95 @@ namespace planning {
 
 namespace {
 constexpr double kMaxVariableRange = 1.0e10;
+constexpr size_t kMaxCachedWorkspaceNum = 8;
+
+// osqp only keeps the upper triangular part of the kernel, so the values
+// passed to osqp_update_P have to follow the same layout.
+void KeepUpperTriangular(std::vector<c_float>* P_data,
+                         std::vector<c_int>* P_indices,
+                         std::vector<c_int>* P_indptr) {
+  size_t ind_p = 0;
+  size_t start = 0;
+  for (size_t col = 0; col + 1 < P_indptr->size(); ++col) {
+    const size_t end = static_cast<size_t>(P_indptr->at(col + 1));
+    P_indptr->at(col) = static_cast<c_int>(ind_p);
+    for (size_t k = start; k < end; ++k) {
+      if (static_cast<size_t>(P_indices->at(k)) <= col) {
+        P_data->at(ind_p) = P_data->at(k);
+        P_indices->at(ind_p) = P_indices->at(k);
+        ++ind_p;
+      }
+    }
+    start = end;
+  }
+  P_indptr->back() = static_cast<c_int>(ind_p);
+  P_data->resize(ind_p);
+  P_indices->resize(ind_p);
+}
+
+struct WorkspaceShape {
+  std::type_index problem_type = std::type_index(typeid(void));
+  c_int n = 0;
+  c_int m = 0;
+  std::vector<c_int> P_indices;
+  std::vector<c_int> P_indptr;
+  std::vector<c_int> A_indices;
+  std::vector<c_int> A_indptr;
+
+  bool operator==(const WorkspaceShape& other) const {
+    return problem_type == other.problem_type && n == other.n &&
+           m == other.m && P_indices == other.P_indices &&
+           P_indptr == other.P_indptr && A_indices == other.A_indices &&
+           A_indptr == other.A_indptr;
+  }
+};
+
+// Least recently used osqp workspaces, keyed by the sparsity pattern of the
+// problem. Owned by a single thread, so no locking is needed.
+class WorkspaceCache {
+ public:
+  ~WorkspaceCache() {
+    for (auto& entry : entries_) {
+      osqp_cleanup(entry.second);
+    }
+  }
+
+  OSQPWorkspace* Find(const WorkspaceShape& shape) {
+    for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+      if (iter->first == shape) {
+        entries_.splice(entries_.begin(), entries_, iter);
+        return entries_.front().second;
+      }
+    }
+    return nullptr;
+  }
+
+  void Insert(WorkspaceShape shape, OSQPWorkspace* osqp_work) {
+    if (entries_.size() >= kMaxCachedWorkspaceNum) {
+      osqp_cleanup(entries_.back().second);
+      entries_.pop_back();
+    }
+    entries_.emplace_front(std::move(shape), osqp_work);
+  }
+
+  void Remove(OSQPWorkspace* osqp_work) {
+    for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+      if (iter->second == osqp_work) {
+        osqp_cleanup(iter->second);
+        entries_.erase(iter);
+        return;
+      }
+    }
+  }
+
+ private:
+  std::list<std::pair<WorkspaceShape, OSQPWorkspace*>> entries_;
+};
+
+WorkspaceCache* ThreadWorkspaceCache() {
+  static thread_local WorkspaceCache cache;
+  return &cache;
+}
 }  // namespace
 
 PiecewiseJerkProblem::PiecewiseJerkProblem(
@@ -88,6 +180,9 @@ bool PiecewiseJerkProblem::FormulateProblem(OSQPData* data) {
 }
 
 bool PiecewiseJerkProblem::Optimize(const int max_iter) {
+  if (FLAGS_enable_piecewise_jerk_workspace_cache) {
+    return OptimizeWithCachedWorkspace(max_iter);
+  }
   OSQPData* data = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
   if (FormulateProblem(data)) {
     FreeData(data);
@@ -99,19 +194,107 @@ bool PiecewiseJerkProblem::Optimize(const int max_iter) {
   osqp_work = osqp_setup(data, settings);
   // osqp_setup(&osqp_work, data, settings);
   osqp_solve(osqp_work);
+  const bool solved = ExtractSolution(osqp_work);
+
+  // Cleanup
+  osqp_cleanup(osqp_work);
+  FreeData(data);
+  c_free(settings);
+  return solved;
+}
+
+bool PiecewiseJerkProblem::OptimizeWithCachedWorkspace(const int max_iter) {
+  std::vector<c_float> P_data;
+  std::vector<c_int> P_indices;
+  std::vector<c_int> P_indptr;
+  CalculateKernel(&P_data, &P_indices, &P_indptr);
+  KeepUpperTriangular(&P_data, &P_indices, &P_indptr);
+
+  std::vector<c_float> A_data;
+  std::vector<c_int> A_indices;
+  std::vector<c_int> A_indptr;
+  std::vector<c_float> lower_bounds;
+  std::vector<c_float> upper_bounds;
+  CalculateAffineConstraint(&A_data, &A_indices, &A_indptr, &lower_bounds,
+                            &upper_bounds);
+
+  std::vector<c_float> q;
+  CalculateOffset(&q);
+
+  CHECK_EQ(lower_bounds.size(), upper_bounds.size());
+  if (CheckLowUpperBound(lower_bounds, upper_bounds)) {
+    return false;
+  }
+
+  WorkspaceShape shape;
+  shape.problem_type = std::type_index(typeid(*this));
+  shape.n = static_cast<c_int>(3 * num_of_knots_);
+  shape.m = static_cast<c_int>(lower_bounds.size());
+  shape.P_indices = P_indices;
+  shape.P_indptr = P_indptr;
+  shape.A_indices = A_indices;
+  shape.A_indptr = A_indptr;
+
+  WorkspaceCache* cache = ThreadWorkspaceCache();
+  OSQPWorkspace* osqp_work = cache->Find(shape);
+  if (osqp_work != nullptr) {
+    // same sparsity, only the values change between planning cycles
+    if (osqp_update_P_A(osqp_work, P_data.data(), OSQP_NULL, P_data.size(),
+                        A_data.data(), OSQP_NULL, A_data.size()) != 0 ||
+        osqp_update_lin_cost(osqp_work, q.data()) != 0 ||
+        osqp_update_bounds(osqp_work, lower_bounds.data(),
+                           upper_bounds.data()) != 0 ||
+        osqp_update_max_iter(osqp_work, max_iter) != 0) {
+      AWARN << "failed to update the cached osqp workspace, set up a new one";
+      cache->Remove(osqp_work);
+      osqp_work = nullptr;
+    }
+  }
+
+  if (osqp_work == nullptr) {
+    OSQPData data;
+    data.n = shape.n;
+    data.m = shape.m;
+    data.P = csc_matrix(data.n, data.n, P_data.size(), P_data.data(),
+                        P_indices.data(), P_indptr.data());
+    data.q = q.data();
+    data.A = csc_matrix(data.m, data.n, A_data.size(), A_data.data(),
+                        A_indices.data(), A_indptr.data());
+    data.l = lower_bounds.data();
+    data.u = upper_bounds.data();
+
+    OSQPSettings* settings = SolverDefaultSettings();
+    settings->max_iter = max_iter;
+    settings->warm_start = true;
+    osqp_work = osqp_setup(&data, settings);
+    // osqp_setup copies the problem data and the settings
+    c_free(data.P);
+    c_free(data.A);
+    c_free(settings);
+    if (osqp_work == nullptr) {
+      AERROR << "failed to set up osqp workspace";
+      return false;
+    }
+    cache->Insert(std::move(shape), osqp_work);
+  }
+
+  osqp_solve(osqp_work);
+  if (!ExtractSolution(osqp_work)) {
+    // do not warm start the next cycle from a failed solution
+    cache->Remove(osqp_work);
+    return false;
+  }
+  return true;
+}
+
+bool PiecewiseJerkProblem::ExtractSolution(const OSQPWorkspace* osqp_work) {
   auto status = osqp_work->info->status_val;
 
   if (status < 0 || (status != 1 && status != 2)) {
     AERROR << "failed optimization status:\t" << osqp_work->info->status;
-    osqp_cleanup(osqp_work);
-    FreeData(data);
-    c_free(settings);
     return false;
   } else if (osqp_work->solution == nullptr) {
     AERROR << "The solution from OSQP is nullptr";
-    osqp_cleanup(osqp_work);
-    FreeData(data);
-    c_free(settings);
     return false;
   }
 
@@ -125,11 +308,6 @@ bool PiecewiseJerkProblem::Optimize(const int max_iter) {
     ddx_.at(i) =
         osqp_work->solution->x[i + 2 * num_of_knots_] / scale_factor_[2];
   }
-
-  // Cleanup
-  osqp_cleanup(osqp_work);
-  FreeData(data);
-  c_free(settings);
   return true;
 }
 
@@ -146,6 +146,15 @@ class PiecewiseJerkProblem {
 
   bool FormulateProblem(OSQPData* data);
 
+  /*
+   * @brief: solve with an osqp workspace kept per problem shape and thread.
+   * The kernel and constraint values of the workspace are updated in place
+   * and the solver is warm started from the solution of the last cycle.
+   */
+  bool OptimizeWithCachedWorkspace(const int max_iter);
+
+  bool ExtractSolution(const OSQPWorkspace* osqp_work);
+
   void FreeData(OSQPData* data);
 
   bool CheckLowUpperBound(const std::vector<c_float>& lower,
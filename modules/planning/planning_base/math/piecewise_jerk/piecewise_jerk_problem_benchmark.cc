@@ -0,0 +1,117 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+// Per cycle solve time of the piecewise jerk path and speed problems, with a
+// fresh osqp workspace every cycle against the cached and warm started one.
+// Every cycle replays the same lane keeping and following scenario, shifted
+// a little as the ego vehicle moves on, so the problem shape stays the same
+// and only the bounds, references and initial state change.
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "modules/planning/planning_base/gflags/planning_gflags.h"
+#include "modules/planning/planning_base/math/piecewise_jerk/piecewise_jerk_path_problem.h"
+#include "modules/planning/planning_base/math/piecewise_jerk/piecewise_jerk_speed_problem.h"
+
+namespace apollo {
+namespace planning {
+namespace {
+
+constexpr size_t kNumOfPathKnots = 200;
+constexpr size_t kNumOfSpeedKnots = 80;
+constexpr int kNumOfCycles = 100;
+
+bool SolvePathCycle(const int cycle) {
+  const double delta_s = 0.5;
+  const double phase = 0.1 * cycle;
+  PiecewiseJerkPathProblem problem(
+      kNumOfPathKnots, delta_s, {0.3 * std::sin(phase), 0.0, 0.0});
+  std::vector<std::pair<double, double>> x_bounds;
+  for (size_t i = 0; i < kNumOfPathKnots; ++i) {
+    const double s = static_cast<double>(i) * delta_s + cycle;
+    // a parked vehicle on the right every 40 meters
+    const bool nudge = std::fmod(s, 40.0) > 20.0 && std::fmod(s, 40.0) < 28.0;
+    x_bounds.emplace_back(nudge ? -0.3 : -1.75, 1.75);
+  }
+  problem.set_x_bounds(std::move(x_bounds));
+  problem.set_dx_bounds(-2.0, 2.0);
+  problem.set_ddx_bounds(-0.5, 0.5);
+  problem.set_dddx_bound(1.0);
+  problem.set_weight_x(1.0);
+  problem.set_weight_dx(100.0);
+  problem.set_weight_ddx(1000.0);
+  problem.set_weight_dddx(10000.0);
+  problem.set_scale_factor({1.0, 10.0, 100.0});
+  problem.set_end_state_ref({{1000.0, 0.0, 0.0}}, {{0.0, 0.0, 0.0}});
+  return problem.Optimize();
+}
+
+bool SolveSpeedCycle(const int cycle) {
+  const double delta_t = 0.1;
+  const double cruise_speed = 12.0;
+  const double leader_speed = 10.0 + 2.0 * std::sin(0.05 * cycle);
+  PiecewiseJerkSpeedProblem problem(kNumOfSpeedKnots, delta_t,
+                                    {0.0, leader_speed, 0.0});
+  std::vector<std::pair<double, double>> s_bounds;
+  std::vector<double> x_ref;
+  for (size_t i = 0; i < kNumOfSpeedKnots; ++i) {
+    const double t = static_cast<double>(i) * delta_t;
+    s_bounds.emplace_back(0.0, 30.0 + leader_speed * t);
+    x_ref.push_back(cruise_speed * t);
+  }
+  problem.set_x_bounds(std::move(s_bounds));
+  problem.set_dx_bounds(0.0, 20.0);
+  problem.set_ddx_bounds(-4.0, 2.0);
+  problem.set_dddx_bound(-4.0, 2.0);
+  problem.set_weight_ddx(1.0);
+  problem.set_weight_dddx(10.0);
+  problem.set_scale_factor({1.0, 10.0, 100.0});
+  problem.set_x_ref(10.0, std::move(x_ref));
+  problem.set_dx_ref(1.0, cruise_speed);
+  return problem.Optimize();
+}
+
+void BM_PlanningCycle(benchmark::State& state) {  // NOLINT
+  FLAGS_enable_piecewise_jerk_workspace_cache = state.range(0) != 0;
+  int cycle = 0;
+  for (auto _ : state) {
+    const bool path_solved = SolvePathCycle(cycle);
+    const bool speed_solved = SolveSpeedCycle(cycle);
+    if (!path_solved || !speed_solved) {
+      state.SkipWithError("piecewise jerk problem not solved");
+      break;
+    }
+    cycle = (cycle + 1) % kNumOfCycles;
+  }
+}
+
+}  // namespace
+
+// 0: new workspace every cycle, 1: cached workspace
+BENCHMARK(BM_PlanningCycle)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+}  // namespace planning
+}  // namespace apollo
+
+BENCHMARK_MAIN();
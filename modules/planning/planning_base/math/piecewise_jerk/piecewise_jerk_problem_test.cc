@@ -0,0 +1,146 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/planning_base/math/piecewise_jerk/piecewise_jerk_problem.h"
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "modules/planning/planning_base/gflags/planning_gflags.h"
+#include "modules/planning/planning_base/math/piecewise_jerk/piecewise_jerk_path_problem.h"
+#include "modules/planning/planning_base/math/piecewise_jerk/piecewise_jerk_speed_problem.h"
+
+namespace apollo {
+namespace planning {
+
+namespace {
+
+constexpr size_t kNumOfKnots = 80;
+constexpr int kNumOfCycles = 10;
+
+// lateral problem of a lane keeping cycle, an obstacle on the left narrows
+// the bounds a bit more every cycle.
+bool SolvePathCycle(const int cycle, std::vector<double>* l) {
+  const double delta_s = 0.5;
+  PiecewiseJerkPathProblem problem(kNumOfKnots, delta_s,
+                                   {0.2 - 0.01 * cycle, 0.0, 0.0});
+  std::vector<std::pair<double, double>> x_bounds;
+  for (size_t i = 0; i < kNumOfKnots; ++i) {
+    const double s = static_cast<double>(i) * delta_s;
+    const double upper =
+        (s > 10.0 + cycle && s < 20.0 + cycle) ? 0.5 : 1.75;
+    x_bounds.emplace_back(-1.75, upper);
+  }
+  problem.set_x_bounds(std::move(x_bounds));
+  problem.set_dx_bounds(-2.0, 2.0);
+  problem.set_ddx_bounds(-0.5, 0.5);
+  problem.set_dddx_bound(1.0);
+  problem.set_weight_x(1.0);
+  problem.set_weight_dx(100.0);
+  problem.set_weight_ddx(1000.0);
+  problem.set_weight_dddx(10000.0);
+  problem.set_scale_factor({1.0, 10.0, 100.0});
+  problem.set_end_state_ref({{1000.0, 0.0, 0.0}}, {{0.0, 0.0, 0.0}});
+  if (!problem.Optimize()) {
+    return false;
+  }
+  *l = problem.opt_x();
+  return true;
+}
+
+// longitudinal problem of a following cycle, the leading vehicle slows down
+// a bit every cycle.
+bool SolveSpeedCycle(const int cycle, std::vector<double>* s) {
+  const double delta_t = 0.1;
+  const double cruise_speed = 10.0;
+  PiecewiseJerkSpeedProblem problem(kNumOfKnots, delta_t,
+                                    {0.0, cruise_speed - 0.05 * cycle, 0.0});
+  std::vector<std::pair<double, double>> s_bounds;
+  std::vector<double> x_ref;
+  for (size_t i = 0; i < kNumOfKnots; ++i) {
+    const double t = static_cast<double>(i) * delta_t;
+    s_bounds.emplace_back(0.0, 40.0 + (8.0 - 0.2 * cycle) * t);
+    x_ref.push_back(cruise_speed * t);
+  }
+  problem.set_x_bounds(std::move(s_bounds));
+  problem.set_dx_bounds(0.0, 15.0);
+  problem.set_ddx_bounds(-4.0, 2.0);
+  problem.set_dddx_bound(-4.0, 2.0);
+  problem.set_weight_ddx(1.0);
+  problem.set_weight_dddx(10.0);
+  problem.set_scale_factor({1.0, 10.0, 100.0});
+  problem.set_x_ref(10.0, std::move(x_ref));
+  problem.set_dx_ref(1.0, cruise_speed);
+  if (!problem.Optimize()) {
+    return false;
+  }
+  *s = problem.opt_x();
+  return true;
+}
+
+}  // namespace
+
+TEST(PiecewiseJerkProblemTest, cached_workspace_same_solution) {
+  const bool enable_cache = FLAGS_enable_piecewise_jerk_workspace_cache;
+  for (int cycle = 0; cycle < kNumOfCycles; ++cycle) {
+    std::vector<double> path_cold;
+    std::vector<double> speed_cold;
+    FLAGS_enable_piecewise_jerk_workspace_cache = false;
+    ASSERT_TRUE(SolvePathCycle(cycle, &path_cold));
+    ASSERT_TRUE(SolveSpeedCycle(cycle, &speed_cold));
+
+    // path and speed problems interleave as in a planning cycle, each of them
+    // goes back to its own workspace.
+    std::vector<double> path_cached;
+    std::vector<double> speed_cached;
+    FLAGS_enable_piecewise_jerk_workspace_cache = true;
+    ASSERT_TRUE(SolvePathCycle(cycle, &path_cached));
+    ASSERT_TRUE(SolveSpeedCycle(cycle, &speed_cached));
+
+    ASSERT_EQ(path_cold.size(), path_cached.size());
+    for (size_t i = 0; i < path_cold.size(); ++i) {
+      EXPECT_NEAR(path_cold[i], path_cached[i], 1e-2) << cycle << ", " << i;
+    }
+    ASSERT_EQ(speed_cold.size(), speed_cached.size());
+    for (size_t i = 0; i < speed_cold.size(); ++i) {
+      EXPECT_NEAR(speed_cold[i], speed_cached[i], 1e-1) << cycle << ", " << i;
+    }
+  }
+  FLAGS_enable_piecewise_jerk_workspace_cache = enable_cache;
+}
+
+TEST(PiecewiseJerkProblemTest, cached_workspace_invalid_bounds) {
+  const bool enable_cache = FLAGS_enable_piecewise_jerk_workspace_cache;
+  FLAGS_enable_piecewise_jerk_workspace_cache = true;
+  std::vector<double> l;
+  ASSERT_TRUE(SolvePathCycle(0, &l));
+  PiecewiseJerkPathProblem problem(kNumOfKnots, 0.5, {0.0, 0.0, 0.0});
+  problem.set_x_bounds(1.0, -1.0);
+  EXPECT_FALSE(problem.Optimize());
+  // the cached workspace is still usable after a rejected problem
+  ASSERT_TRUE(SolvePathCycle(1, &l));
+  FLAGS_enable_piecewise_jerk_workspace_cache = enable_cache;
+}
+
+}  // namespace planning
+}  // namespace apollo
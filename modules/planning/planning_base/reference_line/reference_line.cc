@@ -190,6 +190,16 @@ common::FrenetFramePoint ReferenceLine::GetFrenetPoint(
 
   common::SLPoint sl_point;
   XYToSL(path_point, &sl_point);
+  return GetFrenetPoint(path_point, sl_point);
+}
+
+common::FrenetFramePoint ReferenceLine::GetFrenetPoint(
+    const common::PathPoint& path_point,
+    const common::SLPoint& sl_point) const {
+  if (reference_points_.empty()) {
+    return common::FrenetFramePoint();
+  }
+
   common::FrenetFramePoint frenet_frame_point;
   frenet_frame_point.set_s(sl_point.s());
   frenet_frame_point.set_l(sl_point.l());
@@ -446,6 +456,27 @@ bool ReferenceLine::XYToSL(const double heading,
   return true;
 }
 
+bool ReferenceLine::XYToSL(
+    const std::vector<common::math::Vec2d>& xy_points,
+    std::vector<common::SLPoint>* const sl_points) const {
+  if (xy_points.empty()) {
+    sl_points->clear();
+    return true;
+  }
+  std::vector<double> s;
+  std::vector<double> l;
+  if (!map_path_.GetProjections(xy_points, &s, &l)) {
+    AERROR << "Cannot get nearest points from path.";
+    return false;
+  }
+  sl_points->resize(xy_points.size());
+  for (size_t i = 0; i < xy_points.size(); ++i) {
+    (*sl_points)[i].set_s(s[i]);
+    (*sl_points)[i].set_l(l[i]);
+  }
+  return true;
+}
+
 bool ReferenceLine::XYToSL(const common::math::Vec2d& xy_point,
                            common::SLPoint* const sl_point,
                            double hueristic_start_s,
@@ -855,13 +886,17 @@ bool ReferenceLine::GetSLBoundary(const hdmap::Polygon& polygon,
   double end_s(std::numeric_limits<double>::lowest());
   double start_l(std::numeric_limits<double>::max());
   double end_l(std::numeric_limits<double>::lowest());
+  std::vector<common::math::Vec2d> points;
+  points.reserve(polygon.point_size());
   for (const auto& point : polygon.point()) {
-    SLPoint sl_point;
-    if (!XYToSL(point, &sl_point)) {
-      AERROR << "Failed to get projection for point: " << point.DebugString()
-             << " on reference line.";
-      return false;
-    }
+    points.emplace_back(point.x(), point.y());
+  }
+  std::vector<SLPoint> sl_points;
+  if (!XYToSL(points, &sl_points)) {
+    AERROR << "Failed to get projection for polygon on reference line.";
+    return false;
+  }
+  for (const auto& sl_point : sl_points) {
     start_s = std::fmin(start_s, sl_point.s());
     end_s = std::fmax(end_s, sl_point.s());
     start_l = std::fmin(start_l, sl_point.l());
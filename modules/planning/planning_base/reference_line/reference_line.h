@@ -85,6 +85,12 @@ class ReferenceLine {
 
   common::FrenetFramePoint GetFrenetPoint(
       const common::PathPoint& path_point) const;
+  /**
+   * @brief Same as above with the projection of the path point given.
+   */
+  common::FrenetFramePoint GetFrenetPoint(
+      const common::PathPoint& path_point,
+      const common::SLPoint& sl_point) const;
 
   std::pair<std::array<double, 3>, std::array<double, 3>> ToFrenetFrame(
       const common::TrajectoryPoint& traj_point) const;
@@ -154,6 +160,18 @@ class ReferenceLine {
     return XYToSL(common::math::Vec2d(xy.x(), xy.y()), sl_point);
   }
 
+  /**
+   * @brief Transvert a batch of Cartesian coordinates to Frenet, gives the
+   * same results as XYToSL without warm start for every point. Faster when
+   * the points are close to each other, e.g. the points along a path.
+   * @param xy_points The Cartesian coordinates.
+   * @param sl_points The output Frenet coordinates.
+   *
+   * @return True if success.
+   */
+  bool XYToSL(const std::vector<common::math::Vec2d>& xy_points,
+              std::vector<common::SLPoint>* const sl_points) const;
+
   bool GetLaneWidth(const double s, double* const lane_left_width,
                     double* const lane_right_width) const;
 
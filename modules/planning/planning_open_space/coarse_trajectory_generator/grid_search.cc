@@ -38,22 +38,25 @@ double GridSearch::EuclidDistance(
 }
 
 bool GridSearch::CheckConstraints(std::shared_ptr<Node2d> node) {
-  const double node_grid_x = node->GetGridX();
-  const double node_grid_y = node->GetGridY();
-  if (node_grid_x > max_grid_x_ ||
-      node_grid_x < 0  ||
-      node_grid_y > max_grid_y_ ||
-      node_grid_y < 0) {
+  return CheckConstraints(static_cast<int>(node->GetGridX()),
+                          static_cast<int>(node->GetGridY()));
+}
+
+bool GridSearch::CheckConstraints(const int grid_x, const int grid_y) {
+  if (grid_x > max_grid_x_ ||
+      grid_x < 0  ||
+      grid_y > max_grid_y_ ||
+      grid_y < 0) {
     return false;
   }
   if (obstacles_linesegments_vec_.empty()) {
     return true;
   }
+  const Vec2d grid_point(grid_x, grid_y);
   for (const auto& obstacle_linesegments : obstacles_linesegments_vec_) {
     for (const common::math::LineSegment2d& linesegment :
          obstacle_linesegments) {
-      if (linesegment.DistanceTo({node->GetGridX(), node->GetGridY()})
-          < node_radius_) {
+      if (linesegment.DistanceTo(grid_point) < node_radius_) {
         return false;
       }
     }
@@ -61,6 +64,22 @@ bool GridSearch::CheckConstraints(std::shared_ptr<Node2d> node) {
   return true;
 }
 
+bool GridSearch::CheckDpGridConstraints(const int grid_x, const int grid_y) {
+  if (grid_x > max_grid_x_ ||
+      grid_x < 0  ||
+      grid_y > max_grid_y_ ||
+      grid_y < 0) {
+    return false;
+  }
+  DpGridNode& grid_node = dp_grid_[DpGridIndex(grid_x, grid_y)];
+  if (grid_node.cell_state == DpCellState::kUnknown) {
+    grid_node.cell_state = CheckConstraints(grid_x, grid_y)
+                               ? DpCellState::kFree
+                               : DpCellState::kOccupied;
+  }
+  return grid_node.cell_state == DpCellState::kFree;
+}
+
 std::vector<std::shared_ptr<Node2d>> GridSearch::GenerateNextNodes(
     std::shared_ptr<Node2d> current_node) {
   double current_node_x = current_node->GetGridX();
@@ -110,11 +129,11 @@ bool GridSearch::GenerateAStarPath(
     const std::vector<std::vector<common::math::LineSegment2d>>&
         obstacles_linesegments_vec,
     GridAStartResult* result) {
-  std::priority_queue<std::pair<std::string, double>,
-                      std::vector<std::pair<std::string, double>>, cmp>
+  std::priority_queue<std::pair<uint64_t, double>,
+                      std::vector<std::pair<uint64_t, double>>, cmp>
       open_pq;
-  std::unordered_map<std::string, std::shared_ptr<Node2d>> open_set;
-  std::unordered_map<std::string, std::shared_ptr<Node2d>> close_set;
+  std::unordered_map<uint64_t, std::shared_ptr<Node2d>> open_set;
+  std::unordered_map<uint64_t, std::shared_ptr<Node2d>> close_set;
   XYbounds_ = XYbounds;
   std::shared_ptr<Node2d> start_node =
       std::make_shared<Node2d>(sx, sy, xy_grid_resolution_, XYbounds_);
@@ -128,7 +147,7 @@ bool GridSearch::GenerateAStarPath(
   // Grid a star begins
   size_t explored_node_num = 0;
   while (!open_pq.empty()) {
-    std::string current_id = open_pq.top().first;
+    const uint64_t current_id = open_pq.top().first;
     open_pq.pop();
     std::shared_ptr<Node2d> current_node = open_set[current_id];
     // Check destination
@@ -175,61 +194,105 @@ bool GridSearch::GenerateDpMap(
             obstacles_linesegments_vec,
         const std::vector<std::vector<common::math::LineSegment2d>>&
             soft_boundary_linesegments_vec) {
-  std::priority_queue<std::pair<std::string, double>,
-                      std::vector<std::pair<std::string, double>>, cmp>
+  // the pq holds dp grid indices, the end node uses -1 when it falls outside
+  // of the grid
+  static constexpr int kOutOfGridIndex = -1;
+  std::priority_queue<std::pair<int, double>,
+                      std::vector<std::pair<int, double>>, cmp>
       open_pq;
-  std::unordered_map<std::string, std::shared_ptr<Node2d>> open_set;
-  dp_map_ = decltype(dp_map_)();
   XYbounds_ = XYbounds;
   // XYbounds with xmin, xmax, ymin, ymax
   max_grid_y_ = std::round((XYbounds_[3] - XYbounds_[2]) / xy_grid_resolution_);
   max_grid_x_ = std::round((XYbounds_[1] - XYbounds_[0]) / xy_grid_resolution_);
-  std::shared_ptr<Node2d> end_node =
-      std::make_shared<Node2d>(ex, ey, xy_grid_resolution_, XYbounds_);
+  dp_grid_x_num_ = static_cast<int>(max_grid_x_) + 1;
+  dp_grid_y_num_ = static_cast<int>(max_grid_y_) + 1;
+  dp_grid_.assign(static_cast<size_t>(dp_grid_x_num_) * dp_grid_y_num_,
+                  DpGridNode());
   obstacles_linesegments_vec_ = obstacles_linesegments_vec;
-  open_set.emplace(end_node->GetIndex(), end_node);
-  open_pq.emplace(end_node->GetIndex(), end_node->GetCost());
+
+  dp_end_grid_x_ = static_cast<int>((ex - XYbounds_[0]) / xy_grid_resolution_);
+  dp_end_grid_y_ = static_cast<int>((ey - XYbounds_[2]) / xy_grid_resolution_);
+  dp_end_in_grid_ = dp_end_grid_x_ >= 0 && dp_end_grid_x_ < dp_grid_x_num_ &&
+                    dp_end_grid_y_ >= 0 && dp_end_grid_y_ < dp_grid_y_num_;
+  if (dp_end_in_grid_) {
+    const int end_index = DpGridIndex(dp_end_grid_x_, dp_end_grid_y_);
+    dp_grid_[end_index].node_state = DpNodeState::kOpen;
+    open_pq.emplace(end_index, 0.0);
+  } else {
+    open_pq.emplace(kOutOfGridIndex, 0.0);
+  }
+
+  // neighbors in the order of up, up_right, right, down_right, down,
+  // down_left, left, up_left
+  static constexpr int kNeighborNum = 8;
+  static constexpr int kNeighborDx[kNeighborNum] = {0, 1, 1, 1, 0, -1, -1, -1};
+  static constexpr int kNeighborDy[kNeighborNum] = {1, 1, 0, -1, -1, -1, 0, 1};
+  const double diagonal_distance = std::sqrt(2.0);
+  const double neighbor_cost[kNeighborNum] = {
+      1.0, diagonal_distance, 1.0, diagonal_distance,
+      1.0, diagonal_distance, 1.0, diagonal_distance};
 
   // Grid a star begins
   size_t explored_node_num = 0;
   while (!open_pq.empty()) {
-    const std::string current_id = open_pq.top().first;
+    const int current_id = open_pq.top().first;
     open_pq.pop();
-    std::shared_ptr<Node2d> current_node = open_set[current_id];
-    dp_map_.emplace(current_node->GetIndex(), current_node);
-    std::vector<std::shared_ptr<Node2d>> next_nodes =
-        std::move(GenerateNextNodes(current_node));
-    for (auto& next_node : next_nodes) {
-      if (!CheckConstraints(next_node)) {
+    int current_x = dp_end_grid_x_;
+    int current_y = dp_end_grid_y_;
+    double current_path_cost = 0.0;
+    if (current_id != kOutOfGridIndex) {
+      DpGridNode& current_node = dp_grid_[current_id];
+      current_node.node_state = DpNodeState::kClosed;
+      current_x = current_id / dp_grid_y_num_;
+      current_y = current_id % dp_grid_y_num_;
+      current_path_cost = current_node.path_cost;
+    }
+    for (int i = 0; i < kNeighborNum; ++i) {
+      const int next_x = current_x + kNeighborDx[i];
+      const int next_y = current_y + kNeighborDy[i];
+      if (!CheckDpGridConstraints(next_x, next_y)) {
         continue;
       }
-      if (dp_map_.find(next_node->GetIndex()) != dp_map_.end()) {
+      const int next_id = DpGridIndex(next_x, next_y);
+      DpGridNode& next_node = dp_grid_[next_id];
+      if (next_node.node_state == DpNodeState::kClosed) {
         continue;
       }
-      if (open_set.find(next_node->GetIndex()) == open_set.end()) {
+      const double next_path_cost = current_path_cost + neighbor_cost[i];
+      if (next_node.node_state == DpNodeState::kUnvisited) {
         ++explored_node_num;
-        next_node->SetPreNode(current_node);
-        open_set.emplace(next_node->GetIndex(), next_node);
-        open_pq.emplace(next_node->GetIndex(), next_node->GetCost());
-      } else {
-        if (open_set[next_node->GetIndex()]->GetCost() > next_node->GetCost()) {
-          open_set[next_node->GetIndex()]->SetCost(next_node->GetCost());
-          open_set[next_node->GetIndex()]->SetPreNode(current_node);
-        }
+        next_node.node_state = DpNodeState::kOpen;
+        next_node.path_cost = next_path_cost;
+        next_node.cost = next_path_cost;
+        open_pq.emplace(next_id, next_path_cost);
+      } else if (next_node.cost > next_path_cost) {
+        next_node.cost = next_path_cost;
       }
     }
   }
+  dp_map_ready_ = true;
   ADEBUG << "explored node num is " << explored_node_num;
   return true;
 }
 
 double GridSearch::CheckDpMap(const double sx, const double sy) {
-  std::string index = Node2d::CalcIndex(sx, sy, xy_grid_resolution_, XYbounds_);
-  if (dp_map_.find(index) != dp_map_.end()) {
-    return dp_map_[index]->GetCost() * xy_grid_resolution_;
-  } else {
+  if (!dp_map_ready_) {
+    return std::numeric_limits<double>::infinity();
+  }
+  const int grid_x = static_cast<int>((sx - XYbounds_[0]) / xy_grid_resolution_);
+  const int grid_y = static_cast<int>((sy - XYbounds_[2]) / xy_grid_resolution_);
+  if (grid_x == dp_end_grid_x_ && grid_y == dp_end_grid_y_) {
+    return 0.0;
+  }
+  if (grid_x < 0 || grid_x >= dp_grid_x_num_ ||
+      grid_y < 0 || grid_y >= dp_grid_y_num_) {
+    return std::numeric_limits<double>::infinity();
+  }
+  const DpGridNode& grid_node = dp_grid_[DpGridIndex(grid_x, grid_y)];
+  if (grid_node.node_state != DpNodeState::kClosed) {
     return std::numeric_limits<double>::infinity();
   }
+  return grid_node.cost * xy_grid_resolution_;
 }
 
 void GridSearch::LoadGridAStarResult(GridAStartResult* result) {
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <queue>
@@ -29,8 +30,6 @@
 #include <unordered_set>
 #include <vector>
 
-#include "absl/strings/str_cat.h"
-
 #include "modules/planning/planning_open_space/proto/planner_open_space_config.pb.h"
 
 #include "cyber/common/log.h"
@@ -46,13 +45,13 @@ class Node2d {
     // XYbounds with xmin, xmax, ymin, ymax
     grid_x_ = static_cast<int>((x - XYbounds[0]) / xy_resolution);
     grid_y_ = static_cast<int>((y - XYbounds[2]) / xy_resolution);
-    index_ = ComputeStringIndex(grid_x_, grid_y_);
+    index_ = ComputeIndex(grid_x_, grid_y_);
   }
   Node2d(const int grid_x, const int grid_y,
          const std::vector<double>& XYbounds) {
     grid_x_ = grid_x;
     grid_y_ = grid_y;
-    index_ = ComputeStringIndex(grid_x_, grid_y_);
+    index_ = ComputeIndex(grid_x_, grid_y_);
   }
   void SetPathCost(const double path_cost) {
     path_cost_ = path_cost;
@@ -75,23 +74,24 @@ class Node2d {
   double GetDistanceToObstacle() const {
       return distance_to_obstacle_;
   }
-  const std::string& GetIndex() const { return index_; }
+  uint64_t GetIndex() const { return index_; }
   std::shared_ptr<Node2d> GetPreNode() const { return pre_node_; }
-  static std::string CalcIndex(const double x, const double y,
-                               const double xy_resolution,
-                               const std::vector<double>& XYbounds) {
+  static uint64_t CalcIndex(const double x, const double y,
+                            const double xy_resolution,
+                            const std::vector<double>& XYbounds) {
     // XYbounds with xmin, xmax, ymin, ymax
     int grid_x = static_cast<int>((x - XYbounds[0]) / xy_resolution);
     int grid_y = static_cast<int>((y - XYbounds[2]) / xy_resolution);
-    return ComputeStringIndex(grid_x, grid_y);
+    return ComputeIndex(grid_x, grid_y);
   }
   bool operator==(const Node2d& right) const {
     return right.GetIndex() == index_;
   }
 
  private:
-  static std::string ComputeStringIndex(int x_grid, int y_grid) {
-    return absl::StrCat(x_grid, "_", y_grid);
+  static uint64_t ComputeIndex(int x_grid, int y_grid) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x_grid)) << 32) |
+           static_cast<uint32_t>(y_grid);
   }
 
  private:
@@ -101,7 +101,7 @@ class Node2d {
   double heuristic_ = 0.0;
   double cost_ = 0.0;
   double distance_to_obstacle_ = std::numeric_limits<double>::max();
-  std::string index_;
+  uint64_t index_ = 0;
   std::shared_ptr<Node2d> pre_node_ = nullptr;
 };
 
@@ -137,6 +137,9 @@ class GridSearch {
   std::vector<std::shared_ptr<Node2d>> GenerateNextNodes(
       std::shared_ptr<Node2d> node);
   bool CheckConstraints(std::shared_ptr<Node2d> node);
+  bool CheckConstraints(const int grid_x, const int grid_y);
+  // same as CheckConstraints but caches the obstacle check per dp grid cell
+  bool CheckDpGridConstraints(const int grid_x, const int grid_y);
   void LoadGridAStarResult(GridAStartResult* result);
 
  private:
@@ -152,13 +155,34 @@ class GridSearch {
       obstacles_linesegments_vec_;
 
   struct cmp {
-      bool operator()(const std::pair<std::string,
-                      double>& left,
-                      const std::pair<std::string, double>& right) const {
+      template <typename Key>
+      bool operator()(const std::pair<Key, double>& left,
+                      const std::pair<Key, double>& right) const {
           return left.second >= right.second;
       }
   };
-  std::unordered_map<std::string, std::shared_ptr<Node2d>> dp_map_;
+
+  // dense dp map over the [0, max_grid_x_] x [0, max_grid_y_] grid, indexed
+  // by grid_x * dp_grid_y_num_ + grid_y
+  enum class DpNodeState : uint8_t { kUnvisited, kOpen, kClosed };
+  enum class DpCellState : uint8_t { kUnknown, kFree, kOccupied };
+  struct DpGridNode {
+    double path_cost = 0.0;
+    double cost = 0.0;
+    DpNodeState node_state = DpNodeState::kUnvisited;
+    DpCellState cell_state = DpCellState::kUnknown;
+  };
+  int DpGridIndex(const int grid_x, const int grid_y) const {
+    return grid_x * dp_grid_y_num_ + grid_y;
+  }
+  std::vector<DpGridNode> dp_grid_;
+  int dp_grid_x_num_ = 0;
+  int dp_grid_y_num_ = 0;
+  // the dp start grid may lie outside of XYbounds, keep it aside then
+  int dp_end_grid_x_ = 0;
+  int dp_end_grid_y_ = 0;
+  bool dp_end_in_grid_ = false;
+  bool dp_map_ready_ = false;
 
   // park generic
  public:
@@ -173,7 +197,7 @@ class GridSearch {
       const int& x,
       const int& y,
       common::math::Vec2d origin_index,
-      std::unordered_set<std::string>& close_set);
+      std::unordered_set<uint64_t>& close_set);
   std::vector<std::vector<common::math::LineSegment2d>>
       soft_boundary_linesegments_vec_;
   double esdf_range_ = 0.0;
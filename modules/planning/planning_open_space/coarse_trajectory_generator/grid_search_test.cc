@@ -0,0 +1,195 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/*
+ * @file
+ */
+
+#include "modules/planning/planning_open_space/coarse_trajectory_generator/grid_search.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "modules/common/math/line_segment2d.h"
+#include "modules/common/math/vec2d.h"
+
+namespace apollo {
+namespace planning {
+
+using apollo::common::math::LineSegment2d;
+using apollo::common::math::Vec2d;
+
+namespace {
+
+// node keyed dp map search, kept as the reference of the dense dp grid
+class ReferenceDpMap {
+ public:
+  ReferenceDpMap(const double resolution, const double node_radius)
+      : resolution_(resolution), node_radius_(node_radius) {}
+
+  void Generate(const double ex, const double ey,
+                const std::vector<double>& XYbounds,
+                const std::vector<std::vector<LineSegment2d>>& obstacles) {
+    struct Cmp {
+      bool operator()(const std::pair<uint64_t, double>& left,
+                      const std::pair<uint64_t, double>& right) const {
+        return left.second >= right.second;
+      }
+    };
+    std::priority_queue<std::pair<uint64_t, double>,
+                        std::vector<std::pair<uint64_t, double>>, Cmp>
+        open_pq;
+    std::unordered_map<uint64_t, std::shared_ptr<Node2d>> open_set;
+    dp_map_.clear();
+    XYbounds_ = XYbounds;
+    const double max_grid_x =
+        std::round((XYbounds[1] - XYbounds[0]) / resolution_);
+    const double max_grid_y =
+        std::round((XYbounds[3] - XYbounds[2]) / resolution_);
+    auto end_node = std::make_shared<Node2d>(ex, ey, resolution_, XYbounds);
+    open_set.emplace(end_node->GetIndex(), end_node);
+    open_pq.emplace(end_node->GetIndex(), end_node->GetCost());
+    const int dx[] = {0, 1, 1, 1, 0, -1, -1, -1};
+    const int dy[] = {1, 1, 0, -1, -1, -1, 0, 1};
+    while (!open_pq.empty()) {
+      const uint64_t current_id = open_pq.top().first;
+      open_pq.pop();
+      std::shared_ptr<Node2d> current_node = open_set[current_id];
+      dp_map_.emplace(current_id, current_node);
+      for (int i = 0; i < 8; ++i) {
+        const int next_x = static_cast<int>(current_node->GetGridX()) + dx[i];
+        const int next_y = static_cast<int>(current_node->GetGridY()) + dy[i];
+        auto next_node = std::make_shared<Node2d>(next_x, next_y, XYbounds);
+        next_node->SetPathCost(current_node->GetPathCost() +
+                               ((dx[i] != 0 && dy[i] != 0) ? std::sqrt(2.0)
+                                                           : 1.0));
+        if (next_x > max_grid_x || next_x < 0 || next_y > max_grid_y ||
+            next_y < 0) {
+          continue;
+        }
+        bool collision = false;
+        for (const auto& obstacle : obstacles) {
+          for (const auto& segment : obstacle) {
+            if (segment.DistanceTo(Vec2d(next_x, next_y)) < node_radius_) {
+              collision = true;
+            }
+          }
+        }
+        if (collision || dp_map_.count(next_node->GetIndex()) > 0) {
+          continue;
+        }
+        auto iter = open_set.find(next_node->GetIndex());
+        if (iter == open_set.end()) {
+          open_set.emplace(next_node->GetIndex(), next_node);
+          open_pq.emplace(next_node->GetIndex(), next_node->GetCost());
+        } else if (iter->second->GetCost() > next_node->GetCost()) {
+          iter->second->SetCost(next_node->GetCost());
+        }
+      }
+    }
+  }
+
+  double Check(const double sx, const double sy) const {
+    auto iter =
+        dp_map_.find(Node2d::CalcIndex(sx, sy, resolution_, XYbounds_));
+    if (iter == dp_map_.end()) {
+      return std::numeric_limits<double>::infinity();
+    }
+    return iter->second->GetCost() * resolution_;
+  }
+
+ private:
+  double resolution_ = 0.0;
+  double node_radius_ = 0.0;
+  std::vector<double> XYbounds_;
+  std::unordered_map<uint64_t, std::shared_ptr<Node2d>> dp_map_;
+};
+
+}  // namespace
+
+class GridSearchTest : public ::testing::Test {
+ public:
+  virtual void SetUp() {
+    auto* warm_start_config =
+        planner_open_space_config_.mutable_warm_start_config();
+    warm_start_config->set_grid_a_star_xy_resolution(0.5);
+    warm_start_config->set_node_radius(0.5);
+    grid_search_.reset(new GridSearch(planner_open_space_config_));
+    XYbounds_ = {-10.0, 10.0, -8.0, 8.0};
+    // a wall with a gap and an isolated box
+    obstacles_.push_back({LineSegment2d({-2.0, -8.0}, {-2.0, 4.0})});
+    obstacles_.push_back({LineSegment2d({3.0, -3.0}, {6.0, -3.0}),
+                          LineSegment2d({6.0, -3.0}, {6.0, 0.0}),
+                          LineSegment2d({6.0, 0.0}, {3.0, 0.0}),
+                          LineSegment2d({3.0, 0.0}, {3.0, -3.0})});
+  }
+
+ protected:
+  void ExpectSameAsReference(const double ex, const double ey) {
+    ReferenceDpMap reference(
+        planner_open_space_config_.warm_start_config()
+            .grid_a_star_xy_resolution(),
+        planner_open_space_config_.warm_start_config().node_radius());
+    reference.Generate(ex, ey, XYbounds_, obstacles_);
+    ASSERT_TRUE(grid_search_->GenerateDpMap(ex, ey, XYbounds_, obstacles_));
+    for (double x = XYbounds_[0] - 1.0; x <= XYbounds_[1] + 1.0; x += 0.25) {
+      for (double y = XYbounds_[2] - 1.0; y <= XYbounds_[3] + 1.0; y += 0.25) {
+        const double expected = reference.Check(x, y);
+        const double actual = grid_search_->CheckDpMap(x, y);
+        if (std::isinf(expected)) {
+          EXPECT_TRUE(std::isinf(actual)) << x << ", " << y;
+        } else {
+          EXPECT_DOUBLE_EQ(expected, actual) << x << ", " << y;
+        }
+      }
+    }
+  }
+
+  PlannerOpenSpaceConfig planner_open_space_config_;
+  std::unique_ptr<GridSearch> grid_search_;
+  std::vector<double> XYbounds_;
+  std::vector<std::vector<LineSegment2d>> obstacles_;
+};
+
+TEST_F(GridSearchTest, dp_map_without_obstacles) {
+  obstacles_.clear();
+  ASSERT_TRUE(grid_search_->GenerateDpMap(0.0, 0.0, XYbounds_, obstacles_));
+  EXPECT_DOUBLE_EQ(0.0, grid_search_->CheckDpMap(0.0, 0.0));
+  EXPECT_DOUBLE_EQ(0.5, grid_search_->CheckDpMap(0.6, 0.0));
+  EXPECT_DOUBLE_EQ(0.5 * std::sqrt(2.0), grid_search_->CheckDpMap(0.6, 0.6));
+  EXPECT_TRUE(std::isinf(grid_search_->CheckDpMap(-11.0, 0.0)));
+}
+
+TEST_F(GridSearchTest, dp_map_same_as_reference) {
+  ExpectSameAsReference(8.0, 6.0);
+  ExpectSameAsReference(-9.0, -7.0);
+  ExpectSameAsReference(4.2, -1.3);
+}
+
+TEST_F(GridSearchTest, dp_map_end_out_of_bounds) {
+  ExpectSameAsReference(10.8, 2.0);
+  ExpectSameAsReference(-10.6, 9.0);
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -43,6 +43,8 @@ HybridAStar::HybridAStar(const PlannerOpenSpaceConfig& open_space_conf) {
       std::make_unique<GridSearch>(planner_open_space_config_);
   next_node_num_ =
       planner_open_space_config_.warm_start_config().next_node_num();
+  rs_candidate_num_ = std::max<size_t>(
+      1, planner_open_space_config_.warm_start_config().rs_candidate_num());
   max_steer_angle_ = vehicle_param_.max_steer_angle() /
                      vehicle_param_.steer_ratio() *
                      planner_open_space_config_.warm_start_config()
@@ -108,41 +110,52 @@ HybridAStar::HybridAStar(const PlannerOpenSpaceConfig& open_space_conf) {
 bool HybridAStar::AnalyticExpansion(
     std::shared_ptr<Node3d> current_node,
     std::shared_ptr<Node3d>* candidate_final_node) {
-  std::shared_ptr<ReedSheppPath> reeds_shepp_to_check =
-      std::make_shared<ReedSheppPath>();
-  if (!reed_shepp_generator_->ShortestRSP(current_node, end_node_,
-                                          reeds_shepp_to_check)) {
+  std::vector<ReedSheppPath> reeds_shepp_candidates;
+  if (!reed_shepp_generator_->RSPCandidates(current_node, end_node_,
+                                            rs_candidate_num_,
+                                            &reeds_shepp_candidates)) {
     return false;
   }
-  if (!RSPCheck(reeds_shepp_to_check)) {
-    return false;
+  // candidates are sorted by cost, take the first collision free one
+  const int candidate_num = static_cast<int>(reeds_shepp_candidates.size());
+  std::vector<char> collision_free(candidate_num, 0);
+#pragma omp parallel for schedule(dynamic, 1) num_threads(8) \
+    if (FLAGS_enable_parallel_hybrid_a && candidate_num > 1)
+  for (int i = 0; i < candidate_num; ++i) {
+    collision_free[i] = RSPCheck(reeds_shepp_candidates[i]);
+  }
+  for (int i = 0; i < candidate_num; ++i) {
+    if (collision_free[i]) {
+      // load the whole RSP as nodes and add to the close set
+      *candidate_final_node =
+          LoadRSPinCS(reeds_shepp_candidates[i], current_node);
+      return true;
+    }
   }
-  // load the whole RSP as nodes and add to the close set
-  *candidate_final_node = LoadRSPinCS(reeds_shepp_to_check, current_node);
-  return true;
+  return false;
 }
 
-bool HybridAStar::RSPCheck(
-    const std::shared_ptr<ReedSheppPath> reeds_shepp_to_end) {
-  std::shared_ptr<Node3d> node = std::shared_ptr<Node3d>(new Node3d(
-      reeds_shepp_to_end->x, reeds_shepp_to_end->y, reeds_shepp_to_end->phi,
-      XYbounds_, planner_open_space_config_));
-  return ValidityCheck(node);
+bool HybridAStar::RSPCheck(const ReedSheppPath& reeds_shepp_to_end) const {
+  return ValidityCheck(reeds_shepp_to_end.x, reeds_shepp_to_end.y,
+                       reeds_shepp_to_end.phi);
 }
 
-bool HybridAStar::ValidityCheck(std::shared_ptr<Node3d> node) {
+bool HybridAStar::ValidityCheck(std::shared_ptr<Node3d> node) const {
   CHECK_NOTNULL(node);
-  CHECK_GT(node->GetStepSize(), 0U);
+  return ValidityCheck(node->GetXs(), node->GetYs(), node->GetPhis());
+}
+
+bool HybridAStar::ValidityCheck(
+    const std::vector<double>& traversed_x,
+    const std::vector<double>& traversed_y,
+    const std::vector<double>& traversed_phi) const {
+  const size_t node_step_size = traversed_x.size();
+  CHECK_GT(node_step_size, 0U);
 
   if (obstacles_linesegments_vec_.empty()) {
     return true;
   }
 
-  size_t node_step_size = node->GetStepSize();
-  const auto& traversed_x = node->GetXs();
-  const auto& traversed_y = node->GetYs();
-  const auto& traversed_phi = node->GetPhis();
-
   // The first {x, y, phi} is collision free unless they are start and end
   // configuration of search problem
   size_t check_start_index = 0;
@@ -159,30 +172,21 @@ bool HybridAStar::ValidityCheck(std::shared_ptr<Node3d> node) {
     }
     Box2d bounding_box = Node3d::GetBoundingBox(
         vehicle_param_, traversed_x[i], traversed_y[i], traversed_phi[i]);
-    for (const auto& obstacle_linesegments : obstacles_linesegments_vec_) {
-      for (const common::math::LineSegment2d& linesegment :
-           obstacle_linesegments) {
-        if (bounding_box.HasOverlap(linesegment)) {
-          ADEBUG << "collision start at x: " << linesegment.start().x();
-          ADEBUG << "collision start at y: " << linesegment.start().y();
-          ADEBUG << "collision end at x: " << linesegment.end().x();
-          ADEBUG << "collision end at y: " << linesegment.end().y();
-          return false;
-        }
-      }
+    if (obstacle_segment_index_.HasOverlap(bounding_box)) {
+      return false;
     }
   }
   return true;
 }
 
 std::shared_ptr<Node3d> HybridAStar::LoadRSPinCS(
-    const std::shared_ptr<ReedSheppPath> reeds_shepp_to_end,
+    const ReedSheppPath& reeds_shepp_to_end,
     std::shared_ptr<Node3d> current_node) {
-  std::shared_ptr<Node3d> end_node = std::shared_ptr<Node3d>(new Node3d(
-      reeds_shepp_to_end->x, reeds_shepp_to_end->y, reeds_shepp_to_end->phi,
-      XYbounds_, planner_open_space_config_));
+  std::shared_ptr<Node3d> end_node = std::make_shared<Node3d>(
+      reeds_shepp_to_end.x, reeds_shepp_to_end.y, reeds_shepp_to_end.phi,
+      XYbounds_, planner_open_space_config_);
   end_node->SetPre(current_node);
-  end_node->SetTrajCost(current_node->GetTrajCost() + reeds_shepp_to_end->cost);
+  end_node->SetTrajCost(current_node->GetTrajCost() + reeds_shepp_to_end.cost);
   return end_node;
 }
 
@@ -240,9 +244,16 @@ std::shared_ptr<Node3d> HybridAStar::Next_node_generator(
       intermediate_y.back() < XYbounds_[2]) {
     return nullptr;
   }
-  std::shared_ptr<Node3d> next_node = std::shared_ptr<Node3d>(
-      new Node3d(intermediate_x, intermediate_y, intermediate_phi, XYbounds_,
-                 planner_open_space_config_));
+  // skip building nodes whose grid is already closed
+  if (close_set_.count(Node3d::CalcIndex(
+          intermediate_x.back(), intermediate_y.back(),
+          intermediate_phi.back(), XYbounds_, planner_open_space_config_)) >
+      0) {
+    return nullptr;
+  }
+  std::shared_ptr<Node3d> next_node = std::make_shared<Node3d>(
+      std::move(intermediate_x), std::move(intermediate_y),
+      std::move(intermediate_phi), XYbounds_, planner_open_space_config_);
   next_node->SetPre(current_node);
   next_node->SetDirec(traveled_distance > 0.0);
   next_node->SetSteer(steering);
@@ -714,6 +725,10 @@ bool HybridAStar::Plan(
   // clear containers
   open_set_.clear();
   close_set_.clear();
+  open_set_.reserve(
+      planner_open_space_config_.warm_start_config().max_explored_num());
+  close_set_.reserve(
+      planner_open_space_config_.warm_start_config().max_explored_num());
   open_pq_ = decltype(open_pq_)();
   final_node_ = nullptr;
   PrintCurves print_curves;
@@ -731,6 +746,7 @@ bool HybridAStar::Plan(
     obstacles_linesegments_vec.emplace_back(obstacle_linesegments);
   }
   obstacles_linesegments_vec_ = std::move(obstacles_linesegments_vec);
+  obstacle_segment_index_.Init(obstacles_linesegments_vec_);
   for (size_t i = 0; i < obstacles_linesegments_vec_.size(); i++) {
     for (auto linesg : obstacles_linesegments_vec_[i]) {
       std::string name = std::to_string(i) + "roi_boundary";
@@ -833,13 +849,13 @@ bool HybridAStar::Plan(
 
     size_t begin_index = 0;
     size_t end_index = next_node_num_;
-    std::unordered_set<std::string> temp_set;
+    std::unordered_set<uint64_t> temp_set;
     for (size_t i = begin_index; i < end_index; ++i) {
       const double gen_node_time = Clock::NowInSeconds();
       std::shared_ptr<Node3d> next_node = Next_node_generator(current_node, i);
       node_generator_time += Clock::NowInSeconds() - gen_node_time;
 
-      // boundary check failure handle
+      // boundary check failure or already closed
       if (next_node == nullptr) {
         continue;
       }
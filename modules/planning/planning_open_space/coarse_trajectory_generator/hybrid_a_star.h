@@ -21,6 +21,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <queue>
 #include <string>
@@ -41,6 +42,7 @@
 #include "modules/planning/planning_base/gflags/planning_gflags.h"
 #include "modules/planning/planning_open_space/coarse_trajectory_generator/grid_search.h"
 #include "modules/planning/planning_open_space/coarse_trajectory_generator/node3d.h"
+#include "modules/planning/planning_open_space/coarse_trajectory_generator/obstacle_segment_index.h"
 #include "modules/planning/planning_open_space/coarse_trajectory_generator/reeds_shepp_path.h"
 
 namespace apollo {
@@ -69,12 +71,16 @@ class HybridAStar {
           std::shared_ptr<Node3d> current_node,
           std::shared_ptr<Node3d>* candidate_final_node);
   // check collision and validity
-  bool ValidityCheck(std::shared_ptr<Node3d> node);
+  bool ValidityCheck(std::shared_ptr<Node3d> node) const;
+  bool ValidityCheck(
+          const std::vector<double>& traversed_x,
+          const std::vector<double>& traversed_y,
+          const std::vector<double>& traversed_phi) const;
   // check Reeds Shepp path collision and validity
-  bool RSPCheck(const std::shared_ptr<ReedSheppPath> reeds_shepp_to_end);
+  bool RSPCheck(const ReedSheppPath& reeds_shepp_to_end) const;
   // load the whole RSP as nodes and add to the close set
   std::shared_ptr<Node3d> LoadRSPinCS(
-          const std::shared_ptr<ReedSheppPath> reeds_shepp_to_end,
+          const ReedSheppPath& reeds_shepp_to_end,
           std::shared_ptr<Node3d> current_node);
   std::shared_ptr<Node3d> Next_node_generator(
           std::shared_ptr<Node3d> current_node,
@@ -96,6 +102,7 @@ class HybridAStar {
   common::VehicleParam vehicle_param_ =
       common::VehicleConfigHelper::GetConfig().vehicle_param();
   size_t next_node_num_ = 0;
+  size_t rs_candidate_num_ = 1;
   double max_steer_angle_ = 0.0;
   double max_kappa_ = 0.0;
   double step_size_ = 0.0;
@@ -129,6 +136,7 @@ class HybridAStar {
   std::shared_ptr<Node3d> final_node_;
   std::vector<std::vector<common::math::LineSegment2d>>
       obstacles_linesegments_vec_;
+  ObstacleSegmentIndex obstacle_segment_index_;
 
   struct cmp {
       bool operator()(
@@ -142,8 +150,8 @@ class HybridAStar {
           std::vector<std::pair<std::shared_ptr<Node3d>, double>>,
           cmp>
           open_pq_;
-  std::unordered_set<std::string> open_set_;
-  std::unordered_set<std::string> close_set_;
+  std::unordered_set<uint64_t> open_set_;
+  std::unordered_set<uint64_t> close_set_;
   std::unique_ptr<ReedShepp> reed_shepp_generator_;
   std::unique_ptr<GridSearch> grid_a_star_heuristic_generator_;
 
@@ -20,6 +20,8 @@
 
 #include "modules/planning/planning_open_space/coarse_trajectory_generator/hybrid_a_star.h"
 
+#include <chrono>
+
 #include "gtest/gtest.h"
 
 #include "cyber/common/file.h"
@@ -79,5 +81,48 @@ TEST_F(HybridATest, test1) {
                                 obstacles_list, &result,
                                 soft_obstacles_list, false));
 }
+TEST_F(HybridATest, repeated_plan_benchmark) {
+  // a perpendicular parking spot below a straight lane
+  const double sx = -10.0;
+  const double sy = 4.0;
+  const double sphi = 0.0;
+  const double ex = 0.0;
+  const double ey = -4.0;
+  const double ephi = M_PI_2;
+  std::vector<std::vector<Vec2d>> obstacles_list = {
+      {Vec2d(-20.0, -1.5), Vec2d(-1.5, -1.5), Vec2d(-1.5, -8.0)},
+      {Vec2d(1.5, -8.0), Vec2d(1.5, -1.5), Vec2d(20.0, -1.5)},
+      {Vec2d(-20.0, 9.0), Vec2d(20.0, 9.0)}};
+  std::vector<std::vector<Vec2d>> soft_obstacles_list;
+  std::vector<double> XYbounds = {-20.0, 20.0, -10.0, 10.0};
+
+  static constexpr int kRepeatNum = 5;
+  HybridAStartResult first_result;
+  double total_time_ms = 0.0;
+  for (int i = 0; i < kRepeatNum; ++i) {
+    HybridAStartResult result;
+    const auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(hybrid_test->Plan(sx, sy, sphi, ex, ey, ephi, XYbounds,
+                                  obstacles_list, &result,
+                                  soft_obstacles_list, false));
+    total_time_ms += std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+    if (i == 0) {
+      first_result = result;
+      continue;
+    }
+    // node storage must not change the search result between runs
+    ASSERT_EQ(first_result.x.size(), result.x.size());
+    for (size_t j = 0; j < result.x.size(); ++j) {
+      EXPECT_DOUBLE_EQ(first_result.x[j], result.x[j]);
+      EXPECT_DOUBLE_EQ(first_result.y[j], result.y[j]);
+      EXPECT_DOUBLE_EQ(first_result.phi[j], result.phi[j]);
+    }
+  }
+  AINFO << "hybrid a star average plan time " << total_time_ms / kRepeatNum
+        << " ms, path points " << first_result.x.size();
+}
+
 }  // namespace planning
 }  // namespace apollo
@@ -20,7 +20,7 @@
 
 #include "modules/planning/planning_open_space/coarse_trajectory_generator/node3d.h"
 
-#include "absl/strings/str_cat.h"
+#include <utility>
 
 #include "cyber/common/log.h"
 
@@ -45,27 +45,26 @@ Node3d::Node3d(double x, double y, double phi,
   y_ = y;
   phi_ = phi;
 
-  x_grid_ = static_cast<int>(
-      (x_ - XYbounds[0]) /
-      open_space_conf.warm_start_config().xy_grid_resolution());
-  y_grid_ = static_cast<int>(
-      (y_ - XYbounds[2]) /
-      open_space_conf.warm_start_config().xy_grid_resolution());
-  phi_grid_ = static_cast<int>(
-      (phi_ - (-M_PI)) /
-      open_space_conf.warm_start_config().phi_grid_resolution());
-
   traversed_x_.push_back(x);
   traversed_y_.push_back(y);
   traversed_phi_.push_back(phi);
 
-  index_ = ComputeStringIndex(x_grid_, y_grid_, phi_grid_);
+  InitGrid(XYbounds, open_space_conf);
 }
 
 Node3d::Node3d(const std::vector<double>& traversed_x,
                const std::vector<double>& traversed_y,
                const std::vector<double>& traversed_phi,
                const std::vector<double>& XYbounds,
+               const PlannerOpenSpaceConfig& open_space_conf)
+    : Node3d(std::vector<double>(traversed_x),
+             std::vector<double>(traversed_y),
+             std::vector<double>(traversed_phi), XYbounds, open_space_conf) {}
+
+Node3d::Node3d(std::vector<double>&& traversed_x,
+               std::vector<double>&& traversed_y,
+               std::vector<double>&& traversed_phi,
+               const std::vector<double>& XYbounds,
                const PlannerOpenSpaceConfig& open_space_conf) {
   CHECK_EQ(XYbounds.size(), 4U)
       << "XYbounds size is not 4, but" << XYbounds.size();
@@ -76,6 +75,16 @@ Node3d::Node3d(const std::vector<double>& traversed_x,
   y_ = traversed_y.back();
   phi_ = traversed_phi.back();
 
+  traversed_x_ = std::move(traversed_x);
+  traversed_y_ = std::move(traversed_y);
+  traversed_phi_ = std::move(traversed_phi);
+
+  InitGrid(XYbounds, open_space_conf);
+  step_size_ = traversed_x_.size();
+}
+
+void Node3d::InitGrid(const std::vector<double>& XYbounds,
+                      const PlannerOpenSpaceConfig& open_space_conf) {
   // XYbounds in xmin, xmax, ymin, ymax
   x_grid_ = static_cast<int>(
       (x_ - XYbounds[0]) /
@@ -86,13 +95,22 @@ Node3d::Node3d(const std::vector<double>& traversed_x,
   phi_grid_ = static_cast<int>(
       (phi_ - (-M_PI)) /
       open_space_conf.warm_start_config().phi_grid_resolution());
+  index_ = ComputeIndex(x_grid_, y_grid_, phi_grid_);
+}
 
-  traversed_x_ = traversed_x;
-  traversed_y_ = traversed_y;
-  traversed_phi_ = traversed_phi;
-
-  index_ = ComputeStringIndex(x_grid_, y_grid_, phi_grid_);
-  step_size_ = traversed_x.size();
+uint64_t Node3d::CalcIndex(const double x, const double y, const double phi,
+                           const std::vector<double>& XYbounds,
+                           const PlannerOpenSpaceConfig& open_space_conf) {
+  const int x_grid = static_cast<int>(
+      (x - XYbounds[0]) /
+      open_space_conf.warm_start_config().xy_grid_resolution());
+  const int y_grid = static_cast<int>(
+      (y - XYbounds[2]) /
+      open_space_conf.warm_start_config().xy_grid_resolution());
+  const int phi_grid = static_cast<int>(
+      (phi - (-M_PI)) /
+      open_space_conf.warm_start_config().phi_grid_resolution());
+  return ComputeIndex(x_grid, y_grid, phi_grid);
 }
 
 Box2d Node3d::GetBoundingBox(const common::VehicleParam& vehicle_param_,
@@ -111,8 +129,14 @@ bool Node3d::operator==(const Node3d& right) const {
     return right.GetIndex() == index_;
 }
 
-std::string Node3d::ComputeStringIndex(int x_grid, int y_grid, int phi_grid) {
-    return absl::StrCat(x_grid, "_", y_grid, "_", phi_grid);
+uint64_t Node3d::ComputeIndex(int x_grid, int y_grid, int phi_grid) {
+  static constexpr int64_t kXYOffset = 1 << 23;
+  static constexpr int64_t kPhiOffset = 1 << 15;
+  const uint64_t x_key = static_cast<uint64_t>(x_grid + kXYOffset) & 0xFFFFFF;
+  const uint64_t y_key = static_cast<uint64_t>(y_grid + kXYOffset) & 0xFFFFFF;
+  const uint64_t phi_key =
+      static_cast<uint64_t>(phi_grid + kPhiOffset) & 0xFFFF;
+  return (x_key << 40) | (y_key << 16) | phi_key;
 }
 
 }  // namespace planning
@@ -20,8 +20,8 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
-#include <string>
 #include <vector>
 
 #include "modules/common_msgs/config_msgs/vehicle_config.pb.h"
@@ -45,7 +45,16 @@ class Node3d {
           const std::vector<double>& traversed_phi,
           const std::vector<double>& XYbounds,
           const PlannerOpenSpaceConfig& open_space_conf);
+  Node3d(std::vector<double>&& traversed_x,
+          std::vector<double>&& traversed_y,
+          std::vector<double>&& traversed_phi,
+          const std::vector<double>& XYbounds,
+          const PlannerOpenSpaceConfig& open_space_conf);
   virtual ~Node3d() = default;
+  // grid index of a pose, equal to GetIndex() of a node ending at this pose
+  static uint64_t CalcIndex(const double x, const double y, const double phi,
+                            const std::vector<double>& XYbounds,
+                            const PlannerOpenSpaceConfig& open_space_conf);
   static apollo::common::math::Box2d GetBoundingBox(
           const common::VehicleParam& vehicle_param_,
           const double x,
@@ -76,7 +85,7 @@ class Node3d {
       return phi_;
   }
   bool operator==(const Node3d& right) const;
-  const std::string& GetIndex() const {
+  uint64_t GetIndex() const {
       return index_;
   }
   size_t GetStepSize() const {
@@ -123,8 +132,11 @@ class Node3d {
   }
 
  private:
-  static std::string ComputeStringIndex(
-          int x_grid, int y_grid, int phi_grid);
+  void InitGrid(const std::vector<double>& XYbounds,
+                const PlannerOpenSpaceConfig& open_space_conf);
+  // packs the three grid coordinates into one integer key, x and y keep 24
+  // bits and phi 16 bits, which covers any open space roi.
+  static uint64_t ComputeIndex(int x_grid, int y_grid, int phi_grid);
 
  private:
   double x_ = 0.0;
@@ -137,7 +149,7 @@ class Node3d {
   int x_grid_ = 0;
   int y_grid_ = 0;
   int phi_grid_ = 0;
-  std::string index_;
+  uint64_t index_ = 0;
   double traj_cost_ = 0.0;
   double heuristic_cost_ = 0.0;
   double cost_ = 0.0;
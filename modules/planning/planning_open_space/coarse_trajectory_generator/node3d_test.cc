@@ -62,5 +62,34 @@ TEST_F(Node3dTest, GetBoundingBox) {
   ASSERT_EQ(test_box.width(), gold_box.width());
 }
 
+TEST_F(Node3dTest, GetIndex) {
+  PlannerOpenSpaceConfig open_space_conf;
+  open_space_conf.mutable_warm_start_config()->set_xy_grid_resolution(0.3);
+  open_space_conf.mutable_warm_start_config()->set_phi_grid_resolution(0.1);
+  const std::vector<double> XYbounds = {-50.0, 50.0, -50.0, 50.0};
+  Node3d node(1.0, -2.0, 0.5, XYbounds, open_space_conf);
+  EXPECT_EQ(node.GetIndex(),
+            Node3d::CalcIndex(1.0, -2.0, 0.5, XYbounds, open_space_conf));
+  // same grid
+  Node3d same_grid_node(1.05, -2.05, 0.51, XYbounds, open_space_conf);
+  EXPECT_EQ(node.GetIndex(), same_grid_node.GetIndex());
+  EXPECT_TRUE(node == same_grid_node);
+  // traversed nodes are indexed by their last pose
+  Node3d traversed_node({0.0, 0.5, 1.0}, {-2.0, -2.0, -2.0}, {0.5, 0.5, 0.5},
+                        XYbounds, open_space_conf);
+  EXPECT_EQ(node.GetIndex(), traversed_node.GetIndex());
+  EXPECT_EQ(3U, traversed_node.GetStepSize());
+  // neighbor grids in every dimension, including below the lower bounds
+  EXPECT_NE(node.GetIndex(),
+            Node3d(1.4, -2.0, 0.5, XYbounds, open_space_conf).GetIndex());
+  EXPECT_NE(node.GetIndex(),
+            Node3d(1.0, -2.4, 0.5, XYbounds, open_space_conf).GetIndex());
+  EXPECT_NE(node.GetIndex(),
+            Node3d(1.0, -2.0, 0.7, XYbounds, open_space_conf).GetIndex());
+  EXPECT_NE(
+      Node3d(-50.5, -50.0, 0.0, XYbounds, open_space_conf).GetIndex(),
+      Node3d(-50.0, -50.5, 0.0, XYbounds, open_space_conf).GetIndex());
+}
+
 }  // namespace planning
 }  // namespace apollo
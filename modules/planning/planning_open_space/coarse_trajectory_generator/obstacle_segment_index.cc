@@ -0,0 +1,68 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/*
+ * @file
+ */
+
+#include "modules/planning/planning_open_space/coarse_trajectory_generator/obstacle_segment_index.h"
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace planning {
+
+using apollo::common::math::Box2d;
+using apollo::common::math::LineSegment2d;
+using apollo::common::math::ShapeKDTree2d;
+
+void ObstacleSegmentIndex::Init(
+    const std::vector<std::vector<LineSegment2d>>& obstacles_linesegments_vec) {
+  Clear();
+  for (const auto& obstacle_linesegments : obstacles_linesegments_vec) {
+    segments_.insert(segments_.end(), obstacle_linesegments.begin(),
+                     obstacle_linesegments.end());
+  }
+  if (segments_.empty()) {
+    return;
+  }
+  kdtree_.reset(new ShapeKDTree2d<LineSegment2d>(segments_));
+}
+
+void ObstacleSegmentIndex::Clear() {
+  kdtree_.reset();
+  segments_.clear();
+}
+
+bool ObstacleSegmentIndex::HasOverlap(const Box2d& box) const {
+  if (kdtree_ == nullptr) {
+    return false;
+  }
+  for (const auto* segment_object : kdtree_->GetOverlapCandidates(box)) {
+    const LineSegment2d& linesegment = segment_object->shape();
+    if (box.HasOverlap(linesegment)) {
+      ADEBUG << "collision start at x: " << linesegment.start().x();
+      ADEBUG << "collision start at y: " << linesegment.start().y();
+      ADEBUG << "collision end at x: " << linesegment.end().x();
+      ADEBUG << "collision end at y: " << linesegment.end().y();
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,65 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/*
+ * @file
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "cyber/common/macros.h"
+#include "modules/common/math/box2d.h"
+#include "modules/common/math/line_segment2d.h"
+#include "modules/common/math/shape_kdtree2d.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class ObstacleSegmentIndex
+ * @brief KD-tree over obstacle line segments, so that a vehicle box only
+ *        runs the exact overlap test against the segments around it.
+ */
+class ObstacleSegmentIndex {
+ public:
+  ObstacleSegmentIndex() = default;
+
+  void Init(const std::vector<std::vector<common::math::LineSegment2d>>&
+                obstacles_linesegments_vec);
+
+  void Clear();
+
+  bool IsEmpty() const { return segments_.empty(); }
+
+  /**
+   * @brief Check whether the box overlaps any obstacle segment, gives the
+   *        same answer as testing Box2d::HasOverlap against every segment.
+   */
+  bool HasOverlap(const common::math::Box2d& box) const;
+
+ private:
+  std::vector<common::math::LineSegment2d> segments_;
+  std::unique_ptr<common::math::ShapeKDTree2d<common::math::LineSegment2d>>
+      kdtree_;
+
+  DISALLOW_COPY_AND_ASSIGN(ObstacleSegmentIndex);
+};
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,85 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/*
+ * @file
+ */
+
+#include "modules/planning/planning_open_space/coarse_trajectory_generator/obstacle_segment_index.h"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace planning {
+
+using apollo::common::math::Box2d;
+using apollo::common::math::LineSegment2d;
+using apollo::common::math::Vec2d;
+
+TEST(ObstacleSegmentIndexTest, empty) {
+  ObstacleSegmentIndex index;
+  EXPECT_TRUE(index.IsEmpty());
+  EXPECT_FALSE(index.HasOverlap(Box2d({0.0, 0.0}, 0.0, 4.0, 2.0)));
+  index.Init({{}, {}});
+  EXPECT_TRUE(index.IsEmpty());
+  EXPECT_FALSE(index.HasOverlap(Box2d({0.0, 0.0}, 0.0, 4.0, 2.0)));
+}
+
+TEST(ObstacleSegmentIndexTest, has_overlap) {
+  ObstacleSegmentIndex index;
+  index.Init({{LineSegment2d({-10.0, 3.0}, {10.0, 3.0})},
+              {LineSegment2d({5.0, -5.0}, {5.0, -1.0}),
+               LineSegment2d({5.0, -1.0}, {8.0, -1.0})}});
+  EXPECT_FALSE(index.IsEmpty());
+  EXPECT_FALSE(index.HasOverlap(Box2d({0.0, 0.0}, 0.0, 4.0, 2.0)));
+  EXPECT_TRUE(index.HasOverlap(Box2d({0.0, 2.5}, 0.0, 4.0, 2.0)));
+  EXPECT_TRUE(index.HasOverlap(Box2d({0.0, 0.0}, M_PI_2, 8.0, 2.0)));
+  EXPECT_TRUE(index.HasOverlap(Box2d({6.0, -2.0}, 0.3, 4.0, 2.0)));
+  index.Clear();
+  EXPECT_FALSE(index.HasOverlap(Box2d({0.0, 2.5}, 0.0, 4.0, 2.0)));
+}
+
+TEST(ObstacleSegmentIndexTest, same_as_brute_force) {
+  std::mt19937 rng(17);
+  std::uniform_real_distribution<double> position(-30.0, 30.0);
+  std::uniform_real_distribution<double> offset(-3.0, 3.0);
+  std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+  std::vector<std::vector<LineSegment2d>> obstacles;
+  for (int i = 0; i < 50; ++i) {
+    const Vec2d start(position(rng), position(rng));
+    obstacles.push_back(
+        {LineSegment2d(start, start + Vec2d(offset(rng), offset(rng))),
+         LineSegment2d(start, start)});
+  }
+  ObstacleSegmentIndex index;
+  index.Init(obstacles);
+  for (int i = 0; i < 2000; ++i) {
+    const Box2d box({position(rng), position(rng)}, heading(rng), 4.9, 2.1);
+    bool expected = false;
+    for (const auto& obstacle : obstacles) {
+      for (const auto& segment : obstacle) {
+        expected = expected || box.HasOverlap(segment);
+      }
+    }
+    EXPECT_EQ(expected, index.HasOverlap(box)) << box.DebugString();
+  }
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -20,6 +20,8 @@
 
 #include "modules/planning/planning_open_space/coarse_trajectory_generator/reeds_shepp_path.h"
 
+#include <algorithm>
+
 namespace apollo {
 namespace planning {
 
@@ -93,43 +95,7 @@ bool ReedShepp::ShortestRSP(
   size_t paths_size = all_possible_paths.size();
   double min_cost = std::numeric_limits<double>::max();
   for (size_t i = 0; i < paths_size; ++i) {
-    double cost = 0;
-    auto& path = all_possible_paths[i];
-    double steering_radius = path.radius / max_kappa_;
-    double steer_change_penalty_cost =
-        std::atan(vehicle_param_.wheel_base() / steering_radius * 2.0) *
-        traj_steer_change_penalty_;
-    for (size_t j = 0; j < path.segs_lengths.size(); j++) {
-      if (path.segs_types[j] != 'S') {
-        cost += std::fabs(path.segs_lengths[j]) * (traj_steer_penalty_) /
-                max_kappa_ * path.radius;
-        if (j > 0 && (path.segs_types[j - 1] != 'S') &&
-            (path.segs_types[j - 1] != path.segs_types[j])) {
-          cost += steer_change_penalty_cost;
-        }
-        if (std::fabs(path.segs_lengths[j]) / max_kappa_ * path.radius <
-            traj_expected_shortest_length_) {
-          cost += traj_short_length_penalty_;
-        }
-      } else {
-        if (path.segs_lengths[j] < 0) {
-          cost += -path.segs_lengths[j] * traj_back_penalty_ / max_kappa_;
-        } else {
-          cost += path.segs_lengths[j] * traj_forward_penalty_ / max_kappa_;
-        }
-        if (std::fabs(path.segs_lengths[j]) / max_kappa_ <
-            traj_expected_shortest_length_) {
-          cost += traj_short_length_penalty_;
-        }
-      }
-
-      if (j > 0 && path.segs_lengths[j] * path.segs_lengths[j - 1] < 0) {
-        cost += traj_gear_switch_penalty_;
-      }
-      if (j == 0 && start_dire * path.segs_lengths[j] < 0) {
-        cost += traj_gear_switch_penalty_;
-      }
-    }
+    const double cost = RSPCost(all_possible_paths[i], start_dire);
     if (cost < min_cost) {
       optimal_path_index = i;
       min_cost = cost;
@@ -150,25 +116,7 @@ bool ReedShepp::ShortestRSP(
   // ssm << "--rspath\n";
   // AERROR << ssm.str();
 
-  if (std::abs(all_possible_paths[optimal_path_index].x.back() -
-               end_node->GetX()) > 1e-3 ||
-      std::abs(all_possible_paths[optimal_path_index].y.back() -
-               end_node->GetY()) > 1e-3 ||
-      common::math::NormalizeAngle(
-          all_possible_paths[optimal_path_index].phi.back() -
-          end_node->GetPhi()) > 1e-3) {
-    ADEBUG << "RSP end position not right";
-    for (size_t i = 0;
-         i < all_possible_paths[optimal_path_index].segs_types.size(); ++i) {
-      ADEBUG << "types are "
-             << all_possible_paths[optimal_path_index].segs_types[i];
-    }
-    ADEBUG << "x, y, phi are: "
-           << all_possible_paths[optimal_path_index].x.back() << ", "
-           << all_possible_paths[optimal_path_index].y.back() << ", "
-           << all_possible_paths[optimal_path_index].phi.back();
-    ADEBUG << "end x, y, phi are: " << end_node->GetX() << ", "
-           << end_node->GetY() << ", " << end_node->GetPhi();
+  if (!CheckRSPEnd(all_possible_paths[optimal_path_index], end_node)) {
     return false;
   }
   (*optimal_path).cost = min_cost;
@@ -185,6 +133,114 @@ bool ReedShepp::ShortestRSP(
   return true;
 }
 
+bool ReedShepp::RSPCandidates(
+        const std::shared_ptr<Node3d> start_node,
+        const std::shared_ptr<Node3d> end_node,
+        const size_t max_candidate_num,
+        std::vector<ReedSheppPath>* candidates) {
+  CHECK_NOTNULL(candidates);
+  candidates->clear();
+  std::vector<ReedSheppPath> all_possible_paths;
+  if (!GenerateRSPs(start_node, end_node, &all_possible_paths)) {
+    ADEBUG << "Fail to generate different combination of Reed Shepp "
+              "paths";
+    return false;
+  }
+
+  const double start_dire = start_node->GetDirec() ? 1.0 : -1.0;
+  // (cost, index) pairs, equal costs keep the generation order as
+  // ShortestRSP does
+  std::vector<std::pair<double, size_t>> path_costs;
+  path_costs.reserve(all_possible_paths.size());
+  for (size_t i = 0; i < all_possible_paths.size(); ++i) {
+    if (all_possible_paths[i].segs_lengths.empty()) {
+      continue;
+    }
+    path_costs.emplace_back(RSPCost(all_possible_paths[i], start_dire), i);
+  }
+  const size_t candidate_num = std::min(max_candidate_num, path_costs.size());
+  std::partial_sort(path_costs.begin(), path_costs.begin() + candidate_num,
+                    path_costs.end());
+
+  std::vector<ReedSheppPath> selected_paths(candidate_num);
+  std::vector<char> valid(candidate_num, 0);
+#pragma omp parallel for schedule(dynamic, 1) num_threads(8) \
+    if (FLAGS_enable_parallel_hybrid_a && candidate_num > 1)
+  for (int i = 0; i < static_cast<int>(candidate_num); ++i) {
+    ReedSheppPath& path = selected_paths[i];
+    path = std::move(all_possible_paths[path_costs[i].second]);
+    path.cost = path_costs[i].first;
+    valid[i] = GenerateLocalConfigurations(start_node, end_node, &path) &&
+               CheckRSPEnd(path, end_node);
+  }
+  for (size_t i = 0; i < candidate_num; ++i) {
+    if (valid[i]) {
+      candidates->push_back(std::move(selected_paths[i]));
+    }
+  }
+  return !candidates->empty();
+}
+
+double ReedShepp::RSPCost(const ReedSheppPath& path,
+                          const double start_dire) const {
+  double cost = 0;
+  double steering_radius = path.radius / max_kappa_;
+  double steer_change_penalty_cost =
+      std::atan(vehicle_param_.wheel_base() / steering_radius * 2.0) *
+      traj_steer_change_penalty_;
+  for (size_t j = 0; j < path.segs_lengths.size(); j++) {
+    if (path.segs_types[j] != 'S') {
+      cost += std::fabs(path.segs_lengths[j]) * (traj_steer_penalty_) /
+              max_kappa_ * path.radius;
+      if (j > 0 && (path.segs_types[j - 1] != 'S') &&
+          (path.segs_types[j - 1] != path.segs_types[j])) {
+        cost += steer_change_penalty_cost;
+      }
+      if (std::fabs(path.segs_lengths[j]) / max_kappa_ * path.radius <
+          traj_expected_shortest_length_) {
+        cost += traj_short_length_penalty_;
+      }
+    } else {
+      if (path.segs_lengths[j] < 0) {
+        cost += -path.segs_lengths[j] * traj_back_penalty_ / max_kappa_;
+      } else {
+        cost += path.segs_lengths[j] * traj_forward_penalty_ / max_kappa_;
+      }
+      if (std::fabs(path.segs_lengths[j]) / max_kappa_ <
+          traj_expected_shortest_length_) {
+        cost += traj_short_length_penalty_;
+      }
+    }
+
+    if (j > 0 && path.segs_lengths[j] * path.segs_lengths[j - 1] < 0) {
+      cost += traj_gear_switch_penalty_;
+    }
+    if (j == 0 && start_dire * path.segs_lengths[j] < 0) {
+      cost += traj_gear_switch_penalty_;
+    }
+  }
+  return cost;
+}
+
+bool ReedShepp::CheckRSPEnd(const ReedSheppPath& path,
+                            const std::shared_ptr<Node3d> end_node) const {
+  if (std::abs(path.x.back() - end_node->GetX()) > 1e-3 ||
+      std::abs(path.y.back() - end_node->GetY()) > 1e-3 ||
+      common::math::NormalizeAngle(path.phi.back() - end_node->GetPhi()) >
+          1e-3) {
+    ADEBUG << "RSP end position not right";
+    for (size_t i = 0; i < path.segs_types.size(); ++i) {
+      ADEBUG << "types are " << path.segs_types[i];
+    }
+    ADEBUG << "x, y, phi are: " << path.x.back() << ", " << path.y.back()
+           << ", " << path.phi.back();
+    ADEBUG << "end x, y, phi are: " << end_node->GetX() << ", "
+           << end_node->GetY() << ", " << end_node->GetPhi();
+    return false;
+  }
+  return true;
+}
+
 bool ReedShepp::GenerateRSPs(
         const std::shared_ptr<Node3d> start_node,
         const std::shared_ptr<Node3d> end_node,
@@ -73,8 +73,23 @@ class ReedShepp {
           const std::shared_ptr<Node3d> start_node,
           const std::shared_ptr<Node3d> end_node,
           std::shared_ptr<ReedSheppPath> optimal_path);
+  // Generate all possible combinations of movement primitives and
+  // interpolate the cheapest ones, at most max_candidate_num valid paths are
+  // returned in ascending order of cost
+  bool RSPCandidates(
+          const std::shared_ptr<Node3d> start_node,
+          const std::shared_ptr<Node3d> end_node,
+          const size_t max_candidate_num,
+          std::vector<ReedSheppPath>* candidates);
 
  protected:
+  // cost of the general profile of a path, start_dire is 1.0 when the
+  // start node drives forward and -1.0 otherwise
+  double RSPCost(const ReedSheppPath& path, const double start_dire) const;
+  // check the interpolated path reaches the end node
+  bool CheckRSPEnd(
+          const ReedSheppPath& path,
+          const std::shared_ptr<Node3d> end_node) const;
   // Generate all possible combination of
   // movement primitives by Reed Shepp and
   // interpolate them
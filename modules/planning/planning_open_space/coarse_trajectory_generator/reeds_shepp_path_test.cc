@@ -165,5 +165,35 @@ TEST_F(reeds_shepp, test_set_5) {
   }
   check(start_node, end_node, optimal_path);
 }
+TEST_F(reeds_shepp, test_candidates) {
+  std::shared_ptr<Node3d> start_node =
+      std::shared_ptr<Node3d>(
+          new Node3d(0.0, 0.0, 10.0 * M_PI / 180.0,
+                     XYbounds_, planner_open_space_config_));
+  std::shared_ptr<Node3d> end_node =
+      std::shared_ptr<Node3d>(
+          new Node3d(7.0, -8.0, 50.0 * M_PI / 180.0,
+                     XYbounds_, planner_open_space_config_));
+  std::shared_ptr<ReedSheppPath> optimal_path =
+      std::shared_ptr<ReedSheppPath>(new ReedSheppPath());
+  ASSERT_TRUE(reedshepp_test->ShortestRSP(start_node, end_node, optimal_path));
+  std::vector<ReedSheppPath> candidates;
+  ASSERT_TRUE(
+      reedshepp_test->RSPCandidates(start_node, end_node, 5, &candidates));
+  ASSERT_FALSE(candidates.empty());
+  ASSERT_LE(candidates.size(), 5U);
+  // the cheapest candidate is the shortest path
+  EXPECT_DOUBLE_EQ(optimal_path->cost, candidates.front().cost);
+  EXPECT_EQ(optimal_path->x, candidates.front().x);
+  EXPECT_EQ(optimal_path->y, candidates.front().y);
+  EXPECT_EQ(optimal_path->phi, candidates.front().phi);
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    if (i > 0) {
+      EXPECT_LE(candidates[i - 1].cost, candidates[i].cost);
+    }
+    check(start_node, end_node,
+          std::make_shared<ReedSheppPath>(candidates[i]));
+  }
+}
 }  // namespace planning
 }  // namespace apollo
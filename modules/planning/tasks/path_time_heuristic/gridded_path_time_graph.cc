@@ -27,9 +27,9 @@
 #include "modules/common_msgs/basic_msgs/pnc_point.pb.h"
 
 #include "cyber/common/log.h"
-#include "cyber/task/task.h"
 #include "modules/common/math/vec2d.h"
 #include "modules/common/util/point_factory.h"
+#include "modules/planning/planning_base/common/util/planning_thread_pool.h"
 #include "modules/planning/planning_base/common/util/print_debug_info.h"
 #include "modules/planning/planning_base/gflags/planning_gflags.h"
 
@@ -44,6 +44,8 @@ using apollo::common::util::PointFactory;
 namespace {
 
 static constexpr double kDoubleEpsilon = 1.0e-6;
+// the rows of a column computed by a task of the multi thread dp
+static constexpr size_t kRowsPerTask = 8;
 
 // Continuous-time collision check using linear interpolation as closed-loop
 // dynamics
@@ -240,21 +242,17 @@ Status GriddedPathTimeGraph::CalculateTotalCost() {
     int count = static_cast<int>(next_highest_row) -
                 static_cast<int>(next_lowest_row) + 1;
     if (count > 0) {
-      std::vector<std::future<void>> results;
-      for (size_t r = next_lowest_row; r <= next_highest_row; ++r) {
-        auto msg = std::make_shared<StGraphMessage>(c, r);
-        if (gridded_path_time_graph_config_
-                .enable_multi_thread_in_dp_st_graph()) {
-          results.push_back(
-              cyber::Async(&GriddedPathTimeGraph::CalculateCostAt, this, msg));
-        } else {
-          CalculateCostAt(msg);
-        }
-      }
       if (gridded_path_time_graph_config_
               .enable_multi_thread_in_dp_st_graph()) {
-        for (auto& result : results) {
-          result.get();
+        // the cells of a column only read the previous columns
+        PlanningThreadPool::ParallelFor(
+            next_lowest_row, next_highest_row + 1, kRowsPerTask,
+            [this, c](size_t r) {
+              CalculateCostAt(std::make_shared<StGraphMessage>(c, r));
+            });
+      } else {
+        for (size_t r = next_lowest_row; r <= next_highest_row; ++r) {
+          CalculateCostAt(std::make_shared<StGraphMessage>(c, r));
         }
       }
     }
@@ -37,6 +37,7 @@
 #include "modules/common/vehicle_state/vehicle_state_provider.h"
 #include "modules/planning/planning_base/common/frame.h"
 #include "modules/planning/planning_base/common/planning_context.h"
+#include "modules/planning/planning_base/common/util/planning_thread_pool.h"
 #include "modules/planning/planning_base/gflags/planning_gflags.h"
 
 namespace apollo {
@@ -49,6 +50,11 @@ using apollo::common::math::Box2d;
 using apollo::common::math::Polygon2d;
 using apollo::common::math::Vec2d;
 
+namespace {
+// subsampled path size for the obstacles with predicted trajectories
+constexpr int kDefaultNumPoint = 50;
+}  // namespace
+
 STBoundaryMapper::STBoundaryMapper(
     const SpeedBoundsDeciderConfig& config, const ReferenceLine& reference_line,
     const PathData& path_data, const double planning_distance,
@@ -73,17 +79,24 @@ Status STBoundaryMapper::ComputeSTBoundary(PathDecision* path_decision) const {
                   "Fail to get params because of too few path points");
   }
 
+  PathOverlapContext context;
+  BuildPathOverlapContext(path_data_.discretized_path(), &context);
+
   // Go through every obstacle.
   Obstacle* stop_obstacle = nullptr;
   ObjectDecisionType stop_decision;
   double min_stop_s = std::numeric_limits<double>::max();
+  // obstacles to plot onto ST-graph, with the longitudinal decision to
+  // fine-tune the boundary if any.
+  std::vector<std::pair<Obstacle*, const ObjectDecisionType*>>
+      obstacles_to_map;
   for (const auto* ptr_obstacle_item : path_decision->obstacles().Items()) {
     Obstacle* ptr_obstacle = path_decision->Find(ptr_obstacle_item->Id());
     ACHECK(ptr_obstacle != nullptr);
 
     // If no longitudinal decision has been made, then plot it onto ST-graph.
     if (!ptr_obstacle->HasLongitudinalDecision()) {
-      ComputeSTBoundary(ptr_obstacle);
+      obstacles_to_map.emplace_back(ptr_obstacle, nullptr);
       continue;
     }
 
@@ -105,12 +118,36 @@ Status STBoundaryMapper::ComputeSTBoundary(PathDecision* path_decision) const {
                decision.has_yield()) {
       // 2. Depending on the longitudinal overtake/yield decision,
       //    fine-tune the upper/lower st-boundary of related obstacles.
-      ComputeSTBoundaryWithDecision(ptr_obstacle, decision);
+      obstacles_to_map.emplace_back(ptr_obstacle, &decision);
     } else if (!decision.has_ignore()) {
       // 3. Ignore those unrelated obstacles.
       AWARN << "No mapping for decision: " << decision.DebugString();
     }
   }
+
+  // Every obstacle only updates its own boundary, so they can be mapped in
+  // parallel.
+  auto map_obstacle = [this, &context](
+                          Obstacle* obstacle,
+                          const ObjectDecisionType* decision) {
+    if (decision == nullptr) {
+      ComputeSTBoundary(obstacle, context);
+    } else {
+      ComputeSTBoundaryWithDecision(obstacle, *decision, context);
+    }
+  };
+  if (FLAGS_enable_multi_thread_in_st_boundary_mapping &&
+      obstacles_to_map.size() > 1) {
+    PlanningThreadPool::ParallelFor(
+        0, obstacles_to_map.size(), 1, [&](size_t i) {
+          map_obstacle(obstacles_to_map[i].first, obstacles_to_map[i].second);
+        });
+  } else {
+    for (const auto& obstacle_to_map : obstacles_to_map) {
+      map_obstacle(obstacle_to_map.first, obstacle_to_map.second);
+    }
+  }
+
   if (stop_obstacle) {
     bool success = MapStopDecision(stop_obstacle, stop_decision);
     if (!success) {
@@ -162,15 +199,72 @@ bool STBoundaryMapper::MapStopDecision(
   return true;
 }
 
-void STBoundaryMapper::ComputeSTBoundary(Obstacle* obstacle) const {
+void STBoundaryMapper::BuildPathOverlapContext(
+    const std::vector<PathPoint>& path_points,
+    PathOverlapContext* context) const {
+  const auto* planning_status = injector_->planning_context()
+                                    ->mutable_planning_status()
+                                    ->mutable_change_lane();
+
+  context->l_buffer =
+      planning_status->status() == ChangeLaneStatus::IN_CHANGE_LANE
+          ? speed_bounds_config_.lane_change_obstacle_nudge_l_buffer()
+          : FLAGS_nonstatic_obstacle_nudge_l_buffer;
+
+  // For those with no predicted trajectories, every path point within the
+  // planning distance is checked.
+  context->num_path_points_in_range = 0;
+  while (context->num_path_points_in_range < path_points.size() &&
+         path_points[context->num_path_points_in_range].s() <=
+             planning_max_distance_) {
+    ++context->num_path_points_in_range;
+  }
+  context->path_index.reset(
+      new PathOverlapIndex(path_points, vehicle_param_, context->l_buffer));
+
+  // For those with predicted trajectories (moving obstacles):
+  // Subsample to reduce computation time.
+  if (path_points.size() > 2 * kDefaultNumPoint) {
+    const auto ratio = path_points.size() / kDefaultNumPoint;
+    std::vector<PathPoint> sampled_path_points;
+    for (size_t i = 0; i < path_points.size(); ++i) {
+      if (i % ratio == 0) {
+        sampled_path_points.push_back(path_points[i]);
+      }
+    }
+    context->discretized_path = DiscretizedPath(std::move(sampled_path_points));
+  } else {
+    context->discretized_path = DiscretizedPath(path_points);
+  }
+
+  // Points of the ADC's path to search for the first overlap.
+  context->sample_s.clear();
+  context->sample_points.clear();
+  const auto& discretized_path = context->discretized_path;
+  if (!discretized_path.empty()) {
+    const double step_length = vehicle_param_.front_edge_to_center();
+    auto path_len = std::min(speed_bounds_config_.max_trajectory_len(),
+                             discretized_path.Length());
+    for (double path_s = 0.0; path_s < path_len; path_s += step_length) {
+      context->sample_s.push_back(path_s);
+      context->sample_points.push_back(
+          discretized_path.Evaluate(path_s + discretized_path.front().s()));
+    }
+  }
+  context->sample_index.reset(new PathOverlapIndex(
+      context->sample_points, vehicle_param_, context->l_buffer));
+}
+
+void STBoundaryMapper::ComputeSTBoundary(
+    Obstacle* obstacle, const PathOverlapContext& context) const {
   if (FLAGS_use_st_drivable_boundary) {
     return;
   }
   std::vector<STPoint> lower_points;
   std::vector<STPoint> upper_points;
 
-  if (!GetOverlapBoundaryPoints(path_data_.discretized_path(), *obstacle,
-                                &upper_points, &lower_points)) {
+  if (!GetOverlapBoundaryPoints(path_data_.discretized_path(), context,
+                                *obstacle, &upper_points, &lower_points)) {
     return;
   }
 
@@ -190,7 +284,8 @@ void STBoundaryMapper::ComputeSTBoundary(Obstacle* obstacle) const {
 }
 
 bool STBoundaryMapper::GetOverlapBoundaryPoints(
-    const std::vector<PathPoint>& path_points, const Obstacle& obstacle,
+    const std::vector<PathPoint>& path_points,
+    const PathOverlapContext& context, const Obstacle& obstacle,
     std::vector<STPoint>* upper_points,
     std::vector<STPoint>* lower_points) const {
   // Sanity checks.
@@ -201,14 +296,7 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
     return false;
   }
 
-  const auto* planning_status = injector_->planning_context()
-                                    ->mutable_planning_status()
-                                    ->mutable_change_lane();
-
-  double l_buffer =
-      planning_status->status() == ChangeLaneStatus::IN_CHANGE_LANE
-          ? speed_bounds_config_.lane_change_obstacle_nudge_l_buffer()
-          : FLAGS_nonstatic_obstacle_nudge_l_buffer;
+  const double l_buffer = context.l_buffer;
 
   // Draw the given obstacle on the ST-graph.
   const auto& trajectory = obstacle.Trajectory();
@@ -227,11 +315,13 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
 
     const Box2d& obs_box = obstacle.PerceptionBoundingBox();
 
-    for (const auto& curr_point_on_path : path_points) {
-      if (curr_point_on_path.s() > planning_max_distance_) {
+    // Only the path points around the obstacle may overlap with it.
+    for (const size_t index :
+         context.path_index->GetCandidateIndices(obs_box)) {
+      if (index >= context.num_path_points_in_range) {
         break;
       }
-      if (CheckOverlap(curr_point_on_path, obs_box, l_buffer)) {
+      if (CheckOverlap(path_points[index], obs_box, l_buffer)) {
         box_check_collision = true;
         break;
       }
@@ -243,11 +333,13 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
       const double backward_distance = 0;
       const double forward_distance = obs_box.length();
 
-      for (const auto& curr_point_on_path : path_points) {
-        if (curr_point_on_path.s() > planning_max_distance_) {
+      const Polygon2d& obs_polygon = obstacle.PerceptionPolygon();
+      for (const size_t index :
+           context.path_index->GetCandidateIndices(obs_polygon)) {
+        if (index >= context.num_path_points_in_range) {
           break;
         }
-        const Polygon2d& obs_polygon = obstacle.PerceptionPolygon();
+        const auto& curr_point_on_path = path_points[index];
         if (CheckOverlap(curr_point_on_path, obs_polygon, l_buffer)) {
           // If there is overlapping, then plot it on ST-graph.
           double low_s =
@@ -275,21 +367,8 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
     }
   } else {
     // For those with predicted trajectories (moving obstacles):
-    // 1. Subsample to reduce computation time.
-    const int default_num_point = 50;
-    DiscretizedPath discretized_path;
-    if (path_points.size() > 2 * default_num_point) {
-      const auto ratio = path_points.size() / default_num_point;
-      std::vector<PathPoint> sampled_path_points;
-      for (size_t i = 0; i < path_points.size(); ++i) {
-        if (i % ratio == 0) {
-          sampled_path_points.push_back(path_points[i]);
-        }
-      }
-      discretized_path = DiscretizedPath(std::move(sampled_path_points));
-    } else {
-      discretized_path = DiscretizedPath(path_points);
-    }
+    // 1. The path is subsampled in the context to reduce computation time.
+    const int default_num_point = kDefaultNumPoint;
 
     // 2. Go through every point of the predicted obstacle trajectory.
     double trajectory_time_interval =
@@ -315,7 +394,7 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
         continue;
       }
       bool collision = CheckOverlapWithTrajectoryPoint(
-          discretized_path, obstacle_shape, upper_points, lower_points,
+          context, obstacle_shape, upper_points, lower_points,
           l_buffer, default_num_point, obstacle_length, obstacle_width,
           trajectory_point_time);
       if ((trajectory_point_collision_status ^ collision) && i != 0) {
@@ -327,7 +406,7 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
           trajectory_point_time = point.relative_time();
           obstacle_shape = obstacle.GetObstacleTrajectoryPolygon(point);
           collision = CheckOverlapWithTrajectoryPoint(
-              discretized_path, obstacle_shape, upper_points, lower_points,
+              context, obstacle_shape, upper_points, lower_points,
               l_buffer, default_num_point, obstacle_length, obstacle_width,
               trajectory_point_time);
           index--;
@@ -349,17 +428,16 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
 }
 
 bool STBoundaryMapper::CheckOverlapWithTrajectoryPoint(
-    const DiscretizedPath& discretized_path, const Polygon2d& obstacle_shape,
+    const PathOverlapContext& context, const Polygon2d& obstacle_shape,
     std::vector<STPoint>* upper_points, std::vector<STPoint>* lower_points,
     const double l_buffer, int default_num_point, const double obstacle_length,
     const double obstacle_width, const double trajectory_point_time) const {
-  const double step_length = vehicle_param_.front_edge_to_center();
-  auto path_len = std::min(speed_bounds_config_.max_trajectory_len(),
-                           discretized_path.Length());
-  // Go through every point of the ADC's path.
-  for (double path_s = 0.0; path_s < path_len; path_s += step_length) {
-    const auto curr_adc_path_point =
-        discretized_path.Evaluate(path_s + discretized_path.front().s());
+  const DiscretizedPath& discretized_path = context.discretized_path;
+  // Go through the points of the ADC's path around the obstacle.
+  for (const size_t index :
+       context.sample_index->GetCandidateIndices(obstacle_shape)) {
+    const double path_s = context.sample_s[index];
+    const auto& curr_adc_path_point = context.sample_points[index];
     if (CheckOverlap(curr_adc_path_point, obstacle_shape, l_buffer)) {
       // Found overlap, start searching with higher resolution
       // const double backward_distance = -step_length;
@@ -417,7 +495,8 @@ bool STBoundaryMapper::CheckOverlapWithTrajectoryPoint(
 }
 
 void STBoundaryMapper::ComputeSTBoundaryWithDecision(
-    Obstacle* obstacle, const ObjectDecisionType& decision) const {
+    Obstacle* obstacle, const ObjectDecisionType& decision,
+    const PathOverlapContext& context) const {
   DCHECK(decision.has_follow() || decision.has_yield() ||
          decision.has_overtake())
       << "decision is " << decision.DebugString()
@@ -432,8 +511,8 @@ void STBoundaryMapper::ComputeSTBoundaryWithDecision(
     lower_points = path_st_boundary.lower_points();
     upper_points = path_st_boundary.upper_points();
   } else {
-    if (!GetOverlapBoundaryPoints(path_data_.discretized_path(), *obstacle,
-                                  &upper_points, &lower_points)) {
+    if (!GetOverlapBoundaryPoints(path_data_.discretized_path(), context,
+                                  *obstacle, &upper_points, &lower_points)) {
       return;
     }
   }
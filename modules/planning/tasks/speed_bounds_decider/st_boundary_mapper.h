@@ -29,7 +29,9 @@
 #include "modules/common/status/status.h"
 #include "modules/planning/planning_base/common/dependency_injector.h"
 #include "modules/planning/planning_base/common/obstacle.h"
+#include "modules/planning/planning_base/common/path/discretized_path.h"
 #include "modules/planning/planning_base/common/path/path_data.h"
+#include "modules/planning/planning_base/common/path/path_overlap_index.h"
 #include "modules/planning/planning_base/common/path_decision.h"
 #include "modules/planning/planning_base/common/speed/st_boundary.h"
 #include "modules/planning/planning_base/common/speed_limit.h"
@@ -54,11 +56,33 @@ class STBoundaryMapper {
   FRIEND_TEST(StBoundaryMapperTest, check_overlap_test);
   FRIEND_TEST(StBoundaryMapperTest, get_overlap_boundary_points_test);
 
+  /** @brief The path related data shared by all the obstacles of one
+   * mapping. The ADC boxes along the path are indexed once, so that every
+   * obstacle only runs the exact overlap tests at the path points around it.
+   */
+  struct PathOverlapContext {
+    double l_buffer = 0.0;
+    // path points within the planning distance.
+    size_t num_path_points_in_range = 0;
+    std::unique_ptr<PathOverlapIndex> path_index;
+    // subsampled path for the obstacles with predicted trajectories, and the
+    // points sampled along it to search for the first overlap.
+    DiscretizedPath discretized_path;
+    std::vector<double> sample_s;
+    std::vector<common::PathPoint> sample_points;
+    std::unique_ptr<PathOverlapIndex> sample_index;
+  };
+
+  void BuildPathOverlapContext(
+      const std::vector<common::PathPoint>& path_points,
+      PathOverlapContext* context) const;
+
   /** @brief Calls GetOverlapBoundaryPoints to get upper and lower points
    * for a given obstacle, and then formulate STBoundary based on that.
    * It also labels boundary type based on previously documented decisions.
    */
-  void ComputeSTBoundary(Obstacle* obstacle) const;
+  void ComputeSTBoundary(Obstacle* obstacle,
+                         const PathOverlapContext& context) const;
 
   /** @brief Map the given obstacle onto the ST-Graph. The boundary is
    * represented as upper and lower points for every s of interests.
@@ -66,7 +90,8 @@ class STBoundaryMapper {
    */
   bool GetOverlapBoundaryPoints(
       const std::vector<common::PathPoint>& path_points,
-      const Obstacle& obstacle, std::vector<STPoint>* upper_points,
+      const PathOverlapContext& context, const Obstacle& obstacle,
+      std::vector<STPoint>* upper_points,
       std::vector<STPoint>* lower_points) const;
 
   /** @brief Given a path-point and an obstacle bounding box, check if the
@@ -101,10 +126,11 @@ class STBoundaryMapper {
    * when necessary.
    */
   void ComputeSTBoundaryWithDecision(Obstacle* obstacle,
-                                     const ObjectDecisionType& decision) const;
+                                     const ObjectDecisionType& decision,
+                                     const PathOverlapContext& context) const;
 
   bool CheckOverlapWithTrajectoryPoint(
-      const DiscretizedPath& discretized_path,
+      const PathOverlapContext& context,
       const common::math::Polygon2d& obstacle_shape,
       std::vector<STPoint>* upper_points, std::vector<STPoint>* lower_points,
       const double l_buffer, int default_num_point,
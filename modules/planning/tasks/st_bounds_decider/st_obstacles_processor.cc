@@ -21,6 +21,7 @@
 #include "modules/planning/tasks/st_bounds_decider/st_obstacles_processor.h"
 
 #include <algorithm>
+#include <iterator>
 #include <unordered_set>
 
 #include "modules/common_msgs/basic_msgs/pnc_point.pb.h"
@@ -93,6 +94,8 @@ Status STObstaclesProcessor::MapObstaclesToSTBoundaries(
     return Status(ErrorCode::PLANNING_ERROR, msg);
   }
   obs_id_to_st_boundary_.clear();
+  adc_path_index_.reset(new PathOverlapIndex(
+      path_data_.discretized_path(), vehicle_param_, kADCSafetyLBuffer));
 
   // Some preprocessing to save the adc_low_road_right segments.
   bool is_adc_low_road_right_beginning = true;
@@ -577,6 +580,38 @@ bool STObstaclesProcessor::GetOverlappingS(
   }
 
   // Detailed searching.
+  if (adc_path_index_ != nullptr && adc_l_buffer == kADCSafetyLBuffer &&
+      adc_path_index_->size() == adc_path_points.size()) {
+    // Only the path points around the obstacle may overlap with it.
+    const std::vector<size_t> candidates =
+        adc_path_index_->GetCandidateIndices(obstacle_instance);
+    auto first_it = std::lower_bound(candidates.begin(), candidates.end(),
+                                     static_cast<size_t>(pt_before_idx));
+    auto last_it = std::upper_bound(first_it, candidates.end(),
+                                    static_cast<size_t>(pt_after_idx));
+    auto first_overlap_it =
+        std::find_if(first_it, last_it, [&](const size_t index) {
+          return IsADCOverlappingWithObstacle(adc_path_points[index],
+                                              obstacle_instance, adc_l_buffer);
+        });
+    if (first_overlap_it == last_it) {
+      return false;
+    }
+    const int first_overlap_idx = static_cast<int>(*first_overlap_it);
+    overlapping_s->first =
+        adc_path_points[std::max(first_overlap_idx - 1, 0)].s();
+    for (auto it = last_it; it != first_overlap_it; --it) {
+      const size_t index = *std::prev(it);
+      if (IsADCOverlappingWithObstacle(adc_path_points[index],
+                                       obstacle_instance, adc_l_buffer)) {
+        overlapping_s->second = adc_path_points[index + 1].s();
+        return true;
+      }
+    }
+    overlapping_s->second = adc_path_points[first_overlap_idx + 1].s();
+    return true;
+  }
+
   bool has_overlapping = false;
   for (int i = pt_before_idx; i <= pt_after_idx; ++i) {
     ADEBUG << "At ADC path index = " << i << " :";
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -32,6 +33,7 @@
 #include "modules/planning/planning_base/common/history.h"
 #include "modules/planning/planning_base/common/obstacle.h"
 #include "modules/planning/planning_base/common/path/path_data.h"
+#include "modules/planning/planning_base/common/path/path_overlap_index.h"
 #include "modules/planning/planning_base/common/path_decision.h"
 #include "modules/planning/planning_base/common/speed/st_boundary.h"
 #include "modules/planning/planning_base/common/speed_limit.h"
@@ -197,6 +199,8 @@ class STObstaclesProcessor {
   double planning_distance_;
   PathData path_data_;
   common::VehicleParam vehicle_param_;
+  // ADC boxes along the path, to look up the path points around an obstacle.
+  std::unique_ptr<PathOverlapIndex> adc_path_index_;
   double adc_path_init_s_;
   PathDecision* path_decision_;
 
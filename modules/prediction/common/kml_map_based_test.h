@@ -18,6 +18,8 @@
 
 #include "gtest/gtest.h"
 
+#include "modules/common_msgs/perception_msgs/perception_obstacle.pb.h"
+
 #include "modules/common/configs/config_gflags.h"
 
 namespace apollo {
@@ -29,6 +31,23 @@ class KMLMapBasedTest : public ::testing::Test {
     FLAGS_map_dir = "modules/prediction/testdata";
     FLAGS_base_map_filename = "kml_map.bin";
   }
+
+ protected:
+  // Add copies of the first obstacle at other speeds, so that the obstacles
+  // of a batch have different features.
+  static void AddObstacleCopies(
+      const int num_copies,
+      apollo::perception::PerceptionObstacles* perception_obstacles) {
+    const auto obstacle = perception_obstacles->perception_obstacle(0);
+    for (int i = 1; i <= num_copies; ++i) {
+      auto* copy = perception_obstacles->add_perception_obstacle();
+      *copy = obstacle;
+      copy->set_id(obstacle.id() + i);
+      const double scale = 1.0 + 0.2 * i;
+      copy->mutable_velocity()->set_x(obstacle.velocity().x() * scale);
+      copy->mutable_velocity()->set_y(obstacle.velocity().y() * scale);
+    }
+  }
 };
 
 }  // namespace prediction
@@ -35,6 +35,28 @@ using apollo::hdmap::MapPathPoint;
 using apollo::hdmap::OverlapInfo;
 using apollo::hdmap::PNCJunctionInfo;
 
+namespace {
+
+// Check if the target lane is one of the lanes with the ids, by their dense
+// indices if the lanes are all found in the map, otherwise by their ids.
+bool ContainsLane(const google::protobuf::RepeatedPtrField<hdmap::Id>& lane_ids,
+                  const std::vector<int>& lane_indices,
+                  const LaneInfo& target_lane) {
+  if (target_lane.index() >= 0 &&
+      lane_indices.size() == static_cast<size_t>(lane_ids.size())) {
+    return std::find(lane_indices.begin(), lane_indices.end(),
+                     target_lane.index()) != lane_indices.end();
+  }
+  for (const auto& lane_id : lane_ids) {
+    if (target_lane.id().id() == lane_id.id()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
 bool PredictionMap::Ready() { return HDMapUtil::BaseMapPtr() != nullptr; }
 
 Eigen::Vector2d PredictionMap::PositionOnLane(
@@ -71,6 +93,10 @@ std::shared_ptr<const LaneInfo> PredictionMap::LaneById(
   return HDMapUtil::BaseMap().GetLaneById(hdmap::MakeMapId(str_id));
 }
 
+std::shared_ptr<const LaneInfo> PredictionMap::LaneByIndex(const int index) {
+  return HDMapUtil::BaseMap().GetLaneByIndex(index);
+}
+
 std::shared_ptr<const JunctionInfo> PredictionMap::JunctionById(
     const std::string& str_id) {
   return HDMapUtil::BaseMap().GetJunctionById(hdmap::MakeMapId(str_id));
@@ -511,13 +537,9 @@ bool PredictionMap::IsLeftNeighborLane(
   if (target_lane == nullptr) {
     return false;
   }
-  for (const auto& left_lane_id :
-       curr_lane->lane().left_neighbor_forward_lane_id()) {
-    if (target_lane->id().id() == left_lane_id.id()) {
-      return true;
-    }
-  }
-  return false;
+  return ContainsLane(curr_lane->lane().left_neighbor_forward_lane_id(),
+                      curr_lane->left_neighbor_forward_indices(),
+                      *target_lane);
 }
 
 bool PredictionMap::IsLeftNeighborLane(
@@ -543,13 +565,9 @@ bool PredictionMap::IsRightNeighborLane(
   if (target_lane == nullptr) {
     return false;
   }
-  for (auto& right_lane_id :
-       curr_lane->lane().right_neighbor_forward_lane_id()) {
-    if (target_lane->id().id() == right_lane_id.id()) {
-      return true;
-    }
-  }
-  return false;
+  return ContainsLane(curr_lane->lane().right_neighbor_forward_lane_id(),
+                      curr_lane->right_neighbor_forward_indices(),
+                      *target_lane);
 }
 
 bool PredictionMap::IsRightNeighborLane(
@@ -574,12 +592,8 @@ bool PredictionMap::IsSuccessorLane(std::shared_ptr<const LaneInfo> target_lane,
   if (target_lane == nullptr) {
     return false;
   }
-  for (const auto& successor_lane_id : curr_lane->lane().successor_id()) {
-    if (target_lane->id().id() == successor_lane_id.id()) {
-      return true;
-    }
-  }
-  return false;
+  return ContainsLane(curr_lane->lane().successor_id(),
+                      curr_lane->successor_indices(), *target_lane);
 }
 
 bool PredictionMap::IsSuccessorLane(
@@ -605,12 +619,8 @@ bool PredictionMap::IsPredecessorLane(
   if (target_lane == nullptr) {
     return false;
   }
-  for (const auto& predecessor_lane_id : curr_lane->lane().predecessor_id()) {
-    if (target_lane->id().id() == predecessor_lane_id.id()) {
-      return true;
-    }
-  }
-  return false;
+  return ContainsLane(curr_lane->lane().predecessor_id(),
+                      curr_lane->predecessor_indices(), *target_lane);
 }
 
 bool PredictionMap::IsPredecessorLane(
@@ -632,6 +642,9 @@ bool PredictionMap::IsIdenticalLane(std::shared_ptr<const LaneInfo> other_lane,
   if (curr_lane == nullptr || other_lane == nullptr) {
     return true;
   }
+  if (other_lane->index() >= 0 && curr_lane->index() >= 0) {
+    return other_lane->index() == curr_lane->index();
+  }
   return other_lane->id().id() == curr_lane->id().id();
 }
 
@@ -657,6 +670,14 @@ int PredictionMap::LaneTurnType(const std::string& lane_id) {
   return 1;
 }
 
+int PredictionMap::LaneTurnType(
+    std::shared_ptr<const hdmap::LaneInfo> lane_info) {
+  if (lane_info != nullptr) {
+    return static_cast<int>(lane_info->lane().turn());
+  }
+  return 1;
+}
+
 std::vector<std::shared_ptr<const LaneInfo>> PredictionMap::GetNearbyLanes(
     const common::PointENU& position, const double nearby_radius) {
   ACHECK(position.has_x() && position.has_y() && position.has_z());
@@ -75,6 +75,13 @@ class PredictionMap {
    */
   static std::shared_ptr<const hdmap::LaneInfo> LaneById(const std::string& id);
 
+  /**
+   * @brief Get a shared pointer to a lane by its dense index in the map.
+   * @param index The index of the target lane, see hdmap::LaneInfo::index().
+   * @return A shared pointer to the lane, nullptr if index is out of range.
+   */
+  static std::shared_ptr<const hdmap::LaneInfo> LaneByIndex(const int index);
+
   /**
    * @brief Get a shared pointer to a junction by junction ID.
    * @param id The ID of the target junction ID in the form of string.
@@ -394,6 +401,13 @@ class PredictionMap {
    */
   static int LaneTurnType(const std::string& lane_id);
 
+  /**
+   * @brief Get lane turn type.
+   * @param lane_info The lane.
+   * @return Integer corresponding to the lane turn type.
+   */
+  static int LaneTurnType(std::shared_ptr<const hdmap::LaneInfo> lane_info);
+
   /**
    * @brief Get all nearby lanes within certain radius given a position
    * @param position Position in ENU frame
@@ -36,6 +36,15 @@ TEST_F(PredictionMapTest, get_lane_info) {
   EXPECT_EQ(nullptr, lane_info);
 }
 
+TEST_F(PredictionMapTest, get_lane_info_by_index) {
+  std::shared_ptr<const LaneInfo> lane_info = PredictionMap::LaneById("l20");
+  ASSERT_NE(nullptr, lane_info);
+  EXPECT_GE(lane_info->index(), 0);
+  EXPECT_EQ(lane_info, PredictionMap::LaneByIndex(lane_info->index()));
+
+  EXPECT_EQ(nullptr, PredictionMap::LaneByIndex(-1));
+}
+
 TEST_F(PredictionMapTest, get_position_on_lane) {
   std::shared_ptr<const LaneInfo> lane_info = PredictionMap::LaneById("l20");
 
@@ -271,6 +280,8 @@ TEST_F(PredictionMapTest, lane_turn_type) {
   EXPECT_EQ(1, PredictionMap::LaneTurnType("l500"));
 
   EXPECT_EQ(3, PredictionMap::LaneTurnType("l5"));
+  EXPECT_EQ(3, PredictionMap::LaneTurnType(PredictionMap::LaneById("l5")));
+  EXPECT_EQ(1, PredictionMap::LaneTurnType(PredictionMap::LaneById("l500")));
 }
 
 }  // namespace prediction
@@ -38,6 +38,7 @@ DECLARE_bool(prediction_eval_mode);
 DECLARE_bool(enable_multi_thread);
 DECLARE_int32(max_thread_num);
 DECLARE_int32(max_caution_thread_num);
+DECLARE_bool(enable_batch_evaluation);
 DECLARE_bool(enable_async_draw_base_image);
 DECLARE_bool(use_cuda);
 
@@ -22,41 +22,26 @@ namespace prediction {
 thread_local int PredictionThreadPool::s_thread_pool_level = 0;
 std::vector<int> BaseThreadPool::THREAD_POOL_CAPACITY = {20, 20, 20};
 
+// the queue of each worker holds as many tasks as the pool has workers
 BaseThreadPool::BaseThreadPool(int thread_num, int next_thread_pool_level)
-    : stopped_(false) {
-  if (!task_queue_.Init(thread_num,
-                        new apollo::cyber::base::BlockWaitStrategy())) {
-    throw std::runtime_error("Task queue init failed.");
-  }
-  for (int i = 0; i < thread_num; ++i) {
-    workers_.emplace_back([this, next_thread_pool_level, i] {
-      PredictionThreadPool::s_thread_pool_level = next_thread_pool_level;
-      while (!stopped_) {
-        std::function<void()> task;
-        if (task_queue_.WaitDequeue(&task)) {
-          task();
-        }
-      }
-    });
-  }
-}
+    : next_thread_pool_level_(next_thread_pool_level),
+      executor_(thread_num, thread_num,
+                [next_thread_pool_level](std::size_t) {
+                  PredictionThreadPool::s_thread_pool_level =
+                      next_thread_pool_level;
+                }) {}
 
-void BaseThreadPool::Stop() {
-  task_queue_.BreakAllWait();
-  for (std::thread& worker : workers_) {
-    worker.join();
-  }
-  stopped_ = true;
+void BaseThreadPool::Stop() { executor_.Stop(); }
+
+BaseThreadPool::~BaseThreadPool() { executor_.Stop(); }
+
+BaseThreadPool::ThreadPoolLevelGuard::ThreadPoolLevelGuard(int level)
+    : old_level_(PredictionThreadPool::s_thread_pool_level) {
+  PredictionThreadPool::s_thread_pool_level = level;
 }
 
-BaseThreadPool::~BaseThreadPool() {
-  if (stopped_.exchange(true)) {
-    return;
-  }
-  task_queue_.BreakAllWait();
-  for (std::thread& worker : workers_) {
-    worker.join();
-  }
+BaseThreadPool::ThreadPoolLevelGuard::~ThreadPoolLevelGuard() {
+  PredictionThreadPool::s_thread_pool_level = old_level_;
 }
 
 BaseThreadPool* PredictionThreadPool::Instance() {
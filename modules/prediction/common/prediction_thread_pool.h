@@ -21,11 +21,10 @@
 #pragma once
 
 #include <future>
-#include <memory>
 #include <utility>
 #include <vector>
 
-#include "cyber/base/bounded_queue.h"
+#include "cyber/base/work_stealing_executor.h"
 #include "cyber/common/log.h"
 
 namespace apollo {
@@ -39,47 +38,43 @@ class BaseThreadPool {
 
   ~BaseThreadPool();
 
+  // the caller runs some of the elements too, at the next level as the
+  // workers, and the tasks of the pool while it waits for the others
   template <typename InputIter, typename F>
   void ForEach(InputIter begin, InputIter end, F f) {
-    std::vector<std::future<void>> futures;
+    std::vector<InputIter> iters;
     for (auto iter = begin; iter != end; ++iter) {
-      auto& elem = *iter;
-      futures.emplace_back(this->Post([&] { f(elem); }));
-    }
-    for (auto& future : futures) {
-      if (future.valid()) {
-        future.get();
-      } else {
-        AERROR << "Future is invalid.";
-      }
+      iters.push_back(iter);
     }
+    ThreadPoolLevelGuard level_guard(next_thread_pool_level_);
+    executor_.ParallelFor(0, iters.size(), 1,
+                          [&](std::size_t i) { f(*iters[i]); });
   }
 
   template <typename FuncType>
   std::future<typename std::result_of<FuncType()>::type> Post(FuncType&& func) {
-    typedef typename std::result_of<FuncType()>::type ReturnType;
-    typedef typename std::packaged_task<ReturnType()> TaskType;
-    // Post requires that the functions in it are copy-constructible.
-    // We used a shared pointer for the packaged_task,
-    // Since it's only movable and non-copyable
-    std::shared_ptr<TaskType> task =
-        std::make_shared<TaskType>(std::move(func));
-    std::future<ReturnType> returned_future = task->get_future();
-
-    // Note: variables eg. `task` must be copied here because of the lifetime
-    if (stopped_) {
-      return std::future<ReturnType>();
-    }
-    task_queue_.Enqueue([task]() { (*task)(); });
-    return returned_future;
+    return executor_.Enqueue(std::forward<FuncType>(func));
   }
 
   static std::vector<int> THREAD_POOL_CAPACITY;
 
  private:
-  std::vector<std::thread> workers_;
-  apollo::cyber::base::BoundedQueue<std::function<void()>> task_queue_;
-  std::atomic_bool stopped_;
+  // set the thread pool level of the thread, and restore the old one when
+  // it goes out of scope, also if the loop throws
+  class ThreadPoolLevelGuard {
+   public:
+    explicit ThreadPoolLevelGuard(int level);
+    ~ThreadPoolLevelGuard();
+
+    ThreadPoolLevelGuard(const ThreadPoolLevelGuard&) = delete;
+    ThreadPoolLevelGuard& operator=(const ThreadPoolLevelGuard&) = delete;
+
+   private:
+    int old_level_;
+  };
+
+  int next_thread_pool_level_;
+  apollo::cyber::base::WorkStealingExecutor executor_;
 };
 
 template <int LEVEL>
@@ -16,6 +16,11 @@
 
 #include "modules/prediction/common/prediction_thread_pool.h"
 
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 namespace apollo {
@@ -33,7 +38,6 @@ TEST(PredictionThreadPoolTest, global_for_each) {
   EXPECT_EQ(expect, real);
 }
 
-/* TODO(kechxu) uncomment this when deadlock issue is fixed
 TEST(PredictionThreadPoolTest, avoid_deadlock) {
   std::vector<int> expect = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
   std::vector<int> real = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
@@ -57,8 +61,28 @@ TEST(PredictionThreadPoolTest, avoid_deadlock) {
   });
 
   EXPECT_EQ(expect, real);
+  EXPECT_EQ(0, PredictionThreadPool::s_thread_pool_level);
+}
+
+TEST(PredictionThreadPoolTest, more_elements_than_threads) {
+  std::vector<int> real(1000, 0);
+  PredictionThreadPool::ForEach(real.begin(), real.end(),
+                                [](int& input) { ++input; });
+  EXPECT_EQ(std::vector<int>(1000, 1), real);
+}
+
+TEST(PredictionThreadPoolTest, restore_level_on_exception) {
+  std::vector<int> inputs(100, 0);
+  EXPECT_THROW(PredictionThreadPool::ForEach(inputs.begin(), inputs.end(),
+                                             [](int& input) {
+                                               if (++input > 0) {
+                                                 throw std::runtime_error(
+                                                     "failed");
+                                               }
+                                             }),
+               std::runtime_error);
+  EXPECT_EQ(0, PredictionThreadPool::s_thread_pool_level);
 }
-*/
 
 }  // namespace prediction
 }  // namespace apollo
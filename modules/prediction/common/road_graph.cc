@@ -81,6 +81,34 @@ bool IsAtLeft(std::shared_ptr<const LaneInfo> lane1,
   return HeadingIsAtLeft(lane1->headings(), lane2->headings(), 0);
 }
 
+// Get the lanes of the ids without duplicates, ordered by their ids. The
+// lanes are looked up by their dense indices if all are found in the map.
+std::vector<std::shared_ptr<const LaneInfo>> GetUniqueLanes(
+    const google::protobuf::RepeatedPtrField<hdmap::Id>& lane_ids,
+    const std::vector<int>& lane_indices) {
+  std::vector<std::shared_ptr<const LaneInfo>> lanes;
+  if (lane_indices.size() == static_cast<size_t>(lane_ids.size())) {
+    for (const int lane_index : lane_indices) {
+      lanes.push_back(PredictionMap::LaneByIndex(lane_index));
+    }
+    std::sort(lanes.begin(), lanes.end(),
+              [](const std::shared_ptr<const LaneInfo>& lhs,
+                 const std::shared_ptr<const LaneInfo>& rhs) {
+                return lhs->id().id() < rhs->id().id();
+              });
+    lanes.erase(std::unique(lanes.begin(), lanes.end()), lanes.end());
+    return lanes;
+  }
+  std::set<std::string> set_lane_ids;
+  for (const auto& lane_id : lane_ids) {
+    set_lane_ids.insert(lane_id.id());
+  }
+  for (const auto& unique_id : set_lane_ids) {
+    lanes.push_back(PredictionMap::LaneById(unique_id));
+  }
+  return lanes;
+}
+
 }  // namespace
 
 RoadGraph::RoadGraph(const double start_s, const double length,
@@ -230,8 +258,7 @@ void RoadGraph::ConstructLaneSequence(
   LaneSegment lane_segment;
   lane_segment.set_adc_s(curr_s);
   lane_segment.set_lane_id(lane_info_ptr->id().id());
-  lane_segment.set_lane_turn_type(
-      PredictionMap::LaneTurnType(lane_info_ptr->id().id()));
+  lane_segment.set_lane_turn_type(PredictionMap::LaneTurnType(lane_info_ptr));
   lane_segment.set_total_length(lane_info_ptr->total_length());
   if (search_forward_direction) {
     lane_segment.set_start_s(curr_s);
@@ -276,16 +303,11 @@ void RoadGraph::ConstructLaneSequence(
   double new_accumulated_s = 0.0;
   double new_lane_seg_s = 0.0;
   std::vector<std::shared_ptr<const hdmap::LaneInfo>> candidate_lanes;
-  std::set<std::string> set_lane_ids;
   if (search_forward_direction) {
     new_accumulated_s = accumulated_s + lane_info_ptr->total_length() - curr_s;
     // Reundancy removal.
-    for (const auto& successor_lane_id : lane_info_ptr->lane().successor_id()) {
-      set_lane_ids.insert(successor_lane_id.id());
-    }
-    for (const auto& unique_id : set_lane_ids) {
-      candidate_lanes.push_back(PredictionMap::LaneById(unique_id));
-    }
+    candidate_lanes = GetUniqueLanes(lane_info_ptr->lane().successor_id(),
+                                     lane_info_ptr->successor_indices());
     // Sort the successor lane_segments from left to right.
     std::sort(candidate_lanes.begin(), candidate_lanes.end(), IsAtLeft);
     // Based on other conditions, select what successor lanes should be used.
@@ -297,13 +319,8 @@ void RoadGraph::ConstructLaneSequence(
     new_accumulated_s = accumulated_s + curr_s;
     new_lane_seg_s = -0.1;
     // Redundancy removal.
-    for (const auto& predecessor_lane_id :
-         lane_info_ptr->lane().predecessor_id()) {
-      set_lane_ids.insert(predecessor_lane_id.id());
-    }
-    for (const auto& unique_id : set_lane_ids) {
-      candidate_lanes.push_back(PredictionMap::LaneById(unique_id));
-    }
+    candidate_lanes = GetUniqueLanes(lane_info_ptr->lane().predecessor_id(),
+                                     lane_info_ptr->predecessor_indices());
   }
   bool consider_further_lane_split =
       !search_forward_direction ||
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Lane sequence building of prediction on the kml test map. The successor
+// lanes are looked up by string ids as before, or by the dense lane indices
+// of the map, and the lane graphs are built from every lane of the map.
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "modules/common/configs/config_gflags.h"
+#include "modules/prediction/common/prediction_map.h"
+#include "modules/prediction/common/road_graph.h"
+
+namespace apollo {
+namespace prediction {
+namespace {
+
+using apollo::hdmap::LaneInfo;
+
+const std::vector<std::shared_ptr<const LaneInfo>>& AllLanes() {
+  static const auto* lanes = [] {
+    FLAGS_map_dir = "modules/prediction/testdata";
+    FLAGS_base_map_filename = "kml_map.bin";
+    auto* lanes = new std::vector<std::shared_ptr<const LaneInfo>>();
+    for (int i = 0; PredictionMap::LaneByIndex(i) != nullptr; ++i) {
+      lanes->push_back(PredictionMap::LaneByIndex(i));
+    }
+    return lanes;
+  }();
+  return *lanes;
+}
+
+void BM_SuccessorLanesById(benchmark::State& state) {  // NOLINT
+  const auto& lanes = AllLanes();
+  for (auto _ : state) {
+    for (const auto& lane : lanes) {
+      std::set<std::string> set_lane_ids;
+      for (const auto& successor_lane_id : lane->lane().successor_id()) {
+        set_lane_ids.insert(successor_lane_id.id());
+      }
+      for (const auto& unique_id : set_lane_ids) {
+        benchmark::DoNotOptimize(PredictionMap::LaneById(unique_id));
+      }
+    }
+  }
+}
+
+void BM_SuccessorLanesByIndex(benchmark::State& state) {  // NOLINT
+  const auto& lanes = AllLanes();
+  for (auto _ : state) {
+    for (const auto& lane : lanes) {
+      for (const int successor_index : lane->successor_indices()) {
+        benchmark::DoNotOptimize(PredictionMap::LaneByIndex(successor_index));
+      }
+    }
+  }
+}
+
+void BM_BuildLaneGraph(benchmark::State& state) {  // NOLINT
+  const auto& lanes = AllLanes();
+  for (auto _ : state) {
+    for (const auto& lane : lanes) {
+      RoadGraph road_graph(0.0, 100.0, true, lane);
+      LaneGraph lane_graph;
+      road_graph.BuildLaneGraph(&lane_graph);
+      benchmark::DoNotOptimize(lane_graph.lane_sequence_size());
+    }
+  }
+}
+
+BENCHMARK(BM_SuccessorLanesById)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SuccessorLanesByIndex)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BuildLaneGraph)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace prediction
+}  // namespace apollo
+
+BENCHMARK_MAIN();
@@ -16,6 +16,8 @@
 
 #include "modules/prediction/common/semantic_map.h"
 
+#include <algorithm>
+#include <cmath>
 #include <utility>
 #include <vector>
 
@@ -36,6 +38,28 @@ namespace prediction {
 
 namespace {
 
+// meters per pixel
+constexpr double kResolution = 0.1;
+// size of the base image in pixels
+constexpr int kImageSize = 2000;
+// size of the cached map tiles in pixels
+constexpr int kTileSize = 500;
+constexpr double kTileRange = kTileSize * kResolution;
+// half size of the window around an obstacle which the rotated crop reads
+constexpr int kCropWindowHalfSize = 368;
+constexpr int kCropWindowSize = 2 * kCropWindowHalfSize;
+
+int FloorDiv(const int a, const int b) {
+  return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+// Base point of the image centered at (x, y), snapped to the pixel grid so
+// that the cached tiles line up with the image.
+double BaseCoordinate(const double x) {
+  return std::floor((x - FLAGS_base_image_half_range) / kResolution) *
+         kResolution;
+}
+
 bool ValidFeatureHistory(const ObstacleHistory& obstacle_history,
                          const double curr_base_x, const double curr_base_y) {
   if (obstacle_history.feature_size() == 0) {
@@ -57,10 +81,12 @@ bool ValidFeatureHistory(const ObstacleHistory& obstacle_history,
 SemanticMap::SemanticMap() {}
 
 void SemanticMap::Init() {
-  curr_img_ = cv::Mat(2000, 2000, CV_8UC3, cv::Scalar(0, 0, 0));
+  curr_img_ = cv::Mat(kImageSize, kImageSize, CV_8UC3, cv::Scalar(0, 0, 0));
   obstacle_id_history_map_.clear();
+  tiles_.clear();
 #ifdef __aarch64__
-  affine_transformer_.Init(cv::Size(2000, 2000), CV_8UC3);
+  affine_transformer_.Init(cv::Size(kCropWindowSize, kCropWindowSize),
+                           CV_8UC3);
 #endif
 }
 
@@ -73,16 +99,16 @@ void SemanticMap::RunCurrFrame(
 
   ego_feature_ = obstacle_id_history_map.at(FLAGS_ego_vehicle_id).feature(0);
   if (!FLAGS_enable_async_draw_base_image) {
-    double x = ego_feature_.position().x();
-    double y = ego_feature_.position().y();
-    curr_base_x_ = x - FLAGS_base_image_half_range;
-    curr_base_y_ = y - FLAGS_base_image_half_range;
-    DrawBaseMap(x, y, curr_base_x_, curr_base_y_);
-    base_img_.copyTo(curr_img_);
+    curr_base_x_ = BaseCoordinate(ego_feature_.position().x());
+    curr_base_y_ = BaseCoordinate(ego_feature_.position().y());
+    DrawBaseMap(curr_base_x_, curr_base_y_, &curr_img_);
   } else {
-    base_img_.copyTo(curr_img_);
-    curr_base_x_ = base_x_;
-    curr_base_y_ = base_y_;
+    {
+      std::lock_guard<std::mutex> lock(base_img_mutex_);
+      base_img_.copyTo(curr_img_);
+      curr_base_x_ = base_x_;
+      curr_base_y_ = base_y_;
+    }
     task_future_ = cyber::Async(&SemanticMap::DrawBaseMapThread, this);
     // This is only for the first frame without base image yet
     if (!started_drawing_) {
@@ -116,30 +142,87 @@ void SemanticMap::RunCurrFrame(
   }
 }
 
-void SemanticMap::DrawBaseMap(const double x, const double y,
-                              const double base_x, const double base_y) {
-  base_img_ = cv::Mat(2000, 2000, CV_8UC3, cv::Scalar(0, 0, 0));
-  common::PointENU center_point = common::util::PointFactory::ToPointENU(x, y);
-  DrawRoads(center_point, base_x, base_y);
-  DrawJunctions(center_point, base_x, base_y);
-  DrawCrosswalks(center_point, base_x, base_y);
-  DrawLanes(center_point, base_x, base_y);
+void SemanticMap::DrawBaseMap(const double base_x, const double base_y,
+                              cv::Mat* img) {
+  img->create(kImageSize, kImageSize, CV_8UC3);
+  // World pixel indices of the bottom left corner of the image, the image
+  // row r shows the world pixel row base_row + kImageSize - r.
+  const int base_col = static_cast<int>(std::lround(base_x / kResolution));
+  const int base_row = static_cast<int>(std::lround(base_y / kResolution));
+  const int min_tile_x = FloorDiv(base_col, kTileSize);
+  const int max_tile_x = FloorDiv(base_col + kImageSize - 1, kTileSize);
+  const int min_tile_y = FloorDiv(base_row, kTileSize);
+  const int max_tile_y = FloorDiv(base_row + kImageSize - 1, kTileSize);
+  for (int tile_x = min_tile_x; tile_x <= max_tile_x; ++tile_x) {
+    for (int tile_y = min_tile_y; tile_y <= max_tile_y; ++tile_y) {
+      const cv::Mat& tile = GetTile(tile_x, tile_y);
+      const int col_begin = std::max(0, tile_x * kTileSize - base_col);
+      const int col_end =
+          std::min(kImageSize, (tile_x + 1) * kTileSize - base_col);
+      const int row_begin =
+          std::max(0, base_row + kImageSize - (tile_y + 1) * kTileSize);
+      const int row_end =
+          std::min(kImageSize, base_row + kImageSize - tile_y * kTileSize);
+      const cv::Rect img_rect(col_begin, row_begin, col_end - col_begin,
+                              row_end - row_begin);
+      const cv::Rect tile_rect(
+          col_begin + base_col - tile_x * kTileSize,
+          row_begin - base_row - kImageSize + (tile_y + 1) * kTileSize,
+          img_rect.width, img_rect.height);
+      tile(tile_rect).copyTo((*img)(img_rect));
+    }
+  }
+
+  // Keep one ring of tiles around the image for the next frames.
+  for (auto it = tiles_.begin(); it != tiles_.end();) {
+    if (it->first.first < min_tile_x - 1 || it->first.first > max_tile_x + 1 ||
+        it->first.second < min_tile_y - 1 ||
+        it->first.second > max_tile_y + 1) {
+      it = tiles_.erase(it);
+    } else {
+      ++it;
+    }
+  }
 }
 
 void SemanticMap::DrawBaseMapThread() {
   std::lock_guard<std::mutex> lock(draw_base_map_thread_mutex_);
-  double x = ego_feature_.position().x();
-  double y = ego_feature_.position().y();
-  base_x_ = x - FLAGS_base_image_half_range;
-  base_y_ = y - FLAGS_base_image_half_range;
-  DrawBaseMap(x, y, base_x_, base_y_);
+  double base_x = BaseCoordinate(ego_feature_.position().x());
+  double base_y = BaseCoordinate(ego_feature_.position().y());
+  DrawBaseMap(base_x, base_y, &drawing_img_);
+  std::lock_guard<std::mutex> base_img_lock(base_img_mutex_);
+  std::swap(base_img_, drawing_img_);
+  base_x_ = base_x;
+  base_y_ = base_y;
+}
+
+const cv::Mat& SemanticMap::GetTile(const int tile_x, const int tile_y) {
+  const auto key = std::make_pair(tile_x, tile_y);
+  auto it = tiles_.find(key);
+  if (it != tiles_.end()) {
+    return it->second;
+  }
+  cv::Mat tile(kTileSize, kTileSize, CV_8UC3, cv::Scalar(0, 0, 0));
+  // The tile is drawn as the top left corner of a base image.
+  const double base_x = tile_x * kTileRange;
+  const double base_y = (tile_y + 1) * kTileRange - kImageSize * kResolution;
+  common::PointENU center_point = common::util::PointFactory::ToPointENU(
+      (tile_x + 0.5) * kTileRange, (tile_y + 0.5) * kTileRange);
+  // half diagonal of the tile plus the width of the lane lines
+  const double radius = kTileRange * std::sqrt(2.0) / 2.0 + 1.0;
+  DrawRoads(center_point, radius, base_x, base_y, &tile);
+  DrawJunctions(center_point, radius, base_x, base_y, &tile);
+  DrawCrosswalks(center_point, radius, base_x, base_y, &tile);
+  DrawLanes(center_point, radius, base_x, base_y, &tile);
+  return tiles_.emplace(key, std::move(tile)).first->second;
 }
 
 void SemanticMap::DrawRoads(const common::PointENU& center_point,
-                            const double base_x, const double base_y,
+                            const double radius, const double base_x,
+                            const double base_y, cv::Mat* img,
                             const cv::Scalar& color) {
   std::vector<apollo::hdmap::RoadInfoConstPtr> roads;
-  apollo::hdmap::HDMapUtil::BaseMap().GetRoads(center_point, 141.4, &roads);
+  apollo::hdmap::HDMapUtil::BaseMap().GetRoads(center_point, radius, &roads);
   for (const auto& road : roads) {
     for (const auto& section : road->road().section()) {
       std::vector<cv::Point> polygon;
@@ -161,7 +244,7 @@ void SemanticMap::DrawRoads(const common::PointENU& center_point,
           }
         }
       }
-      cv::fillPoly(base_img_,
+      cv::fillPoly(*img,
                    std::vector<std::vector<cv::Point>>({std::move(polygon)}),
                    color);
     }
@@ -169,10 +252,11 @@ void SemanticMap::DrawRoads(const common::PointENU& center_point,
 }
 
 void SemanticMap::DrawJunctions(const common::PointENU& center_point,
-                                const double base_x, const double base_y,
+                                const double radius, const double base_x,
+                                const double base_y, cv::Mat* img,
                                 const cv::Scalar& color) {
   std::vector<apollo::hdmap::JunctionInfoConstPtr> junctions;
-  apollo::hdmap::HDMapUtil::BaseMap().GetJunctions(center_point, 141.4,
+  apollo::hdmap::HDMapUtil::BaseMap().GetJunctions(center_point, radius,
                                                    &junctions);
   for (const auto& junction : junctions) {
     std::vector<cv::Point> polygon;
@@ -180,17 +264,18 @@ void SemanticMap::DrawJunctions(const common::PointENU& center_point,
       polygon.push_back(
           std::move(GetTransPoint(point.x(), point.y(), base_x, base_y)));
     }
-    cv::fillPoly(base_img_,
+    cv::fillPoly(*img,
                  std::vector<std::vector<cv::Point>>({std::move(polygon)}),
                  color);
   }
 }
 
 void SemanticMap::DrawCrosswalks(const common::PointENU& center_point,
-                                 const double base_x, const double base_y,
+                                 const double radius, const double base_x,
+                                 const double base_y, cv::Mat* img,
                                  const cv::Scalar& color) {
   std::vector<apollo::hdmap::CrosswalkInfoConstPtr> crosswalks;
-  apollo::hdmap::HDMapUtil::BaseMap().GetCrosswalks(center_point, 141.4,
+  apollo::hdmap::HDMapUtil::BaseMap().GetCrosswalks(center_point, radius,
                                                     &crosswalks);
   for (const auto& crosswalk : crosswalks) {
     std::vector<cv::Point> polygon;
@@ -198,17 +283,18 @@ void SemanticMap::DrawCrosswalks(const common::PointENU& center_point,
       polygon.push_back(
           std::move(GetTransPoint(point.x(), point.y(), base_x, base_y)));
     }
-    cv::fillPoly(base_img_,
+    cv::fillPoly(*img,
                  std::vector<std::vector<cv::Point>>({std::move(polygon)}),
                  color);
   }
 }
 
 void SemanticMap::DrawLanes(const common::PointENU& center_point,
-                            const double base_x, const double base_y,
+                            const double radius, const double base_x,
+                            const double base_y, cv::Mat* img,
                             const cv::Scalar& color) {
   std::vector<apollo::hdmap::LaneInfoConstPtr> lanes;
-  apollo::hdmap::HDMapUtil::BaseMap().GetLanes(center_point, 141.4, &lanes);
+  apollo::hdmap::HDMapUtil::BaseMap().GetLanes(center_point, radius, &lanes);
   for (const auto& lane : lanes) {
     // Draw lane_central first
     for (const auto& segment : lane->lane().central_curve().segment()) {
@@ -232,7 +318,7 @@ void SemanticMap::DrawLanes(const common::PointENU& center_point,
         //     cv::Scalar(rgb.at<float>(0, 0) * 255, rgb.at<float>(0, 1) * 255,
         //                rgb.at<float>(0, 2) * 255);
 
-        cv::line(base_img_, p0, p1, HSVtoRGB(H), 4);
+        cv::line(*img, p0, p1, HSVtoRGB(H), 4);
       }
     }
     // Not drawing boundary for virtual city_driving lane
@@ -249,7 +335,7 @@ void SemanticMap::DrawLanes(const common::PointENU& center_point,
         const auto& p1 = GetTransPoint(segment.line_segment().point(i + 1).x(),
                                        segment.line_segment().point(i + 1).y(),
                                        base_x, base_y);
-        cv::line(base_img_, p0, p1, color, 2);
+        cv::line(*img, p0, p1, color, 2);
       }
     }
     // Draw lane's right_boundary
@@ -262,7 +348,7 @@ void SemanticMap::DrawLanes(const common::PointENU& center_point,
         const auto& p1 = GetTransPoint(segment.line_segment().point(i + 1).x(),
                                        segment.line_segment().point(i + 1).y(),
                                        base_x, base_y);
-        cv::line(base_img_, p0, p1, color, 2);
+        cv::line(*img, p0, p1, color, 2);
       }
     }
   }
@@ -292,7 +378,7 @@ cv::Scalar SemanticMap::HSVtoRGB(double H, double S, double V) {
 
 void SemanticMap::DrawRect(const Feature& feature, const cv::Scalar& color,
                            const double base_x, const double base_y,
-                           cv::Mat* img) {
+                           cv::Mat* img, const cv::Point& offset) {
   double obs_l = feature.length();
   double obs_w = feature.width();
   double obs_x = feature.position().x();
@@ -317,36 +403,37 @@ void SemanticMap::DrawRect(const Feature& feature, const cv::Scalar& color,
       obs_x + (cos(theta) * obs_l - sin(theta) * -obs_w) / 2,
       obs_y + (sin(theta) * obs_l + cos(theta) * -obs_w) / 2, base_x, base_y)));
   cv::fillPoly(*img, std::vector<std::vector<cv::Point>>({std::move(polygon)}),
-               color);
+               color, cv::LINE_8, 0, offset);
 }
 
 void SemanticMap::DrawPoly(const Feature& feature, const cv::Scalar& color,
                            const double base_x, const double base_y,
-                           cv::Mat* img) {
+                           cv::Mat* img, const cv::Point& offset) {
   std::vector<cv::Point> polygon;
   for (auto& polygon_point : feature.polygon_point()) {
     polygon.push_back(std::move(
         GetTransPoint(polygon_point.x(), polygon_point.y(), base_x, base_y)));
   }
   cv::fillPoly(*img, std::vector<std::vector<cv::Point>>({std::move(polygon)}),
-               color);
+               color, cv::LINE_8, 0, offset);
 }
 
 void SemanticMap::DrawHistory(const ObstacleHistory& history,
                               const cv::Scalar& color, const double base_x,
-                              const double base_y, cv::Mat* img) {
+                              const double base_y, cv::Mat* img,
+                              const cv::Point& offset) {
   for (int i = history.feature_size() - 1; i >= 0; --i) {
     const Feature& feature = history.feature(i);
     double time_decay = 1.0 - ego_feature_.timestamp() + feature.timestamp();
     cv::Scalar decay_color = color * time_decay;
     if (feature.id() == FLAGS_ego_vehicle_id) {
-      DrawRect(feature, decay_color, base_x, base_y, img);
+      DrawRect(feature, decay_color, base_x, base_y, img, offset);
     } else {
       if (feature.polygon_point_size() == 0) {
         AERROR << "No polygon points in feature, please check!";
         continue;
       }
-      DrawPoly(feature, decay_color, base_x, base_y, img);
+      DrawPoly(feature, decay_color, base_x, base_y, img, offset);
     }
   }
 }
@@ -385,12 +472,29 @@ cv::Mat SemanticMap::CropArea(const cv::Mat& input_img,
 cv::Mat SemanticMap::CropByHistory(const ObstacleHistory& history,
                                    const cv::Scalar& color, const double base_x,
                                    const double base_y) {
-  cv::Mat feature_map = curr_img_.clone();
-  DrawHistory(history, color, base_x, base_y, &feature_map);
   const Feature& curr_feature = history.feature(0);
   const cv::Point2i& center_point = GetTransPoint(
       curr_feature.position().x(), curr_feature.position().y(), base_x, base_y);
-  return CropArea(feature_map, center_point, curr_feature.theta());
+  // Only the window around the obstacle which the rotated crop reads is
+  // copied and drawn on, rather than the whole base image.
+  const cv::Point2i window_origin(center_point.x - kCropWindowHalfSize,
+                                  center_point.y - kCropWindowHalfSize);
+  const cv::Rect window =
+      cv::Rect(window_origin, cv::Size(kCropWindowSize, kCropWindowSize)) &
+      cv::Rect(0, 0, curr_img_.cols, curr_img_.rows);
+  cv::Mat feature_map;
+  if (window.width == kCropWindowSize && window.height == kCropWindowSize) {
+    feature_map = curr_img_(window).clone();
+  } else {
+    feature_map = cv::Mat(kCropWindowSize, kCropWindowSize, CV_8UC3,
+                          cv::Scalar(0, 0, 0));
+    if (!window.empty()) {
+      curr_img_(window).copyTo(feature_map(window - window_origin));
+    }
+  }
+  DrawHistory(history, color, base_x, base_y, &feature_map, -window_origin);
+  return CropArea(feature_map, center_point - window_origin,
+                  curr_feature.theta());
 }
 
 bool SemanticMap::GetMapById(const int obstacle_id, cv::Mat* feature_map) {
@@ -16,9 +16,14 @@
 
 #pragma once
 
+#include <cmath>
 #include <future>
+#include <map>
+#include <mutex>
 #include <unordered_map>
+#include <utility>
 
+#include "gtest/gtest_prod.h"
 #include "opencv2/opencv.hpp"
 
 #include "cyber/common/macros.h"
@@ -44,44 +49,56 @@ class SemanticMap {
 
   bool GetMapById(const int obstacle_id, cv::Mat* feature_map);
 
+  FRIEND_TEST(SemanticMapTest, TiledBaseMapMatchesUntiled);
+
  private:
+  // Round down rather than toward zero, the tiles are drawn with their own
+  // base points and the points left of or below them are not cut off.
   cv::Point2i GetTransPoint(const double x, const double y, const double base_x,
                             const double base_y) {
-    return cv::Point2i(static_cast<int>((x - base_x) / 0.1),
-                       static_cast<int>(2000 - (y - base_y) / 0.1));
+    return cv::Point2i(static_cast<int>(std::floor((x - base_x) / 0.1)),
+                       static_cast<int>(std::floor(2000 - (y - base_y) / 0.1)));
   }
 
-  void DrawBaseMap(const double x, const double y, const double base_x,
-                   const double base_y);
+  // Compose the base image with its bottom left corner at (base_x, base_y)
+  // from the cached tiles of the static map layers.
+  void DrawBaseMap(const double base_x, const double base_y, cv::Mat* img);
 
   void DrawBaseMapThread();
 
-  void DrawRoads(const common::PointENU& center_point, const double base_x,
-                 const double base_y,
+  // Get the tile of the static map layers, rasterize it on the first use.
+  const cv::Mat& GetTile(const int tile_x, const int tile_y);
+
+  void DrawRoads(const common::PointENU& center_point, const double radius,
+                 const double base_x, const double base_y, cv::Mat* img,
                  const cv::Scalar& color = cv::Scalar(64, 64, 64));
 
-  void DrawJunctions(const common::PointENU& center_point, const double base_x,
-                     const double base_y,
+  void DrawJunctions(const common::PointENU& center_point, const double radius,
+                     const double base_x, const double base_y, cv::Mat* img,
                      const cv::Scalar& color = cv::Scalar(128, 128, 128));
 
-  void DrawCrosswalks(const common::PointENU& center_point, const double base_x,
-                      const double base_y,
+  void DrawCrosswalks(const common::PointENU& center_point,
+                      const double radius, const double base_x,
+                      const double base_y, cv::Mat* img,
                       const cv::Scalar& color = cv::Scalar(192, 192, 192));
 
-  void DrawLanes(const common::PointENU& center_point, const double base_x,
-                 const double base_y,
+  void DrawLanes(const common::PointENU& center_point, const double radius,
+                 const double base_x, const double base_y, cv::Mat* img,
                  const cv::Scalar& color = cv::Scalar(255, 255, 255));
 
   cv::Scalar HSVtoRGB(double H = 1.0, double S = 1.0, double V = 1.0);
 
   void DrawRect(const Feature& feature, const cv::Scalar& color,
-                const double base_x, const double base_y, cv::Mat* img);
+                const double base_x, const double base_y, cv::Mat* img,
+                const cv::Point& offset = cv::Point());
 
   void DrawPoly(const Feature& feature, const cv::Scalar& color,
-                const double base_x, const double base_y, cv::Mat* img);
+                const double base_x, const double base_y, cv::Mat* img,
+                const cv::Point& offset = cv::Point());
 
   void DrawHistory(const ObstacleHistory& history, const cv::Scalar& color,
-                   const double base_x, const double base_y, cv::Mat* img);
+                   const double base_x, const double base_y, cv::Mat* img,
+                   const cv::Point& offset = cv::Point());
 
   // Draw adc trajectory in semantic map
   void DrawADCTrajectory(const cv::Scalar& color, const double base_x,
@@ -99,7 +116,16 @@ class SemanticMap {
   double base_x_ = 0.0;
   double base_y_ = 0.0;
 
+  // base image being composed by async thread, swapped with base_img_
+  cv::Mat drawing_img_;
+
   std::mutex draw_base_map_thread_mutex_;
+  std::mutex base_img_mutex_;
+
+  // world anchored tiles of roads, junctions, crosswalks and lanes, an image
+  // covers at most 5 x 5 tiles and one ring around it is kept, so the cache
+  // holds at most 7 x 7 tiles of 500 x 500 BGR pixels, about 36 MB
+  std::map<std::pair<int, int>, cv::Mat> tiles_;
 
   // base_image, base_x, and base_y to be used in the current cycle
   cv::Mat curr_img_;
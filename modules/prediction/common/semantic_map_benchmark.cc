@@ -0,0 +1,66 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Base image drawing of the semantic map on the kml test map, for the ego
+// vehicle driving straight at 10 m/s with a frame every 0.1 s. The static
+// map layers come from the cached tiles, only the tiles the vehicle moves
+// into are rasterized.
+
+#include <unordered_map>
+
+#include "benchmark/benchmark.h"
+
+#include "modules/common/configs/config_gflags.h"
+#include "modules/prediction/common/prediction_gflags.h"
+#include "modules/prediction/common/prediction_system_gflags.h"
+#include "modules/prediction/common/semantic_map.h"
+
+namespace apollo {
+namespace prediction {
+namespace {
+
+void BM_RunCurrFrame(benchmark::State& state) {  // NOLINT
+  FLAGS_map_dir = "modules/prediction/testdata";
+  FLAGS_base_map_filename = "kml_map.bin";
+  FLAGS_enable_async_draw_base_image = false;
+  FLAGS_enable_draw_adc_trajectory = false;
+
+  SemanticMap semantic_map;
+  semantic_map.Init();
+  std::unordered_map<int, ObstacleHistory> obstacle_id_history_map;
+  Feature* ego_feature =
+      obstacle_id_history_map[FLAGS_ego_vehicle_id].add_feature();
+  ego_feature->set_id(FLAGS_ego_vehicle_id);
+  ego_feature->set_length(4.9);
+  ego_feature->set_width(2.1);
+  ego_feature->set_theta(0.0);
+  double x = -458.941;
+  const double y = -159.240;
+  for (auto _ : state) {
+    ego_feature->mutable_position()->set_x(x);
+    ego_feature->mutable_position()->set_y(y);
+    semantic_map.RunCurrFrame(obstacle_id_history_map);
+    x += 1.0;
+  }
+}
+
+BENCHMARK(BM_RunCurrFrame)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace prediction
+}  // namespace apollo
+
+BENCHMARK_MAIN();
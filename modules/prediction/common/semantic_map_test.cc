@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/prediction/common/semantic_map.h"
+
+#include <cmath>
+
+#include "modules/common/util/point_factory.h"
+#include "modules/prediction/common/kml_map_based_test.h"
+#include "modules/prediction/common/prediction_gflags.h"
+
+namespace apollo {
+namespace prediction {
+
+class SemanticMapTest : public KMLMapBasedTest {};
+
+TEST_F(SemanticMapTest, TiledBaseMapMatchesUntiled) {
+  SemanticMap semantic_map;
+  semantic_map.Init();
+  // Draw the static map layers directly into one image, with a radius
+  // covering the corners of the image.
+  auto draw_untiled = [&semantic_map](const double base_x,
+                                      const double base_y) {
+    cv::Mat img(2000, 2000, CV_8UC3, cv::Scalar(0, 0, 0));
+    const common::PointENU center_point =
+        common::util::PointFactory::ToPointENU(
+            base_x + FLAGS_base_image_half_range,
+            base_y + FLAGS_base_image_half_range);
+    const double radius = 150.0;
+    semantic_map.DrawRoads(center_point, radius, base_x, base_y, &img);
+    semantic_map.DrawJunctions(center_point, radius, base_x, base_y, &img);
+    semantic_map.DrawCrosswalks(center_point, radius, base_x, base_y, &img);
+    semantic_map.DrawLanes(center_point, radius, base_x, base_y, &img);
+    return img;
+  };
+
+  // Around a vehicle of the test data, the image is not aligned to the tiles
+  // and reaches into tiles of negative indices.
+  const double base_x =
+      std::floor((-458.941 - FLAGS_base_image_half_range) / 0.1) * 0.1;
+  const double base_y =
+      std::floor((-159.240 - FLAGS_base_image_half_range) / 0.1) * 0.1;
+  const cv::Mat untiled_img = draw_untiled(base_x, base_y);
+  EXPECT_GT(cv::countNonZero(untiled_img.reshape(1)), 0);
+  cv::Mat tiled_img;
+  semantic_map.DrawBaseMap(base_x, base_y, &tiled_img);
+  EXPECT_EQ(cv::norm(tiled_img, untiled_img, cv::NORM_INF), 0.0);
+
+  // Composed again from the cached tiles after moving across a tile boundary.
+  const double next_base_x = base_x + 55.3;
+  const double next_base_y = base_y - 12.7;
+  const cv::Mat next_untiled_img = draw_untiled(next_base_x, next_base_y);
+  cv::Mat next_tiled_img;
+  semantic_map.DrawBaseMap(next_base_x, next_base_y, &next_tiled_img);
+  EXPECT_EQ(cv::norm(next_tiled_img, next_untiled_img, cv::NORM_INF), 0.0);
+  EXPECT_LE(semantic_map.tiles_.size(), 49u);
+}
+
+}  // namespace prediction
+}  // namespace apollo
@@ -83,6 +83,25 @@ class Evaluator {
                         ObstaclesContainer* obstacles_container) {
     return Evaluate(obstacle, obstacles_container);
   }
+  /**
+   * @brief Whether the evaluator can evaluate a batch of obstacles with a
+   *        single model forward
+   */
+  virtual bool SupportBatchEvaluation() const { return false; }
+
+  /**
+   * @brief Evaluate a batch of obstacles, the default evaluates them one by
+   *        one
+   * @param Obstacle pointers
+   * @param Obstacles container
+   */
+  virtual void EvaluateBatch(const std::vector<Obstacle*>& obstacles,
+                             ObstaclesContainer* obstacles_container) {
+    for (Obstacle* obstacle : obstacles) {
+      Evaluate(obstacle, obstacles_container);
+    }
+  }
+
   /**
    * @brief Get the name of evaluator
    */
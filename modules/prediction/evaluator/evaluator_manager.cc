@@ -237,6 +237,7 @@ void EvaluatorManager::Run(
           << time_cost_multi.count() * 1000 << " ms.";
   }
 
+  auto start_time = std::chrono::system_clock::now();
   if (FLAGS_enable_multi_thread) {
     IdObstacleListMap id_obstacle_map;
     GroupObstaclesByObstacleIds(obstacles_container, &id_obstacle_map);
@@ -245,7 +246,7 @@ void EvaluatorManager::Run(
         [&](IdObstacleListMap::iterator::value_type& obstacles_iter) {
           for (auto obstacle_ptr : obstacles_iter.second) {
             EvaluateObstacle(adc_trajectory_container, obstacle_ptr,
-                            obstacles_container, dynamic_env);
+                            obstacles_container, dynamic_env, true);
           }
         });
   } else {
@@ -261,9 +262,14 @@ void EvaluatorManager::Run(
       }
 
       EvaluateObstacle(adc_trajectory_container, obstacle,
-                      obstacles_container, dynamic_env);
+                      obstacles_container, dynamic_env, true);
     }
   }
+  EvaluateBatchObstacles(obstacles_container);
+  auto end_time = std::chrono::system_clock::now();
+  std::chrono::duration<double> time_cost = end_time - start_time;
+  AINFO << "evaluators used time: " << time_cost.count() * 1000 << " ms"
+        << (FLAGS_enable_batch_evaluation ? " with batch evaluation." : ".");
 }
 
 void EvaluatorManager::EvaluateObstacle(
@@ -271,6 +277,15 @@ void EvaluatorManager::EvaluateObstacle(
     Obstacle* obstacle,
     ObstaclesContainer* obstacles_container,
     std::vector<Obstacle*> dynamic_env) {
+  EvaluateObstacle(adc_trajectory_container, obstacle, obstacles_container,
+                   dynamic_env, false);
+}
+
+void EvaluatorManager::EvaluateObstacle(
+    const ADCTrajectoryContainer* adc_trajectory_container,
+    Obstacle* obstacle,
+    ObstaclesContainer* obstacles_container,
+    const std::vector<Obstacle*>& dynamic_env, const bool allow_defer) {
   Evaluator* evaluator = nullptr;
   // Select different evaluators depending on the obstacle's type.
   switch (obstacle->type()) {
@@ -314,20 +329,14 @@ void EvaluatorManager::EvaluateObstacle(
       // if obstacle is not caution or caution_evaluator run failed
       if (obstacle->HasJunctionFeatureWithExits() &&
           !obstacle->IsCloseToJunctionExit()) {
-        evaluator = GetEvaluator(vehicle_in_junction_evaluator_);
+        EvaluateOrDefer(vehicle_in_junction_evaluator_, obstacle,
+                        obstacles_container, dynamic_env, allow_defer);
       } else if (obstacle->IsOnLane()) {
-        evaluator = GetEvaluator(vehicle_on_lane_evaluator_);
+        EvaluateOrDefer(vehicle_on_lane_evaluator_, obstacle,
+                        obstacles_container, dynamic_env, allow_defer);
       } else {
         AINFO << "Obstacle: " << obstacle->id()
                << " is neither on lane, nor in junction. Skip evaluating.";
-        break;
-      }
-      AINFO << "Normal Obstacle: " << obstacle->id() << " used " << evaluator->GetName();
-      CHECK_NOTNULL(evaluator);
-      if (evaluator->GetName() == "LANE_SCANNING_EVALUATOR") {
-        evaluator->Evaluate(obstacle, obstacles_container, dynamic_env);
-      } else {
-        evaluator->Evaluate(obstacle, obstacles_container);
       }
       break;
     }
@@ -368,6 +377,48 @@ void EvaluatorManager::EvaluateObstacle(
   }
 }
 
+void EvaluatorManager::EvaluateOrDefer(
+    const ObstacleConf::EvaluatorType& type, Obstacle* obstacle,
+    ObstaclesContainer* obstacles_container,
+    const std::vector<Obstacle*>& dynamic_env, const bool allow_defer) {
+  Evaluator* evaluator = GetEvaluator(type);
+  CHECK_NOTNULL(evaluator);
+  AINFO << "Normal Obstacle: " << obstacle->id() << " used "
+        << evaluator->GetName();
+  if (allow_defer && FLAGS_enable_batch_evaluation &&
+      evaluator->SupportBatchEvaluation()) {
+    std::lock_guard<std::mutex> lock(batch_obstacles_mutex_);
+    batch_obstacles_[type].push_back(obstacle);
+    return;
+  }
+  if (evaluator->GetName() == "LANE_SCANNING_EVALUATOR") {
+    evaluator->Evaluate(obstacle, obstacles_container, dynamic_env);
+  } else {
+    evaluator->Evaluate(obstacle, obstacles_container);
+  }
+}
+
+void EvaluatorManager::EvaluateBatchObstacles(
+    ObstaclesContainer* obstacles_container) {
+  for (auto& type_obstacles : batch_obstacles_) {
+    std::vector<Obstacle*>& obstacles = type_obstacles.second;
+    if (obstacles.empty()) {
+      continue;
+    }
+    // Obstacles are deferred by the thread pool in any order.
+    std::sort(obstacles.begin(), obstacles.end(),
+              [](const Obstacle* lhs, const Obstacle* rhs) {
+                return lhs->id() < rhs->id();
+              });
+    Evaluator* evaluator = GetEvaluator(type_obstacles.first);
+    CHECK_NOTNULL(evaluator);
+    evaluator->EvaluateBatch(obstacles, obstacles_container);
+    ADEBUG << evaluator->GetName() << " evaluated a batch of "
+           << obstacles.size() << " obstacles.";
+  }
+  batch_obstacles_.clear();
+}
+
 void EvaluatorManager::EvaluateMultiObstacle(
     const ADCTrajectoryContainer* adc_trajectory_container,
     ObstaclesContainer* obstacles_container) {
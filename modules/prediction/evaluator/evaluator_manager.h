@@ -24,6 +24,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -107,6 +108,32 @@ class EvaluatorManager {
    */
   void RegisterEvaluators();
 
+  /**
+   * @brief Evaluate the obstacle. With allow_defer, the obstacles of batched
+   *        evaluators are deferred to EvaluateBatchObstacles, which the
+   *        caller must run before the end of the frame
+   */
+  void EvaluateObstacle(const ADCTrajectoryContainer* adc_trajectory_container,
+                        Obstacle* obstacle,
+                        ObstaclesContainer* obstacles_container,
+                        const std::vector<Obstacle*>& dynamic_env,
+                        const bool allow_defer);
+
+  /**
+   * @brief Evaluate the obstacle with the evaluator of the type, or defer it
+   *        to a batched evaluation if allowed, enabled and supported
+   */
+  void EvaluateOrDefer(const ObstacleConf::EvaluatorType& type,
+                       Obstacle* obstacle,
+                       ObstaclesContainer* obstacles_container,
+                       const std::vector<Obstacle*>& dynamic_env,
+                       const bool allow_defer);
+
+  /**
+   * @brief Run the deferred obstacles of every evaluator as one batch
+   */
+  void EvaluateBatchObstacles(ObstaclesContainer* obstacles_container);
+
  private:
   std::map<ObstacleConf::EvaluatorType, std::unique_ptr<Evaluator>> evaluators_;
 
@@ -145,6 +172,11 @@ class EvaluatorManager {
 
   std::unordered_map<int, ObstacleHistory> obstacle_id_history_map_;
 
+  // obstacles deferred to a batched evaluation in the current frame
+  std::map<ObstacleConf::EvaluatorType, std::vector<Obstacle*>>
+      batch_obstacles_;
+  std::mutex batch_obstacles_mutex_;
+
   std::unique_ptr<SemanticMap> semantic_map_;
 };
 
@@ -18,6 +18,7 @@
 
 #include "cyber/common/file.h"
 #include "modules/prediction/common/kml_map_based_test.h"
+#include "modules/prediction/common/prediction_system_gflags.h"
 #include "modules/prediction/container/container_manager.h"
 #include "modules/prediction/container/obstacles/obstacles_container.h"
 
@@ -73,5 +74,33 @@ TEST_F(EvaluatorManagerTest, General) {
   }
 }
 
+TEST_F(EvaluatorManagerTest, EvaluateObstacleWithBatchEvaluation) {
+  FLAGS_enable_batch_evaluation = true;
+  AddObstacleCopies(3, &perception_obstacles_);
+  ObstaclesContainer obstacles_container;
+  obstacles_container.Insert(perception_obstacles_);
+  obstacles_container.BuildLaneGraph();
+
+  EvaluatorManager evaluator_manager;
+  evaluator_manager.Init(prediction_conf_);
+  // As the offline processing of the feature protos, out of Run
+  int num_lane_sequences = 0;
+  for (const auto& perception_obstacle :
+       perception_obstacles_.perception_obstacle()) {
+    Obstacle* obstacle_ptr =
+        obstacles_container.GetObstacle(perception_obstacle.id());
+    ASSERT_NE(obstacle_ptr, nullptr);
+    evaluator_manager.EvaluateObstacle(obstacle_ptr, &obstacles_container);
+    const LaneGraph& lane_graph =
+        obstacle_ptr->latest_feature().lane().lane_graph();
+    for (const auto& lane_sequence : lane_graph.lane_sequence()) {
+      EXPECT_TRUE(lane_sequence.has_probability());
+      ++num_lane_sequences;
+    }
+  }
+  EXPECT_GT(num_lane_sequences, 0);
+  FLAGS_enable_batch_evaluation = false;
+}
+
 }  // namespace prediction
 }  // namespace apollo
@@ -56,29 +56,12 @@ bool CruiseMLPEvaluator::Evaluate(Obstacle* obstacle_ptr,
   // Sanity checks.
   omp_set_num_threads(1);
   Clear();
-  CHECK_NOTNULL(obstacle_ptr);
-
-  obstacle_ptr->SetEvaluatorType(evaluator_type_);
-
-  int id = obstacle_ptr->id();
-  if (!obstacle_ptr->latest_feature().IsInitialized()) {
-    AERROR << "Obstacle [" << id << "] has no latest feature.";
+  LaneGraph* lane_graph_ptr = GetLaneGraph(obstacle_ptr);
+  if (lane_graph_ptr == nullptr) {
     return false;
   }
+  int id = obstacle_ptr->id();
   Feature* latest_feature_ptr = obstacle_ptr->mutable_latest_feature();
-  CHECK_NOTNULL(latest_feature_ptr);
-  if (!latest_feature_ptr->has_lane() ||
-      !latest_feature_ptr->lane().has_lane_graph()) {
-    ADEBUG << "Obstacle [" << id << "] has no lane graph.";
-    return false;
-  }
-  LaneGraph* lane_graph_ptr =
-      latest_feature_ptr->mutable_lane()->mutable_lane_graph();
-  CHECK_NOTNULL(lane_graph_ptr);
-  if (lane_graph_ptr->lane_sequence().empty()) {
-    AERROR << "Obstacle [" << id << "] has no lane sequences.";
-    return false;
-  }
 
   ADEBUG << "There are " << lane_graph_ptr->lane_sequence_size()
          << " lane sequences with probabilities:";
@@ -121,23 +104,92 @@ bool CruiseMLPEvaluator::Evaluate(Obstacle* obstacle_ptr,
       return true;  // Skip Compute probability for offline mode
     }
 
-    std::vector<torch::jit::IValue> torch_inputs;
-    int input_dim = static_cast<int>(
-        OBSTACLE_FEATURE_SIZE + SINGLE_LANE_FEATURE_SIZE * LANE_POINTS_SIZE);
-    torch::Tensor torch_input = torch::zeros({1, input_dim});
-    for (size_t i = 0; i < feature_values.size(); ++i) {
-      torch_input[0][i] = static_cast<float>(feature_values[i]);
-    }
-    torch_inputs.push_back(std::move(torch_input.to(device_)));
     if (lane_sequence_ptr->vehicle_on_lane()) {
-      ModelInference(torch_inputs, torch_go_model_, lane_sequence_ptr);
+      ModelInference({feature_values}, torch_go_model_, {lane_sequence_ptr});
     } else {
-      ModelInference(torch_inputs, torch_cutin_model_, lane_sequence_ptr);
+      ModelInference({feature_values}, torch_cutin_model_,
+                     {lane_sequence_ptr});
     }
   }
   return true;
 }
 
+void CruiseMLPEvaluator::EvaluateBatch(
+    const std::vector<Obstacle*>& obstacles,
+    ObstaclesContainer* obstacles_container) {
+  // Features for learning are dumped obstacle by obstacle.
+  if (FLAGS_prediction_offline_mode ==
+      PredictionConstants::kDumpDataForLearning) {
+    Evaluator::EvaluateBatch(obstacles, obstacles_container);
+    return;
+  }
+  omp_set_num_threads(1);
+  Clear();
+
+  std::vector<std::vector<double>> go_feature_values;
+  std::vector<LaneSequence*> go_lane_sequences;
+  std::vector<std::vector<double>> cutin_feature_values;
+  std::vector<LaneSequence*> cutin_lane_sequences;
+  for (Obstacle* obstacle_ptr : obstacles) {
+    LaneGraph* lane_graph_ptr = GetLaneGraph(obstacle_ptr);
+    if (lane_graph_ptr == nullptr) {
+      continue;
+    }
+    for (int i = 0; i < lane_graph_ptr->lane_sequence_size(); ++i) {
+      LaneSequence* lane_sequence_ptr =
+          lane_graph_ptr->mutable_lane_sequence(i);
+      CHECK_NOTNULL(lane_sequence_ptr);
+      std::vector<double> feature_values;
+      ExtractFeatureValues(obstacle_ptr, lane_sequence_ptr, &feature_values);
+      if (feature_values.size() !=
+          OBSTACLE_FEATURE_SIZE + SINGLE_LANE_FEATURE_SIZE * LANE_POINTS_SIZE) {
+        lane_sequence_ptr->set_probability(0.0);
+        ADEBUG << "Skip lane sequence due to incorrect feature size";
+        continue;
+      }
+      if (lane_sequence_ptr->vehicle_on_lane()) {
+        go_feature_values.push_back(std::move(feature_values));
+        go_lane_sequences.push_back(lane_sequence_ptr);
+      } else {
+        cutin_feature_values.push_back(std::move(feature_values));
+        cutin_lane_sequences.push_back(lane_sequence_ptr);
+      }
+    }
+  }
+  ADEBUG << "Batch of " << go_lane_sequences.size() << " go and "
+         << cutin_lane_sequences.size() << " cut-in lane sequences.";
+  ModelInference(go_feature_values, torch_go_model_, go_lane_sequences);
+  ModelInference(cutin_feature_values, torch_cutin_model_,
+                 cutin_lane_sequences);
+}
+
+LaneGraph* CruiseMLPEvaluator::GetLaneGraph(Obstacle* obstacle_ptr) {
+  CHECK_NOTNULL(obstacle_ptr);
+
+  obstacle_ptr->SetEvaluatorType(evaluator_type_);
+
+  int id = obstacle_ptr->id();
+  if (!obstacle_ptr->latest_feature().IsInitialized()) {
+    AERROR << "Obstacle [" << id << "] has no latest feature.";
+    return nullptr;
+  }
+  Feature* latest_feature_ptr = obstacle_ptr->mutable_latest_feature();
+  CHECK_NOTNULL(latest_feature_ptr);
+  if (!latest_feature_ptr->has_lane() ||
+      !latest_feature_ptr->lane().has_lane_graph()) {
+    ADEBUG << "Obstacle [" << id << "] has no lane graph.";
+    return nullptr;
+  }
+  LaneGraph* lane_graph_ptr =
+      latest_feature_ptr->mutable_lane()->mutable_lane_graph();
+  CHECK_NOTNULL(lane_graph_ptr);
+  if (lane_graph_ptr->lane_sequence().empty()) {
+    AERROR << "Obstacle [" << id << "] has no lane sequences.";
+    return nullptr;
+  }
+  return lane_graph_ptr;
+}
+
 void CruiseMLPEvaluator::ExtractFeatureValues(
     Obstacle* obstacle_ptr, LaneSequence* lane_sequence_ptr,
     std::vector<double>* feature_values) {
@@ -555,18 +607,39 @@ void CruiseMLPEvaluator::LoadModels() {
 }
 
 void CruiseMLPEvaluator::ModelInference(
-    const std::vector<torch::jit::IValue>& torch_inputs,
+    const std::vector<std::vector<double>>& feature_values,
     torch::jit::script::Module torch_model_ptr,
-    LaneSequence* lane_sequence_ptr) {
+    const std::vector<LaneSequence*>& lane_sequences) {
+  CHECK_EQ(feature_values.size(), lane_sequences.size());
+  if (feature_values.empty()) {
+    return;
+  }
+  int batch_size = static_cast<int>(feature_values.size());
+  int input_dim = static_cast<int>(
+      OBSTACLE_FEATURE_SIZE + SINGLE_LANE_FEATURE_SIZE * LANE_POINTS_SIZE);
+  torch::Tensor torch_input = torch::zeros({batch_size, input_dim});
+  auto torch_input_accessor = torch_input.accessor<float, 2>();
+  for (int i = 0; i < batch_size; ++i) {
+    for (size_t j = 0; j < feature_values[i].size(); ++j) {
+      torch_input_accessor[i][j] = static_cast<float>(feature_values[i][j]);
+    }
+  }
+  std::vector<torch::jit::IValue> torch_inputs;
+  torch_inputs.push_back(std::move(torch_input.to(device_)));
+
   auto torch_output_tuple = torch_model_ptr.forward(torch_inputs).toTuple();
   auto probability_tensor =
       torch_output_tuple->elements()[0].toTensor().to(torch::kCPU);
   auto finish_time_tensor =
       torch_output_tuple->elements()[1].toTensor().to(torch::kCPU);
-  lane_sequence_ptr->set_probability(apollo::common::math::Sigmoid(
-      static_cast<double>(probability_tensor.accessor<float, 2>()[0][0])));
-  lane_sequence_ptr->set_time_to_lane_center(
-      static_cast<double>(finish_time_tensor.accessor<float, 2>()[0][0]));
+  auto probability = probability_tensor.accessor<float, 2>();
+  auto finish_time = finish_time_tensor.accessor<float, 2>();
+  for (int i = 0; i < batch_size; ++i) {
+    lane_sequences[i]->set_probability(apollo::common::math::Sigmoid(
+        static_cast<double>(probability[i][0])));
+    lane_sequences[i]->set_time_to_lane_center(
+        static_cast<double>(finish_time[i][0]));
+  }
 }
 
 }  // namespace prediction
@@ -49,6 +49,20 @@ class CruiseMLPEvaluator : public Evaluator {
   bool Evaluate(Obstacle* obstacle_ptr,
                 ObstaclesContainer* obstacles_container) override;
 
+  /**
+   * @brief Cruise MLP models run a batch of lane sequences in one forward
+   */
+  bool SupportBatchEvaluation() const override { return true; }
+
+  /**
+   * @brief Override EvaluateBatch, lane sequences of all the obstacles run in
+   *        one forward of the go model and one of the cut-in model
+   * @param Obstacle pointers
+   * @param Obstacles container
+   */
+  void EvaluateBatch(const std::vector<Obstacle*>& obstacles,
+                     ObstaclesContainer* obstacles_container) override;
+
   /**
    * @brief Extract feature vector
    * @param Obstacle pointer
@@ -96,14 +110,28 @@ class CruiseMLPEvaluator : public Evaluator {
                             const LaneSequence* lane_sequence_ptr,
                             std::vector<double>* feature_values);
 
+  /**
+   * @brief Sanity check the obstacle and get its lane graph
+   * @param Obstacle pointer
+   * @return Lane graph pointer, nullptr if the obstacle can not be evaluated
+   */
+  LaneGraph* GetLaneGraph(Obstacle* obstacle_ptr);
+
   /**
    * @brief Load model files
    */
   void LoadModels();
 
-  void ModelInference(const std::vector<torch::jit::IValue>& torch_inputs,
+  /**
+   * @brief Run the model on a batch of feature vectors, one row per lane
+   *        sequence, and set the results to the lane sequences
+   * @param Feature vectors
+   * @param Torch model
+   * @param Lane sequence pointers in the same order as the feature vectors
+   */
+  void ModelInference(const std::vector<std::vector<double>>& feature_values,
                       torch::jit::script::Module torch_model_ptr,
-                      LaneSequence* lane_sequence_ptr);
+                      const std::vector<LaneSequence*>& lane_sequences);
 
  private:
   static const size_t OBSTACLE_FEATURE_SIZE = 23 + 5 * 9;
@@ -16,6 +16,8 @@
 
 #include "modules/prediction/evaluator/vehicle/cruise_mlp_evaluator.h"
 
+#include <vector>
+
 #include "cyber/common/file.h"
 #include "modules/prediction/common/kml_map_based_test.h"
 #include "modules/prediction/container/obstacles/obstacles_container.h"
@@ -56,5 +58,51 @@ TEST_F(CruiseMLPEvaluatorTest, OnLaneCase) {
   cruise_mlp_evaluator.Clear();
 }
 
+TEST_F(CruiseMLPEvaluatorTest, BatchMatchesSingle) {
+  AddObstacleCopies(3, &perception_obstacles_);
+  CruiseMLPEvaluator cruise_mlp_evaluator;
+  ObstaclesContainer single_container;
+  single_container.Insert(perception_obstacles_);
+  single_container.BuildLaneGraph();
+  ObstaclesContainer batch_container;
+  batch_container.Insert(perception_obstacles_);
+  batch_container.BuildLaneGraph();
+
+  std::vector<Obstacle*> batch_obstacles;
+  for (const auto& perception_obstacle :
+       perception_obstacles_.perception_obstacle()) {
+    Obstacle* obstacle_ptr =
+        single_container.GetObstacle(perception_obstacle.id());
+    ASSERT_NE(obstacle_ptr, nullptr);
+    cruise_mlp_evaluator.Evaluate(obstacle_ptr, &single_container);
+    batch_obstacles.push_back(
+        batch_container.GetObstacle(perception_obstacle.id()));
+    ASSERT_NE(batch_obstacles.back(), nullptr);
+  }
+  cruise_mlp_evaluator.EvaluateBatch(batch_obstacles, &batch_container);
+
+  int num_lane_sequences = 0;
+  for (const Obstacle* batch_obstacle : batch_obstacles) {
+    const LaneGraph& single_lane_graph =
+        single_container.GetObstacle(batch_obstacle->id())
+            ->latest_feature()
+            .lane()
+            .lane_graph();
+    const LaneGraph& batch_lane_graph =
+        batch_obstacle->latest_feature().lane().lane_graph();
+    ASSERT_EQ(single_lane_graph.lane_sequence_size(),
+              batch_lane_graph.lane_sequence_size());
+    for (int i = 0; i < single_lane_graph.lane_sequence_size(); ++i) {
+      const LaneSequence& single = single_lane_graph.lane_sequence(i);
+      const LaneSequence& batch = batch_lane_graph.lane_sequence(i);
+      EXPECT_NEAR(single.probability(), batch.probability(), 1e-5);
+      EXPECT_NEAR(single.time_to_lane_center(), batch.time_to_lane_center(),
+                  1e-4);
+      ++num_lane_sequences;
+    }
+  }
+  EXPECT_GT(num_lane_sequences, 0);
+}
+
 }  // namespace prediction
 }  // namespace apollo
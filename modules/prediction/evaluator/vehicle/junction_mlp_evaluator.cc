@@ -67,6 +67,74 @@ bool JunctionMLPEvaluator::Evaluate(Obstacle* obstacle_ptr,
   // Sanity checks.
   omp_set_num_threads(1);
   Clear();
+  std::vector<double> feature_values;
+  if (!CheckAndExtractFeatureValues(obstacle_ptr, obstacles_container,
+                                    &feature_values)) {
+    return false;
+  }
+  Feature* latest_feature_ptr = obstacle_ptr->mutable_latest_feature();
+
+  // Insert features to DataForLearning
+  if (FLAGS_prediction_offline_mode ==
+      PredictionConstants::kDumpDataForLearning) {
+    FeatureOutput::InsertDataForLearning(*latest_feature_ptr, feature_values,
+                                         "junction", nullptr);
+    ADEBUG << "Save extracted features for learning locally.";
+    return true;  // Skip Compute probability for offline mode
+  }
+  std::vector<double> probability;
+  if (latest_feature_ptr->junction_feature().junction_exit_size() > 1) {
+    std::vector<std::vector<double>> probabilities;
+    ModelInference({feature_values}, &probabilities);
+    probability = std::move(probabilities.front());
+  } else {
+    probability = FeatureProbability(feature_values);
+  }
+  return SetProbability(obstacle_ptr, probability);
+}
+
+void JunctionMLPEvaluator::EvaluateBatch(
+    const std::vector<Obstacle*>& obstacles,
+    ObstaclesContainer* obstacles_container) {
+  // Features for learning are dumped obstacle by obstacle.
+  if (FLAGS_prediction_offline_mode ==
+      PredictionConstants::kDumpDataForLearning) {
+    Evaluator::EvaluateBatch(obstacles, obstacles_container);
+    return;
+  }
+  omp_set_num_threads(1);
+  Clear();
+
+  std::vector<std::vector<double>> batch_feature_values;
+  std::vector<Obstacle*> batch_obstacles;
+  for (Obstacle* obstacle_ptr : obstacles) {
+    std::vector<double> feature_values;
+    if (!CheckAndExtractFeatureValues(obstacle_ptr, obstacles_container,
+                                      &feature_values)) {
+      continue;
+    }
+    if (obstacle_ptr->latest_feature().junction_feature().junction_exit_size() >
+        1) {
+      batch_feature_values.push_back(std::move(feature_values));
+      batch_obstacles.push_back(obstacle_ptr);
+    } else {
+      SetProbability(obstacle_ptr, FeatureProbability(feature_values));
+    }
+  }
+  if (batch_obstacles.empty()) {
+    return;
+  }
+  ADEBUG << "Batch of " << batch_obstacles.size() << " junction obstacles.";
+  std::vector<std::vector<double>> probabilities;
+  ModelInference(batch_feature_values, &probabilities);
+  for (size_t i = 0; i < batch_obstacles.size(); ++i) {
+    SetProbability(batch_obstacles[i], probabilities[i]);
+  }
+}
+
+bool JunctionMLPEvaluator::CheckAndExtractFeatureValues(
+    Obstacle* obstacle_ptr, ObstaclesContainer* obstacles_container,
+    std::vector<double>* feature_values) {
   CHECK_NOTNULL(obstacle_ptr);
 
   obstacle_ptr->SetEvaluatorType(evaluator_type_);
@@ -86,39 +154,25 @@ bool JunctionMLPEvaluator::Evaluate(Obstacle* obstacle_ptr,
     return false;
   }
 
-  std::vector<double> feature_values;
-  ExtractFeatureValues(obstacle_ptr, obstacles_container, &feature_values);
+  ExtractFeatureValues(obstacle_ptr, obstacles_container, feature_values);
+  return true;
+}
 
-  // Insert features to DataForLearning
-  if (FLAGS_prediction_offline_mode ==
-      PredictionConstants::kDumpDataForLearning) {
-    FeatureOutput::InsertDataForLearning(*latest_feature_ptr, feature_values,
-                                         "junction", nullptr);
-    ADEBUG << "Save extracted features for learning locally.";
-    return true;  // Skip Compute probability for offline mode
-  }
-  std::vector<torch::jit::IValue> torch_inputs;
-  int input_dim = static_cast<int>(
-      OBSTACLE_FEATURE_SIZE + EGO_VEHICLE_FEATURE_SIZE + JUNCTION_FEATURE_SIZE);
-  torch::Tensor torch_input = torch::zeros({1, input_dim});
-  for (size_t i = 0; i < feature_values.size(); ++i) {
-    torch_input[0][i] = static_cast<float>(feature_values[i]);
-  }
-  torch_inputs.push_back(std::move(torch_input.to(device_)));
+std::vector<double> JunctionMLPEvaluator::FeatureProbability(
+    const std::vector<double>& feature_values) {
   std::vector<double> probability;
-  if (latest_feature_ptr->junction_feature().junction_exit_size() > 1) {
-    at::Tensor torch_output_tensor =
-        torch_model_.forward(torch_inputs).toTensor().to(torch::kCPU);
-    auto torch_output = torch_output_tensor.accessor<float, 2>();
-    for (int i = 0; i < torch_output.size(1); ++i) {
-      probability.push_back(static_cast<double>(torch_output[0][i]));
-    }
-  } else {
-    for (int i = 0; i < 12; ++i) {
-      probability.push_back(feature_values[OBSTACLE_FEATURE_SIZE +
-                                           EGO_VEHICLE_FEATURE_SIZE + 8 * i]);
-    }
+  for (int i = 0; i < 12; ++i) {
+    probability.push_back(
+        feature_values[OBSTACLE_FEATURE_SIZE + EGO_VEHICLE_FEATURE_SIZE +
+                       8 * i]);
   }
+  return probability;
+}
+
+bool JunctionMLPEvaluator::SetProbability(
+    Obstacle* obstacle_ptr, const std::vector<double>& probability) {
+  int id = obstacle_ptr->id();
+  Feature* latest_feature_ptr = obstacle_ptr->mutable_latest_feature();
   for (double prob : probability) {
     latest_feature_ptr->mutable_junction_feature()
         ->add_junction_mlp_probability(prob);
@@ -161,6 +215,33 @@ bool JunctionMLPEvaluator::Evaluate(Obstacle* obstacle_ptr,
   return true;
 }
 
+void JunctionMLPEvaluator::ModelInference(
+    const std::vector<std::vector<double>>& feature_values,
+    std::vector<std::vector<double>>* probabilities) {
+  int batch_size = static_cast<int>(feature_values.size());
+  int input_dim = static_cast<int>(
+      OBSTACLE_FEATURE_SIZE + EGO_VEHICLE_FEATURE_SIZE + JUNCTION_FEATURE_SIZE);
+  torch::Tensor torch_input = torch::zeros({batch_size, input_dim});
+  auto torch_input_accessor = torch_input.accessor<float, 2>();
+  for (int i = 0; i < batch_size; ++i) {
+    for (size_t j = 0; j < feature_values[i].size(); ++j) {
+      torch_input_accessor[i][j] = static_cast<float>(feature_values[i][j]);
+    }
+  }
+  std::vector<torch::jit::IValue> torch_inputs;
+  torch_inputs.push_back(std::move(torch_input.to(device_)));
+
+  at::Tensor torch_output_tensor =
+      torch_model_.forward(torch_inputs).toTensor().to(torch::kCPU);
+  auto torch_output = torch_output_tensor.accessor<float, 2>();
+  probabilities->assign(batch_size, std::vector<double>());
+  for (int i = 0; i < batch_size; ++i) {
+    for (int j = 0; j < torch_output.size(1); ++j) {
+      (*probabilities)[i].push_back(static_cast<double>(torch_output[i][j]));
+    }
+  }
+}
+
 void JunctionMLPEvaluator::ExtractFeatureValues(
     Obstacle* obstacle_ptr, ObstaclesContainer* obstacles_container,
     std::vector<double>* feature_values) {
@@ -53,6 +53,20 @@ class JunctionMLPEvaluator : public Evaluator {
   bool Evaluate(Obstacle* obstacle_ptr,
                 ObstaclesContainer* obstacles_container) override;
 
+  /**
+   * @brief Junction MLP model runs a batch of obstacles in one forward
+   */
+  bool SupportBatchEvaluation() const override { return true; }
+
+  /**
+   * @brief Override EvaluateBatch, obstacles with multiple junction exits
+   *        run in one model forward
+   * @param Obstacle pointers
+   * @param Obstacles container
+   */
+  void EvaluateBatch(const std::vector<Obstacle*>& obstacles,
+                     ObstaclesContainer* obstacles_container) override;
+
   /**
    * @brief Extract feature vector
    * @param Obstacle pointer
@@ -95,6 +109,43 @@ class JunctionMLPEvaluator : public Evaluator {
   void SetJunctionFeatureValues(Obstacle* obstacle_ptr,
                                 std::vector<double>* const feature_values);
 
+  /**
+   * @brief Sanity check the obstacle and extract its feature vector
+   * @param Obstacle pointer
+   * @param Obstacles container
+   * @param Feature container in a vector for receiving the feature values
+   * @return If the obstacle can be evaluated
+   */
+  bool CheckAndExtractFeatureValues(Obstacle* obstacle_ptr,
+                                    ObstaclesContainer* obstacles_container,
+                                    std::vector<double>* feature_values);
+
+  /**
+   * @brief Probabilities of the 12 fan areas taken from the junction
+   *        features, used when there is only one junction exit
+   * @param Feature vector
+   */
+  std::vector<double> FeatureProbability(
+      const std::vector<double>& feature_values);
+
+  /**
+   * @brief Set the probabilities to the junction feature and the lane
+   *        sequences of the obstacle
+   * @param Obstacle pointer
+   * @param Probabilities of the 12 fan areas
+   * @return If there are lane sequences to assign
+   */
+  bool SetProbability(Obstacle* obstacle_ptr,
+                      const std::vector<double>& probability);
+
+  /**
+   * @brief Run the model on a batch of feature vectors
+   * @param Feature vectors
+   * @param Probabilities of the 12 fan areas per feature vector
+   */
+  void ModelInference(const std::vector<std::vector<double>>& feature_values,
+                      std::vector<std::vector<double>>* probabilities);
+
   /**
    * @brief Load model file
    */
@@ -16,6 +16,8 @@
 
 #include "modules/prediction/evaluator/vehicle/junction_mlp_evaluator.h"
 
+#include <vector>
+
 #include "cyber/common/file.h"
 #include "modules/prediction/common/junction_analyzer.h"
 #include "modules/prediction/common/kml_map_based_test.h"
@@ -64,5 +66,54 @@ TEST_F(JunctionMLPEvaluatorTest, InJunctionCase) {
   junction_mlp_evaluator.Clear();
 }
 
+TEST_F(JunctionMLPEvaluatorTest, BatchMatchesSingle) {
+  AddObstacleCopies(3, &perception_obstacles_);
+  JunctionMLPEvaluator junction_mlp_evaluator;
+  ObstaclesContainer single_container;
+  single_container.GetJunctionAnalyzer()->Init("j2");
+  single_container.Insert(perception_obstacles_);
+  single_container.BuildJunctionFeature();
+  ObstaclesContainer batch_container;
+  batch_container.GetJunctionAnalyzer()->Init("j2");
+  batch_container.Insert(perception_obstacles_);
+  batch_container.BuildJunctionFeature();
+
+  std::vector<Obstacle*> batch_obstacles;
+  for (const auto& perception_obstacle :
+       perception_obstacles_.perception_obstacle()) {
+    Obstacle* obstacle_ptr =
+        single_container.GetObstacle(perception_obstacle.id());
+    ASSERT_NE(obstacle_ptr, nullptr);
+    junction_mlp_evaluator.Evaluate(obstacle_ptr, &single_container);
+    batch_obstacles.push_back(
+        batch_container.GetObstacle(perception_obstacle.id()));
+    ASSERT_NE(batch_obstacles.back(), nullptr);
+  }
+  junction_mlp_evaluator.EvaluateBatch(batch_obstacles, &batch_container);
+
+  for (const Obstacle* batch_obstacle : batch_obstacles) {
+    const Feature& single_feature =
+        single_container.GetObstacle(batch_obstacle->id())->latest_feature();
+    const Feature& batch_feature = batch_obstacle->latest_feature();
+    const JunctionFeature& single = single_feature.junction_feature();
+    const JunctionFeature& batch = batch_feature.junction_feature();
+    ASSERT_EQ(12, batch.junction_mlp_probability_size());
+    ASSERT_EQ(single.junction_mlp_probability_size(),
+              batch.junction_mlp_probability_size());
+    for (int i = 0; i < single.junction_mlp_probability_size(); ++i) {
+      EXPECT_NEAR(single.junction_mlp_probability(i),
+                  batch.junction_mlp_probability(i), 1e-5);
+    }
+    const LaneGraph& single_lane_graph = single_feature.lane().lane_graph();
+    const LaneGraph& batch_lane_graph = batch_feature.lane().lane_graph();
+    ASSERT_EQ(single_lane_graph.lane_sequence_size(),
+              batch_lane_graph.lane_sequence_size());
+    for (int i = 0; i < single_lane_graph.lane_sequence_size(); ++i) {
+      EXPECT_NEAR(single_lane_graph.lane_sequence(i).probability(),
+                  batch_lane_graph.lane_sequence(i).probability(), 1e-5);
+    }
+  }
+}
+
 }  // namespace prediction
 }  // namespace apollo
@@ -0,0 +1,137 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Latency of the cruise and junction MLP evaluators on the kml test map, with
+// the obstacles of a frame evaluated one by one or in one batch. The frame is
+// the test obstacle and copies of it at other speeds, the argument is the
+// number of obstacles.
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "cyber/common/file.h"
+#include "modules/common/configs/config_gflags.h"
+#include "modules/prediction/common/prediction_gflags.h"
+#include "modules/prediction/container/obstacles/obstacles_container.h"
+#include "modules/prediction/evaluator/vehicle/cruise_mlp_evaluator.h"
+#include "modules/prediction/evaluator/vehicle/junction_mlp_evaluator.h"
+
+namespace apollo {
+namespace prediction {
+namespace {
+
+using apollo::perception::PerceptionObstacles;
+
+PerceptionObstacles LoadObstacles(const std::string& file,
+                                  const int num_obstacles) {
+  FLAGS_map_dir = "modules/prediction/testdata";
+  FLAGS_base_map_filename = "kml_map.bin";
+  FLAGS_enable_all_junction = true;
+  PerceptionObstacles perception_obstacles;
+  ACHECK(cyber::common::GetProtoFromFile(
+      "modules/prediction/testdata/" + file, &perception_obstacles));
+  const auto obstacle = perception_obstacles.perception_obstacle(0);
+  for (int i = 1; i < num_obstacles; ++i) {
+    auto* copy = perception_obstacles.add_perception_obstacle();
+    *copy = obstacle;
+    copy->set_id(obstacle.id() + i);
+    const double scale = 1.0 + 0.2 * i;
+    copy->mutable_velocity()->set_x(obstacle.velocity().x() * scale);
+    copy->mutable_velocity()->set_y(obstacle.velocity().y() * scale);
+  }
+  return perception_obstacles;
+}
+
+std::vector<Obstacle*> GetObstacles(
+    const PerceptionObstacles& perception_obstacles,
+    ObstaclesContainer* container) {
+  std::vector<Obstacle*> obstacles;
+  for (const auto& perception_obstacle :
+       perception_obstacles.perception_obstacle()) {
+    obstacles.push_back(container->GetObstacle(perception_obstacle.id()));
+  }
+  return obstacles;
+}
+
+// args: number of obstacles
+template <typename EvaluatorType, bool kBatch>
+void BM_Evaluate(benchmark::State& state) {  // NOLINT
+  const bool in_junction =
+      std::is_same<EvaluatorType, JunctionMLPEvaluator>::value;
+  const auto perception_obstacles = LoadObstacles(
+      in_junction ? "single_perception_vehicle_injunction.pb.txt"
+                  : "single_perception_vehicle_onlane.pb.txt",
+      static_cast<int>(state.range(0)));
+  EvaluatorType evaluator;
+  for (auto _ : state) {
+    // the features are rebuilt for every frame, as the evaluators add to them
+    state.PauseTiming();
+    ObstaclesContainer container;
+    if (in_junction) {
+      container.GetJunctionAnalyzer()->Init("j2");
+    }
+    container.Insert(perception_obstacles);
+    if (in_junction) {
+      container.BuildJunctionFeature();
+    } else {
+      container.BuildLaneGraph();
+    }
+    const auto obstacles = GetObstacles(perception_obstacles, &container);
+    state.ResumeTiming();
+
+    if (kBatch) {
+      evaluator.EvaluateBatch(obstacles, &container);
+    } else {
+      for (Obstacle* obstacle : obstacles) {
+        evaluator.Evaluate(obstacle, &container);
+      }
+    }
+  }
+  state.counters["obstacles"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * state.range(0)),
+      benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_TEMPLATE(BM_Evaluate, CruiseMLPEvaluator, false)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(32)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Evaluate, CruiseMLPEvaluator, true)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(32)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Evaluate, JunctionMLPEvaluator, false)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(32)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_Evaluate, JunctionMLPEvaluator, true)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(32)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace prediction
+}  // namespace apollo
+
+BENCHMARK_MAIN();
@@ -32,3 +32,11 @@ DEFINE_bool(enable_change_lane_in_result, true,
 
 DEFINE_uint32(routing_response_history_interval_ms, 1000,
               "ms, emit routing resposne for this time interval");
+
+DEFINE_int32(routing_landmark_num, 16,
+             "number of ALT landmarks precomputed by topo_creator, 0 to "
+             "disable");
+
+DEFINE_bool(enable_landmark_heuristic, false,
+            "use the landmark tables of the topo graph as A* heuristic when "
+            "they are available");
@@ -0,0 +1,70 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/routing/core/batch_navigator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace apollo {
+namespace routing {
+
+BatchNavigator::BatchNavigator(const Navigator* navigator, size_t thread_num)
+    : navigator_(navigator), thread_num_(thread_num) {
+  if (thread_num_ == 0) {
+    thread_num_ = std::max(1u, std::thread::hardware_concurrency());
+  }
+}
+
+size_t BatchNavigator::SearchRoutes(
+    const std::vector<routing::RoutingRequest>& requests,
+    std::vector<routing::RoutingResponse>* const responses) const {
+  responses->clear();
+  responses->resize(requests.size());
+  if (requests.empty() || navigator_ == nullptr || !navigator_->IsReady()) {
+    return 0;
+  }
+
+  // requests are handed out one by one, so long and short queries are
+  // balanced over the workers
+  std::atomic<size_t> next_index(0);
+  std::atomic<size_t> success_num(0);
+  auto worker = [&]() {
+    size_t index = next_index.fetch_add(1);
+    while (index < requests.size()) {
+      if (navigator_->SearchRoute(requests[index], &responses->at(index))) {
+        success_num.fetch_add(1);
+      }
+      index = next_index.fetch_add(1);
+    }
+  };
+
+  const size_t worker_num = std::min(thread_num_, requests.size());
+  std::vector<std::thread> workers;
+  workers.reserve(worker_num - 1);
+  for (size_t i = 1; i < worker_num; ++i) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : workers) {
+    thread.join();
+  }
+  return success_num.load();
+}
+
+}  // namespace routing
+}  // namespace apollo
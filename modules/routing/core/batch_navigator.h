@@ -0,0 +1,50 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "modules/common_msgs/routing_msgs/routing.pb.h"
+#include "modules/routing/core/navigator.h"
+
+namespace apollo {
+namespace routing {
+
+// Answers many routing requests against the topo graph of one navigator.
+// The graph is shared read-only by all worker threads, every worker keeps
+// its own search state for the whole batch.
+class BatchNavigator {
+ public:
+  // thread_num 0 means one worker per hardware thread.
+  BatchNavigator(const Navigator* navigator, size_t thread_num);
+  ~BatchNavigator() = default;
+
+  size_t ThreadNum() const { return thread_num_; }
+
+  // responses->at(i) answers requests[i]. Returns the number of requests
+  // for which a route is found.
+  size_t SearchRoutes(const std::vector<routing::RoutingRequest>& requests,
+                      std::vector<routing::RoutingResponse>* const responses)
+      const;
+
+ private:
+  const Navigator* navigator_ = nullptr;
+  size_t thread_num_ = 1;
+};
+
+}  // namespace routing
+}  // namespace apollo
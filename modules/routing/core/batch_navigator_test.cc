@@ -0,0 +1,77 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/routing/core/batch_navigator.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "cyber/common/file.h"
+#include "modules/routing/graph/topo_test_utils.h"
+
+namespace apollo {
+namespace routing {
+
+namespace {
+
+const char kTopoFile[] = "/tmp/batch_navigator_test_graph.bin";
+
+RoutingRequest GetRequest(const std::string& from, const std::string& to) {
+  RoutingRequest request;
+  auto* start = request.add_waypoint();
+  start->set_id(from);
+  start->set_s(10.0);
+  auto* end = request.add_waypoint();
+  end->set_id(to);
+  end->set_s(90.0);
+  return request;
+}
+
+}  // namespace
+
+TEST(BatchNavigatorTest, same_as_single_search) {
+  Graph graph;
+  GetGraph3ForTest(&graph);
+  ASSERT_TRUE(cyber::common::SetProtoToBinaryFile(graph, kTopoFile));
+  Navigator navigator(kTopoFile);
+  ASSERT_TRUE(navigator.IsReady());
+
+  std::vector<RoutingRequest> requests;
+  for (int i = 0; i < 16; ++i) {
+    requests.push_back(GetRequest(TEST_L1, TEST_L5));
+    requests.push_back(GetRequest(TEST_L2, TEST_L6));
+    requests.push_back(GetRequest(TEST_L5, TEST_L1));
+  }
+
+  BatchNavigator batch_navigator(&navigator, 4);
+  std::vector<RoutingResponse> responses;
+  EXPECT_EQ(2 * requests.size() / 3,
+            batch_navigator.SearchRoutes(requests, &responses));
+  ASSERT_EQ(requests.size(), responses.size());
+
+  for (size_t i = 0; i < requests.size(); ++i) {
+    RoutingResponse response;
+    const bool success = navigator.SearchRoute(requests[i], &response);
+    EXPECT_EQ(success, responses[i].status().error_code() ==
+                           common::ErrorCode::OK);
+    EXPECT_EQ(response.road_size(), responses[i].road_size());
+    EXPECT_EQ(response.status().error_code(),
+              responses[i].status().error_code());
+  }
+}
+
+}  // namespace routing
+}  // namespace apollo
@@ -20,6 +20,7 @@
 #include "modules/routing/common/routing_gflags.h"
 #include "modules/routing/graph/sub_topo_graph.h"
 #include "modules/routing/strategy/a_star_strategy.h"
+#include "modules/routing/strategy/alt_strategy.h"
 
 namespace apollo {
 namespace routing {
@@ -83,6 +84,18 @@ void SetErrorCode(const common::ErrorCode& error_code_id,
   }
 }
 
+// The search state of a strategy is reused by every request handled on the
+// same thread, so the hash tables keep their buckets between searches.
+Strategy* GetThreadLocalStrategy(const TopoGraph* graph) {
+  thread_local AStarStrategy a_star_strategy(
+      FLAGS_enable_change_lane_in_result);
+  thread_local ALTStrategy alt_strategy(FLAGS_enable_change_lane_in_result);
+  if (FLAGS_enable_landmark_heuristic && graph->HasLandmarks()) {
+    return &alt_strategy;
+  }
+  return &a_star_strategy;
+}
+
 void PrintDebugData(const std::vector<NodeWithRange>& nodes) {
   AINFO << "Route lane id\tis virtual\tstart s\tend s";
   for (const auto& node : nodes) {
@@ -117,19 +130,18 @@ Navigator::~Navigator() {}
 
 bool Navigator::IsReady() const { return is_ready_; }
 
-void Navigator::Clear() { topo_range_manager_.Clear(); }
-
 bool Navigator::Init(const routing::RoutingRequest& request,
                      const TopoGraph* graph,
                      std::vector<const TopoNode*>* const way_nodes,
-                     std::vector<double>* const way_s) {
-  Clear();
-  if (!GetWayNodes(request, graph_.get(), way_nodes, way_s)) {
+                     std::vector<double>* const way_s,
+                     TopoRangeManager* const range_manager) const {
+  range_manager->Clear();
+  if (!GetWayNodes(request, graph, way_nodes, way_s)) {
     AERROR << "Failed to find search terminal point in graph!";
     return false;
   }
-  black_list_generator_->GenerateBlackMapFromRequest(request, graph_.get(),
-                                                     &topo_range_manager_);
+  black_list_generator_->GenerateBlackMapFromRequest(request, graph,
+                                                     range_manager);
   return true;
 }
 
@@ -153,10 +165,9 @@ bool Navigator::MergeRoute(
 
 bool Navigator::SearchRouteByStrategy(
     const TopoGraph* graph, const std::vector<const TopoNode*>& way_nodes,
-    const std::vector<double>& way_s,
+    const std::vector<double>& way_s, const TopoRangeManager& range_manager,
     std::vector<NodeWithRange>* const result_nodes) const {
-  std::unique_ptr<Strategy> strategy_ptr;
-  strategy_ptr.reset(new AStarStrategy(FLAGS_enable_change_lane_in_result));
+  Strategy* strategy_ptr = GetThreadLocalStrategy(graph);
 
   result_nodes->clear();
   std::vector<NodeWithRange> node_vec;
@@ -166,7 +177,7 @@ bool Navigator::SearchRouteByStrategy(
     double way_start_s = way_s[i - 1];
     double way_end_s = way_s[i];
 
-    TopoRangeManager full_range_manager = topo_range_manager_;
+    TopoRangeManager full_range_manager = range_manager;
     black_list_generator_->AddBlackMapFromTerminal(
         way_start, way_end, way_start_s, way_end_s, &full_range_manager);
 
@@ -204,7 +215,7 @@ bool Navigator::SearchRouteByStrategy(
 }
 
 bool Navigator::SearchRoute(const routing::RoutingRequest& request,
-                            routing::RoutingResponse* const response) {
+                            routing::RoutingResponse* const response) const {
   if (!ShowRequestInfo(request, graph_.get())) {
     SetErrorCode(ErrorCode::ROUTING_ERROR_REQUEST,
                  "Error encountered when reading request point!",
@@ -219,14 +230,16 @@ bool Navigator::SearchRoute(const routing::RoutingRequest& request,
   }
   std::vector<const TopoNode*> way_nodes;
   std::vector<double> way_s;
-  if (!Init(request, graph_.get(), &way_nodes, &way_s)) {
+  TopoRangeManager range_manager;
+  if (!Init(request, graph_.get(), &way_nodes, &way_s, &range_manager)) {
     SetErrorCode(ErrorCode::ROUTING_ERROR_NOT_READY,
                  "Failed to initialize navigator!", response->mutable_status());
     return false;
   }
 
   std::vector<NodeWithRange> result_nodes;
-  if (!SearchRouteByStrategy(graph_.get(), way_nodes, way_s, &result_nodes)) {
+  if (!SearchRouteByStrategy(graph_.get(), way_nodes, way_s, range_manager,
+                             &result_nodes)) {
     SetErrorCode(ErrorCode::ROUTING_ERROR_RESPONSE,
                  "Failed to find route with request!",
                  response->mutable_status());
@@ -241,7 +254,7 @@ bool Navigator::SearchRoute(const routing::RoutingRequest& request,
   result_nodes.back().SetEndS(request.waypoint().rbegin()->s());
 
   if (!result_generator_->GeneratePassageRegion(
-          graph_->MapVersion(), request, result_nodes, topo_range_manager_,
+          graph_->MapVersion(), request, result_nodes, range_manager,
           response)) {
     SetErrorCode(ErrorCode::ROUTING_ERROR_RESPONSE,
                  "Failed to generate passage regions based on result lanes",
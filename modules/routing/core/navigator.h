@@ -33,19 +33,22 @@ class Navigator {
 
   bool IsReady() const;
 
+  // The topo graph is only read during the search and all per-request state
+  // lives on the stack or in thread local storage, so this may be called
+  // from several threads at the same time.
   bool SearchRoute(const routing::RoutingRequest& request,
-                   routing::RoutingResponse* const response);
+                   routing::RoutingResponse* const response) const;
 
  private:
   bool Init(const routing::RoutingRequest& request, const TopoGraph* graph,
             std::vector<const TopoNode*>* const way_nodes,
-            std::vector<double>* const way_s);
-
-  void Clear();
+            std::vector<double>* const way_s,
+            TopoRangeManager* const range_manager) const;
 
   bool SearchRouteByStrategy(
       const TopoGraph* graph, const std::vector<const TopoNode*>& way_nodes,
       const std::vector<double>& way_s,
+      const TopoRangeManager& range_manager,
       std::vector<NodeWithRange>* const result_nodes) const;
 
   bool MergeRoute(const std::vector<NodeWithRange>& node_vec,
@@ -55,8 +58,6 @@ class Navigator {
   bool is_ready_ = false;
   std::unique_ptr<TopoGraph> graph_;
 
-  TopoRangeManager topo_range_manager_;
-
   std::unique_ptr<BlackListRangeGenerator> black_list_generator_;
   std::unique_ptr<ResultGenerator> result_generator_;
 };
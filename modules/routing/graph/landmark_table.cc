@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/routing/graph/landmark_table.h"
+
+#include <algorithm>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace routing {
+
+void LandmarkTable::Clear() {
+  landmark_num_ = 0;
+  node_num_ = 0;
+  forward_cost_.clear();
+  backward_cost_.clear();
+}
+
+bool LandmarkTable::Load(const Graph& graph) {
+  Clear();
+  const int node_num = graph.node_size();
+  for (const auto& landmark : graph.landmark()) {
+    if (landmark.forward_cost_size() != node_num ||
+        landmark.backward_cost_size() != node_num) {
+      AERROR << "Landmark " << landmark.lane_id()
+             << " does not match the nodes of topology graph.";
+      return false;
+    }
+  }
+  landmark_num_ = graph.landmark_size();
+  node_num_ = node_num;
+  forward_cost_.resize(static_cast<size_t>(landmark_num_) * node_num_);
+  backward_cost_.resize(static_cast<size_t>(landmark_num_) * node_num_);
+  for (int i = 0; i < landmark_num_; ++i) {
+    const auto& landmark = graph.landmark(i);
+    for (int j = 0; j < node_num_; ++j) {
+      forward_cost_[j * landmark_num_ + i] = landmark.forward_cost(j);
+      backward_cost_[j * landmark_num_ + i] = landmark.backward_cost(j);
+    }
+  }
+  AINFO << "Load " << landmark_num_ << " landmarks for " << node_num_
+        << " nodes.";
+  return true;
+}
+
+double LandmarkTable::LowerBound(int from_index, int to_index) const {
+  if (from_index < 0 || to_index < 0 || from_index >= node_num_ ||
+      to_index >= node_num_) {
+    return 0.0;
+  }
+  const float* from_forward = &forward_cost_[from_index * landmark_num_];
+  const float* to_forward = &forward_cost_[to_index * landmark_num_];
+  const float* from_backward = &backward_cost_[from_index * landmark_num_];
+  const float* to_backward = &backward_cost_[to_index * landmark_num_];
+  float bound = 0.0f;
+  for (int i = 0; i < landmark_num_; ++i) {
+    // d(L, to) - d(L, from) <= d(from, to)
+    if (from_forward[i] >= 0.0f && to_forward[i] >= 0.0f) {
+      bound = std::max(bound, to_forward[i] - from_forward[i]);
+    }
+    // d(from, L) - d(to, L) <= d(from, to)
+    if (from_backward[i] >= 0.0f && to_backward[i] >= 0.0f) {
+      bound = std::max(bound, from_backward[i] - to_backward[i]);
+    }
+  }
+  return bound;
+}
+
+}  // namespace routing
+}  // namespace apollo
@@ -0,0 +1,51 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "modules/routing/proto/topo_graph.pb.h"
+
+namespace apollo {
+namespace routing {
+
+// Landmark cost tables of a topo graph, laid out node by node so that all
+// landmarks of one node are contiguous in memory.
+class LandmarkTable {
+ public:
+  LandmarkTable() = default;
+  ~LandmarkTable() = default;
+
+  bool Load(const Graph& graph);
+  void Clear();
+
+  bool IsEmpty() const { return landmark_num_ == 0; }
+  int LandmarkNum() const { return landmark_num_; }
+
+  // Lower bound of the cost from the node at from_index to the node at
+  // to_index, derived from the triangle inequality over all landmarks.
+  double LowerBound(int from_index, int to_index) const;
+
+ private:
+  int landmark_num_ = 0;
+  int node_num_ = 0;
+  std::vector<float> forward_cost_;
+  std::vector<float> backward_cost_;
+};
+
+}  // namespace routing
+}  // namespace apollo
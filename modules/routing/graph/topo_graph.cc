@@ -25,6 +25,8 @@ void TopoGraph::Clear() {
   topo_nodes_.clear();
   topo_edges_.clear();
   node_index_map_.clear();
+  node_ptr_index_map_.clear();
+  landmark_table_.Clear();
 }
 
 bool TopoGraph::LoadNodes(const Graph& graph) {
@@ -36,6 +38,8 @@ bool TopoGraph::LoadNodes(const Graph& graph) {
     node_index_map_[node.lane_id()] = static_cast<int>(topo_nodes_.size());
     std::shared_ptr<TopoNode> topo_node;
     topo_node.reset(new TopoNode(node));
+    node_ptr_index_map_[topo_node.get()] =
+        static_cast<int>(topo_nodes_.size());
     road_node_map_[node.road_id()].insert(topo_node.get());
     topo_nodes_.push_back(std::move(topo_node));
   }
@@ -80,6 +84,11 @@ bool TopoGraph::LoadGraph(const Graph& graph) {
     AERROR << "Failed to load edges from topology graph.";
     return false;
   }
+  if (!landmark_table_.Load(graph)) {
+    AWARN << "Failed to load landmarks from topology graph, landmark "
+             "heuristic is disabled.";
+    landmark_table_.Clear();
+  }
   AINFO << "Load Topo data successful.";
   return true;
 }
@@ -105,5 +114,18 @@ void TopoGraph::GetNodesByRoadId(
   }
 }
 
+bool TopoGraph::HasLandmarks() const { return !landmark_table_.IsEmpty(); }
+
+double TopoGraph::LandmarkLowerBound(const TopoNode* from_node,
+                                     const TopoNode* to_node) const {
+  const auto from_iter = node_ptr_index_map_.find(from_node->OriginNode());
+  const auto to_iter = node_ptr_index_map_.find(to_node->OriginNode());
+  if (from_iter == node_ptr_index_map_.end() ||
+      to_iter == node_ptr_index_map_.end()) {
+    return 0.0;
+  }
+  return landmark_table_.LowerBound(from_iter->second, to_iter->second);
+}
+
 }  // namespace routing
 }  // namespace apollo
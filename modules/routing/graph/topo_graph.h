@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "cyber/common/log.h"
+#include "modules/routing/graph/landmark_table.h"
 #include "modules/routing/graph/topo_node.h"
 
 namespace apollo {
@@ -42,6 +43,12 @@ class TopoGraph {
       const std::string& road_id,
       std::unordered_set<const TopoNode*>* const node_in_road) const;
 
+  bool HasLandmarks() const;
+  // Lower bound of the search cost between the origin nodes of the given
+  // (sub) nodes, 0 if the graph carries no landmarks.
+  double LandmarkLowerBound(const TopoNode* from_node,
+                            const TopoNode* to_node) const;
+
  private:
   void Clear();
   bool LoadNodes(const Graph& graph);
@@ -53,6 +60,8 @@ class TopoGraph {
   std::vector<std::shared_ptr<TopoNode>> topo_nodes_;
   std::vector<std::shared_ptr<TopoEdge>> topo_edges_;
   std::unordered_map<std::string, int> node_index_map_;
+  std::unordered_map<const TopoNode*, int> node_ptr_index_map_;
+  LandmarkTable landmark_table_;
   std::unordered_map<std::string, std::unordered_set<const TopoNode*>>
       road_node_map_;
 };
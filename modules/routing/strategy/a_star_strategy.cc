@@ -324,6 +324,12 @@ bool AStarStrategy::Search(const TopoGraph* graph,
   return false;
 }
 
+bool AStarStrategy::ReconstructRoute(
+    const TopoNode* dest_node,
+    std::vector<NodeWithRange>* const result_nodes) const {
+  return Reconstruct(came_from_, dest_node, result_nodes);
+}
+
 double AStarStrategy::GetResidualS(const TopoNode* node) {
   double start_s = node->StartS();
   const auto iter = enter_s_.find(node);
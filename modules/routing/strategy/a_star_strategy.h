@@ -34,13 +34,15 @@ class AStarStrategy : public Strategy {
                       const TopoNode* src_node, const TopoNode* dest_node,
                       std::vector<NodeWithRange>* const result_nodes);
 
- private:
+ protected:
   void Clear();
   double HeuristicCost(const TopoNode* src_node, const TopoNode* dest_node);
   double GetResidualS(const TopoNode* node);
   double GetResidualS(const TopoEdge* edge, const TopoNode* to_node);
+  bool ReconstructRoute(const TopoNode* dest_node,
+                        std::vector<NodeWithRange>* const result_nodes) const;
 
- private:
+ protected:
   bool change_lane_enabled_;
   std::unordered_set<const TopoNode*> open_set_;
   std::unordered_set<const TopoNode*> closed_set_;
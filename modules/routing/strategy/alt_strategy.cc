@@ -0,0 +1,138 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/routing/strategy/alt_strategy.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <unordered_set>
+#include <utility>
+
+#include "modules/routing/common/routing_gflags.h"
+
+namespace apollo {
+namespace routing {
+namespace {
+
+using QueueItem = std::pair<double, const TopoNode*>;
+
+struct QueueItemGreater {
+  bool operator()(const QueueItem& lhs, const QueueItem& rhs) const {
+    return lhs.first > rhs.first;
+  }
+};
+
+double GetCostToNeighbor(const TopoEdge* edge) {
+  double cost = edge->Cost() + edge->ToNode()->Cost();
+  if (edge->Type() != TopoEdgeType::TET_FORWARD) {
+    cost -= (edge->FromNode()->Cost() + edge->ToNode()->Cost()) / 2;
+  }
+  return cost;
+}
+
+}  // namespace
+
+ALTStrategy::ALTStrategy(bool enable_change) : AStarStrategy(enable_change) {}
+
+bool ALTStrategy::Search(const TopoGraph* graph,
+                         const SubTopoGraph* sub_graph,
+                         const TopoNode* src_node, const TopoNode* dest_node,
+                         std::vector<NodeWithRange>* const result_nodes) {
+  Clear();
+  AINFO << "Start ALT search algorithm.";
+
+  std::priority_queue<QueueItem, std::vector<QueueItem>, QueueItemGreater>
+      open_queue;
+  open_queue.emplace(graph->LandmarkLowerBound(src_node, dest_node),
+                     src_node);
+  g_score_[src_node] = 0.0;
+  enter_s_[src_node] = src_node->StartS();
+
+  std::unordered_set<const TopoEdge*> next_edge_set;
+  std::unordered_set<const TopoEdge*> sub_edge_set;
+  while (!open_queue.empty()) {
+    const auto* from_node = open_queue.top().second;
+    open_queue.pop();
+    if (from_node == dest_node) {
+      if (!ReconstructRoute(from_node, result_nodes)) {
+        AERROR << "Failed to reconstruct route.";
+        return false;
+      }
+      return true;
+    }
+    if (!closed_set_.insert(from_node).second) {
+      continue;
+    }
+
+    // if residual_s is less than FLAGS_min_length_for_lane_change, only move
+    // forward
+    const auto& neighbor_edges =
+        (GetResidualS(from_node) > FLAGS_min_length_for_lane_change &&
+         change_lane_enabled_)
+            ? from_node->OutToAllEdge()
+            : from_node->OutToSucEdge();
+    next_edge_set.clear();
+    for (const auto* edge : neighbor_edges) {
+      sub_edge_set.clear();
+      sub_graph->GetSubInEdgesIntoSubGraph(edge, &sub_edge_set);
+      next_edge_set.insert(sub_edge_set.begin(), sub_edge_set.end());
+    }
+
+    const double from_g_score = g_score_[from_node];
+    for (const auto* edge : next_edge_set) {
+      const auto* to_node = edge->ToNode();
+      if (closed_set_.count(to_node) != 0) {
+        continue;
+      }
+      if (GetResidualS(edge, to_node) < FLAGS_min_length_for_lane_change) {
+        continue;
+      }
+      const double tentative_g_score = from_g_score + GetCostToNeighbor(edge);
+      const auto g_iter = g_score_.find(to_node);
+      if (g_iter != g_score_.end() && tentative_g_score >= g_iter->second) {
+        continue;
+      }
+      // if to_node is reached by forward, reset enter_s to start_s
+      if (edge->Type() == TopoEdgeType::TET_FORWARD) {
+        enter_s_[to_node] = to_node->StartS();
+      } else {
+        // else, add enter_s with FLAGS_min_length_for_lane_change
+        double to_node_enter_s =
+            (enter_s_[from_node] + FLAGS_min_length_for_lane_change) /
+            from_node->Length() * to_node->Length();
+        // enter s could be larger than end_s but should be less than length
+        to_node_enter_s = std::min(to_node_enter_s, to_node->Length());
+        // if enter_s is larger than end_s and to_node is dest_node
+        if (to_node_enter_s > to_node->EndS() && to_node == dest_node) {
+          continue;
+        }
+        enter_s_[to_node] = to_node_enter_s;
+      }
+
+      g_score_[to_node] = tentative_g_score;
+      came_from_[to_node] = from_node;
+      open_queue.emplace(
+          tentative_g_score + graph->LandmarkLowerBound(to_node, dest_node),
+          to_node);
+    }
+  }
+  AERROR << "Failed to find goal lane with id: " << dest_node->LaneId();
+  return false;
+}
+
+}  // namespace routing
+}  // namespace apollo
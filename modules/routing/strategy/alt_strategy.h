@@ -0,0 +1,43 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "modules/routing/graph/sub_topo_graph.h"
+#include "modules/routing/graph/topo_graph.h"
+#include "modules/routing/strategy/a_star_strategy.h"
+
+namespace apollo {
+namespace routing {
+
+// A* search guided by the landmark tables precomputed by topo_creator. The
+// landmark costs are computed on the full topo graph, black list ranges only
+// remove nodes and edges from it, so the heuristic stays a lower bound on
+// the sub graph as well.
+class ALTStrategy : public AStarStrategy {
+ public:
+  explicit ALTStrategy(bool enable_change);
+  ~ALTStrategy() = default;
+
+  bool Search(const TopoGraph* graph, const SubTopoGraph* sub_graph,
+              const TopoNode* src_node, const TopoNode* dest_node,
+              std::vector<NodeWithRange>* const result_nodes) override;
+};
+
+}  // namespace routing
+}  // namespace apollo
@@ -0,0 +1,187 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Query latency of plain A* against ALT on a synthetic city grid.
+// Every block of the grid is a pair of parallel lanes in each direction, so
+// the search has to deal with lane changes as on a real map.
+
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "modules/routing/graph/sub_topo_graph.h"
+#include "modules/routing/graph/topo_graph.h"
+#include "modules/routing/strategy/alt_strategy.h"
+#include "modules/routing/topo_creator/landmark_creator.h"
+
+namespace apollo {
+namespace routing {
+namespace {
+
+constexpr double kBlockLength = 100.0;
+constexpr double kChangeCost = 500.0;
+constexpr int kQueryNum = 64;
+
+std::string LaneId(int row, int col, int dir, int lane) {
+  return std::to_string(row) + "_" + std::to_string(col) + "_" +
+         std::to_string(dir) + "_" + std::to_string(lane);
+}
+
+void AddNode(const std::string& lane_id, double x, double y, double cost,
+             Graph* graph) {
+  auto* node = graph->add_node();
+  node->set_lane_id(lane_id);
+  node->set_length(kBlockLength);
+  node->set_cost(cost);
+  node->set_road_id(lane_id.substr(0, lane_id.rfind('_')));
+  auto* segment = node->mutable_central_curve()->add_segment();
+  auto* point = segment->mutable_line_segment()->add_point();
+  point->set_x(x);
+  point->set_y(y);
+  for (auto* range : {node->add_left_out(), node->add_right_out()}) {
+    range->mutable_start()->set_s(0.0);
+    range->mutable_end()->set_s(kBlockLength);
+  }
+}
+
+void AddEdge(const std::string& from, const std::string& to,
+             Edge::DirectionType type, Graph* graph) {
+  auto* edge = graph->add_edge();
+  edge->set_from_lane_id(from);
+  edge->set_to_lane_id(to);
+  edge->set_direction_type(type);
+  edge->set_cost(type == Edge::FORWARD ? 0.0 : kChangeCost);
+}
+
+// dir: 0 east, 1 west, 2 north, 3 south
+void GetGridGraph(int size, Graph* graph) {
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<double> cost_dist(kBlockLength,
+                                                   3.0 * kBlockLength);
+  const int dx[] = {1, -1, 0, 0};
+  const int dy[] = {0, 0, 1, -1};
+  for (int row = 0; row < size; ++row) {
+    for (int col = 0; col < size; ++col) {
+      for (int dir = 0; dir < 4; ++dir) {
+        const int next_row = row + dy[dir];
+        const int next_col = col + dx[dir];
+        if (next_row < 0 || next_row >= size || next_col < 0 ||
+            next_col >= size) {
+          continue;
+        }
+        const double cost = cost_dist(rng);
+        for (int lane = 0; lane < 2; ++lane) {
+          AddNode(LaneId(row, col, dir, lane), col * kBlockLength,
+                  row * kBlockLength, cost, graph);
+        }
+      }
+    }
+  }
+  std::unordered_set<std::string> exists;
+  for (const auto& node : graph->node()) {
+    exists.insert(node.lane_id());
+  }
+  for (int row = 0; row < size; ++row) {
+    for (int col = 0; col < size; ++col) {
+      for (int dir = 0; dir < 4; ++dir) {
+        if (!exists.count(LaneId(row, col, dir, 0))) {
+          continue;
+        }
+        AddEdge(LaneId(row, col, dir, 0), LaneId(row, col, dir, 1),
+                Edge::RIGHT, graph);
+        AddEdge(LaneId(row, col, dir, 1), LaneId(row, col, dir, 0),
+                Edge::LEFT, graph);
+        const int next_row = row + dy[dir];
+        const int next_col = col + dx[dir];
+        for (int next_dir = 0; next_dir < 4; ++next_dir) {
+          // no u-turn at junctions
+          if ((dir ^ next_dir) == 1) {
+            continue;
+          }
+          for (int lane = 0; lane < 2; ++lane) {
+            const auto to = LaneId(next_row, next_col, next_dir, lane);
+            if (exists.count(to)) {
+              AddEdge(LaneId(row, col, dir, lane), to, Edge::FORWARD, graph);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+class GridFixture {
+ public:
+  static GridFixture* Instance() {
+    static GridFixture* instance = new GridFixture();
+    return instance;
+  }
+
+  const TopoGraph& graph() const { return graph_; }
+  const std::vector<std::pair<const TopoNode*, const TopoNode*>>& queries()
+      const {
+    return queries_;
+  }
+
+ private:
+  GridFixture() {
+    Graph graph;
+    GetGridGraph(60, &graph);
+    landmark_creator::GetPbLandmarks(16, &graph);
+    graph_.LoadGraph(graph);
+
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> node_dist(0, graph.node_size() - 1);
+    for (int i = 0; i < kQueryNum; ++i) {
+      queries_.emplace_back(
+          graph_.GetNode(graph.node(node_dist(rng)).lane_id()),
+          graph_.GetNode(graph.node(node_dist(rng)).lane_id()));
+    }
+  }
+
+  TopoGraph graph_;
+  std::vector<std::pair<const TopoNode*, const TopoNode*>> queries_;
+};
+
+template <typename StrategyType>
+void BM_Search(benchmark::State& state) {  // NOLINT
+  const auto* fixture = GridFixture::Instance();
+  const std::unordered_map<const TopoNode*, std::vector<NodeSRange>> black_map;
+  const SubTopoGraph sub_graph(black_map);
+  StrategyType strategy(true);
+  std::vector<NodeWithRange> result;
+  size_t index = 0;
+  for (auto _ : state) {
+    const auto& query = fixture->queries()[index++ % kQueryNum];
+    benchmark::DoNotOptimize(strategy.Search(
+        &fixture->graph(), &sub_graph, query.first, query.second, &result));
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_Search, AStarStrategy)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Search, ALTStrategy)->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace routing
+}  // namespace apollo
+
+BENCHMARK_MAIN();
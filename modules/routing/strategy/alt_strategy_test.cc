@@ -0,0 +1,119 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/routing/strategy/alt_strategy.h"
+
+#include <algorithm>
+
+#include "gtest/gtest.h"
+#include "modules/routing/graph/sub_topo_graph.h"
+#include "modules/routing/graph/topo_graph.h"
+#include "modules/routing/graph/topo_test_utils.h"
+#include "modules/routing/topo_creator/landmark_creator.h"
+
+namespace apollo {
+namespace routing {
+
+namespace {
+
+void GetTopoGraph(int landmark_num, TopoGraph* topo_graph) {
+  Graph graph;
+  GetGraph3ForTest(&graph);
+  landmark_creator::GetPbLandmarks(landmark_num, &graph);
+  ASSERT_EQ(std::min(landmark_num, graph.node_size()), graph.landmark_size());
+  ASSERT_TRUE(topo_graph->LoadGraph(graph));
+}
+
+}  // namespace
+
+TEST(ALTStrategyTestSuit, landmark_lower_bound) {
+  TopoGraph topo_graph;
+  GetTopoGraph(6, &topo_graph);
+  ASSERT_TRUE(topo_graph.HasLandmarks());
+
+  const TopoNode* node_1 = topo_graph.GetNode(TEST_L1);
+  const TopoNode* node_3 = topo_graph.GetNode(TEST_L3);
+  const TopoNode* node_5 = topo_graph.GetNode(TEST_L5);
+  ASSERT_TRUE(node_1 != nullptr);
+  ASSERT_TRUE(node_3 != nullptr);
+  ASSERT_TRUE(node_5 != nullptr);
+
+  // every node is a landmark, so the bounds are exact
+  const double forward_cost = TEST_EDGE_COST + TEST_LANE_COST;
+  EXPECT_NEAR(forward_cost, topo_graph.LandmarkLowerBound(node_1, node_3),
+              1e-4);
+  EXPECT_NEAR(2.0 * forward_cost,
+              topo_graph.LandmarkLowerBound(node_1, node_5), 1e-4);
+  EXPECT_DOUBLE_EQ(0.0, topo_graph.LandmarkLowerBound(node_1, node_1));
+}
+
+TEST(ALTStrategyTestSuit, negative_edge_cost) {
+  Graph graph;
+  GetGraph3ForTest(&graph);
+  graph.mutable_edge(0)->set_cost(-10.0);
+  landmark_creator::GetPbLandmarks(4, &graph);
+  EXPECT_EQ(0, graph.landmark_size());
+}
+
+TEST(ALTStrategyTestSuit, search_route) {
+  TopoGraph topo_graph;
+  GetTopoGraph(2, &topo_graph);
+
+  const TopoNode* node_1 = topo_graph.GetNode(TEST_L1);
+  const TopoNode* node_6 = topo_graph.GetNode(TEST_L6);
+  ASSERT_TRUE(node_1 != nullptr);
+  ASSERT_TRUE(node_6 != nullptr);
+
+  std::unordered_map<const TopoNode*, std::vector<NodeSRange>> black_map;
+  SubTopoGraph sub_graph(black_map);
+
+  std::vector<NodeWithRange> result;
+  ALTStrategy alt(true);
+  ASSERT_TRUE(alt.Search(&topo_graph, &sub_graph, node_1, node_6, &result));
+  ASSERT_LE(3, result.size());
+  EXPECT_EQ(node_1, result.front().GetTopoNode());
+  EXPECT_EQ(node_6, result.back().GetTopoNode());
+  for (size_t i = 1; i < result.size(); ++i) {
+    EXPECT_TRUE(result[i - 1].GetTopoNode()->GetOutEdgeTo(
+                    result[i].GetTopoNode()) != nullptr);
+  }
+}
+
+TEST(ALTStrategyTestSuit, search_with_black_list) {
+  TopoGraph topo_graph;
+  GetTopoGraph(2, &topo_graph);
+
+  const TopoNode* node_1 = topo_graph.GetNode(TEST_L1);
+  const TopoNode* node_3 = topo_graph.GetNode(TEST_L3);
+  const TopoNode* node_5 = topo_graph.GetNode(TEST_L5);
+  ASSERT_TRUE(node_1 != nullptr);
+  ASSERT_TRUE(node_3 != nullptr);
+  ASSERT_TRUE(node_5 != nullptr);
+
+  std::unordered_map<const TopoNode*, std::vector<NodeSRange>> black_map;
+  black_map[node_3].emplace_back(0.0, TEST_LANE_LENGTH);
+  SubTopoGraph sub_graph(black_map);
+
+  std::vector<NodeWithRange> result;
+  ALTStrategy alt(true);
+  ASSERT_TRUE(alt.Search(&topo_graph, &sub_graph, node_1, node_5, &result));
+  for (const auto& node : result) {
+    EXPECT_NE(node_3, node.GetTopoNode());
+  }
+}
+
+}  // namespace routing
+}  // namespace apollo
@@ -0,0 +1,106 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+// Offline batch routing: answers every RoutingRequest found in a directory
+// against the routing map and reports the throughput. Waypoints must carry
+// lane id and s, as the online component fills them from the hdmap.
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cyber/common/file.h"
+#include "modules/map/hdmap/hdmap_util.h"
+#include "modules/routing/common/routing_gflags.h"
+#include "modules/routing/core/batch_navigator.h"
+
+DEFINE_string(routing_batch_request_dir, "",
+              "directory of RoutingRequest files (*.pb.txt or *.bin)");
+DEFINE_string(routing_batch_response_dir, "",
+              "directory to dump RoutingResponse files, empty to skip");
+DEFINE_uint32(routing_batch_thread_num, 0,
+              "number of worker threads, 0 for one per hardware thread");
+DEFINE_uint32(routing_batch_repeat, 1,
+              "number of times the request set is searched");
+
+using apollo::routing::BatchNavigator;
+using apollo::routing::Navigator;
+using apollo::routing::RoutingRequest;
+using apollo::routing::RoutingResponse;
+
+int main(int argc, char* argv[]) {
+  google::InitGoogleLogging(argv[0]);
+  google::ParseCommandLineFlags(&argc, &argv, true);
+
+  std::vector<RoutingRequest> requests;
+  for (const auto& pattern : {"/*.pb.txt", "/*.bin"}) {
+    for (const auto& file :
+         apollo::cyber::common::Glob(FLAGS_routing_batch_request_dir +
+                                     pattern)) {
+      RoutingRequest request;
+      if (!apollo::cyber::common::GetProtoFromFile(file, &request)) {
+        AERROR << "Failed to load routing request from " << file;
+        continue;
+      }
+      requests.push_back(std::move(request));
+    }
+  }
+  if (requests.empty()) {
+    AERROR << "No routing request found in " << FLAGS_routing_batch_request_dir;
+    return -1;
+  }
+  const size_t unique_request_num = requests.size();
+  requests.reserve(unique_request_num *
+                   std::max<uint32_t>(FLAGS_routing_batch_repeat, 1));
+  for (uint32_t i = 1; i < FLAGS_routing_batch_repeat; ++i) {
+    for (size_t j = 0; j < unique_request_num; ++j) {
+      requests.push_back(requests[j]);
+    }
+  }
+
+  const auto routing_map = apollo::hdmap::RoutingMapFile();
+  const Navigator navigator(routing_map);
+  ACHECK(navigator.IsReady()) << "Failed to load routing map " << routing_map;
+  const BatchNavigator batch_navigator(&navigator,
+                                       FLAGS_routing_batch_thread_num);
+
+  std::vector<RoutingResponse> responses;
+  const auto start_time = std::chrono::steady_clock::now();
+  const size_t success_num = batch_navigator.SearchRoutes(requests, &responses);
+  const double elapsed_s = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start_time)
+                               .count();
+
+  AINFO << "Searched " << requests.size() << " requests ("
+        << success_num << " succeeded) with "
+        << batch_navigator.ThreadNum() << " threads in " << elapsed_s
+        << " s, " << static_cast<double>(requests.size()) / elapsed_s
+        << " routes/s";
+
+  if (!FLAGS_routing_batch_response_dir.empty()) {
+    apollo::cyber::common::EnsureDirectory(FLAGS_routing_batch_response_dir);
+    for (size_t i = 0; i < unique_request_num; ++i) {
+      const std::string file = FLAGS_routing_batch_response_dir + "/" +
+                               std::to_string(i) + ".pb.txt";
+      if (!apollo::cyber::common::SetProtoToASCIIFile(responses[i], file)) {
+        AERROR << "Failed to dump routing response to " << file;
+      }
+    }
+  }
+  return 0;
+}
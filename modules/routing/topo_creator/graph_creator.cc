@@ -25,6 +25,7 @@
 #include "modules/map/hdmap/adapter/opendrive_adapter.h"
 #include "modules/routing/common/routing_gflags.h"
 #include "modules/routing/topo_creator/edge_creator.h"
+#include "modules/routing/topo_creator/landmark_creator.h"
 #include "modules/routing/topo_creator/node_creator.h"
 
 namespace apollo {
@@ -141,6 +142,8 @@ bool GraphCreator::Create() {
     }
   }
 
+  landmark_creator::GetPbLandmarks(FLAGS_routing_landmark_num, &graph_);
+
   if (!absl::EndsWith(dump_topo_file_path_, ".bin") &&
       !absl::EndsWith(dump_topo_file_path_, ".txt")) {
     AERROR << "Failed to dump topo data into file, incorrect file type "
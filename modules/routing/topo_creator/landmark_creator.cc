@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/routing/topo_creator/landmark_creator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace routing {
+namespace landmark_creator {
+
+namespace {
+
+constexpr double kInfCost = std::numeric_limits<double>::infinity();
+
+struct AdjEdge {
+  int to = -1;
+  double cost = 0.0;
+};
+
+using AdjList = std::vector<std::vector<AdjEdge>>;
+
+double GetEdgeWeight(const Edge& edge, const Node& from_node,
+                     const Node& to_node) {
+  double cost = edge.cost() + to_node.cost();
+  if (edge.direction_type() != Edge::FORWARD) {
+    cost -= (from_node.cost() + to_node.cost()) / 2.0;
+  }
+  return cost;
+}
+
+// Returns false on a negative edge cost, with which the landmark costs are
+// not lower bounds any more.
+bool BuildAdjList(const Graph& graph, AdjList* const forward_adj,
+                  AdjList* const backward_adj) {
+  std::unordered_map<std::string, int> node_index_map;
+  for (int i = 0; i < graph.node_size(); ++i) {
+    node_index_map[graph.node(i).lane_id()] = i;
+  }
+  forward_adj->assign(graph.node_size(), std::vector<AdjEdge>());
+  backward_adj->assign(graph.node_size(), std::vector<AdjEdge>());
+  for (const auto& edge : graph.edge()) {
+    const auto from_iter = node_index_map.find(edge.from_lane_id());
+    const auto to_iter = node_index_map.find(edge.to_lane_id());
+    if (from_iter == node_index_map.end() || to_iter == node_index_map.end()) {
+      continue;
+    }
+    const int from = from_iter->second;
+    const int to = to_iter->second;
+    const double cost =
+        GetEdgeWeight(edge, graph.node(from), graph.node(to));
+    if (cost < 0.0) {
+      AERROR << "Negative cost " << cost << " of edge from "
+             << edge.from_lane_id() << " to " << edge.to_lane_id();
+      return false;
+    }
+    (*forward_adj)[from].push_back({to, cost});
+    (*backward_adj)[to].push_back({from, cost});
+  }
+  return true;
+}
+
+void Dijkstra(const AdjList& adj, int source, std::vector<double>* const dist) {
+  using QueueItem = std::pair<double, int>;
+  dist->assign(adj.size(), kInfCost);
+  std::priority_queue<QueueItem, std::vector<QueueItem>,
+                      std::greater<QueueItem>>
+      open_queue;
+  (*dist)[source] = 0.0;
+  open_queue.emplace(0.0, source);
+  while (!open_queue.empty()) {
+    const auto top = open_queue.top();
+    open_queue.pop();
+    if (top.first > (*dist)[top.second]) {
+      continue;
+    }
+    for (const auto& edge : adj[top.second]) {
+      const double cost = top.first + edge.cost;
+      if (cost < (*dist)[edge.to]) {
+        (*dist)[edge.to] = cost;
+        open_queue.emplace(cost, edge.to);
+      }
+    }
+  }
+}
+
+void FillCost(const std::vector<double>& dist,
+              ::google::protobuf::RepeatedField<float>* const cost) {
+  cost->Reserve(static_cast<int>(dist.size()));
+  for (const double d : dist) {
+    cost->Add(std::isinf(d) ? -1.0f : static_cast<float>(d));
+  }
+}
+
+}  // namespace
+
+void GetPbLandmarks(int landmark_num, Graph* graph) {
+  graph->clear_landmark();
+  const int node_num = graph->node_size();
+  if (landmark_num <= 0 || node_num == 0) {
+    return;
+  }
+  AdjList forward_adj;
+  AdjList backward_adj;
+  if (!BuildAdjList(*graph, &forward_adj, &backward_adj)) {
+    AERROR << "Skip the landmarks, the heuristic would not be admissible";
+    return;
+  }
+
+  // Farthest point selection: every new landmark is the node with the largest
+  // cost to its closest landmark. Unreachable nodes are preferred so that
+  // disconnected components get a landmark as well.
+  std::vector<double> min_cost(node_num, kInfCost);
+  std::vector<double> forward_dist;
+  std::vector<double> backward_dist;
+  int landmark = 0;
+  for (int i = 0; i < landmark_num && i < node_num; ++i) {
+    Dijkstra(forward_adj, landmark, &forward_dist);
+    Dijkstra(backward_adj, landmark, &backward_dist);
+
+    auto* pb_landmark = graph->add_landmark();
+    pb_landmark->set_lane_id(graph->node(landmark).lane_id());
+    FillCost(forward_dist, pb_landmark->mutable_forward_cost());
+    FillCost(backward_dist, pb_landmark->mutable_backward_cost());
+
+    int next_landmark = -1;
+    double max_cost = -1.0;
+    for (int j = 0; j < node_num; ++j) {
+      min_cost[j] = std::min(
+          min_cost[j], std::min(forward_dist[j], backward_dist[j]));
+      if (min_cost[j] > max_cost && min_cost[j] > 0.0) {
+        max_cost = min_cost[j];
+        next_landmark = j;
+      }
+    }
+    if (next_landmark < 0) {
+      break;
+    }
+    landmark = next_landmark;
+  }
+  AINFO << "Number of landmarks: " << graph->landmark_size();
+}
+
+}  // namespace landmark_creator
+}  // namespace routing
+}  // namespace apollo
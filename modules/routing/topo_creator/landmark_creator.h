@@ -0,0 +1,34 @@
+/******************************************************************************
+ * Copyright 2024 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include "modules/routing/proto/topo_graph.pb.h"
+
+namespace apollo {
+namespace routing {
+namespace landmark_creator {
+
+// Selects up to landmark_num landmarks with farthest-point selection and
+// fills graph->landmark with the shortest path costs from and to each of
+// them. The edge weight matches the one used by the routing search: edge
+// cost plus cost of the to-node, lane changes being credited with half of
+// the cost of both nodes.
+void GetPbLandmarks(int landmark_num, Graph* graph);
+
+}  // namespace landmark_creator
+}  // namespace routing
+}  // namespace apollo
@@ -28,6 +28,7 @@ import yaml
 from modules.tools.gen_vehicle_protocol.gen_canbus_conf import gen_canbus_conf
 from modules.tools.gen_vehicle_protocol.gen_proto_file import gen_proto_file
 from modules.tools.gen_vehicle_protocol.gen_protocols import gen_protocols
+from modules.tools.gen_vehicle_protocol.gen_signal_tables import gen_signal_tables
 from modules.tools.gen_vehicle_protocol.gen_vehicle_controller_and_manager import gen_vehicle_controller_and_manager
 from modules.tools.gen_vehicle_protocol.extract_dbc_meta import extract_dbc_meta
 
@@ -57,6 +58,7 @@ def gen(conf):
         print("use demo dbc")
     else:
         print("not use demo dbc")
+    use_signal_tables = conf.get("use_signal_tables", False)
 
     # extract dbc file meta to an internal config file
     if not extract_dbc_meta(dbc_file, protocol_conf_file, car_type, black_list,
@@ -69,7 +71,10 @@ def gen(conf):
 
     # gen protocol
     protocol_dir = output_dir + "/" + car_type.lower() + "/protocol/"
-    gen_protocols(protocol_conf_file, protocol_dir, template_dir)
+    if use_signal_tables:
+        gen_signal_tables(protocol_conf_file, protocol_dir, template_dir)
+    gen_protocols(protocol_conf_file, protocol_dir, template_dir,
+                  use_signal_tables)
 
     # gen vehicle controller and protocol_manager
     vehicle_dir = output_dir + "/" + car_type.lower() + "/"
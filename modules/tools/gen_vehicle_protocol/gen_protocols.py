@@ -25,6 +25,9 @@ import sys
 
 import yaml
 
+from modules.tools.gen_vehicle_protocol.gen_signal_tables import get_signal
+from modules.tools.gen_vehicle_protocol.gen_signal_tables import get_signal_tables_file
+
 
 def gen_report_header(car_type, protocol, output_dir, protocol_template_dir):
     """
@@ -55,7 +58,8 @@ def gen_report_header(car_type, protocol, output_dir, protocol_template_dir):
         h_fp.write(FMT % fmt_val)
 
 
-def gen_report_cpp(car_type, protocol, output_dir, protocol_template_dir):
+def gen_report_cpp(car_type, protocol, output_dir, protocol_template_dir,
+                   use_signal_tables=False):
     """
         doc string:
     """
@@ -67,6 +71,8 @@ def gen_report_cpp(car_type, protocol, output_dir, protocol_template_dir):
         fmt_val["car_type_lower"] = car_type
         fmt_val["car_type_capitalize"] = car_type.capitalize()
         fmt_val["protocol_name_lower"] = protocol["name"]
+        fmt_val["signal_tables_include"] = gen_signal_tables_include(
+            car_type, use_signal_tables)
         classname = protocol["name"].replace('_', '').capitalize()
         fmt_val["classname"] = classname
         protocol_id = int(protocol["id"].upper(), 16)
@@ -90,10 +96,12 @@ def gen_report_cpp(car_type, protocol, output_dir, protocol_template_dir):
 %s %s::%s(const std::uint8_t* bytes, int32_t length) const {"""
             impl = fmt % (str(var), returntype, classname, var["name"])
 
-            byte_info = get_byte_info(var)
-            impl = impl + gen_parse_value_impl(var, byte_info)
-
-            impl = impl + gen_report_value_offset_precision(var, protocol)
+            if use_signal_tables:
+                impl = impl + gen_signal_decode_impl(var, protocol)
+            else:
+                byte_info = get_byte_info(var)
+                impl = impl + gen_parse_value_impl(var, byte_info)
+                impl = impl + gen_report_value_offset_precision(var, protocol)
             impl = impl + "}"
 
             func_impl_list.append(impl)
@@ -160,6 +168,50 @@ def gen_parse_value_impl(var, byte_info):
     return impl
 
 
+def gen_signal_tables_include(car_type, use_signal_tables):
+    """
+        the include of the signal tables at the end of the includes
+    """
+    if not use_signal_tables:
+        return ""
+    return '\n#include "modules/canbus_vehicle/%s/protocol/%s"' % (
+        car_type.lower(), get_signal_tables_file(car_type))
+
+
+def gen_signal_decode_impl(var, protocol):
+    """
+        decode a var by its CanSignal in the signal tables
+    """
+    signal = get_signal(protocol, var)
+    returntype = var["type"]
+    if var["type"] == "enum":
+        returntype = protocol["name"].capitalize() + "::" + var["name"].capitalize(
+        ) + "Type"
+        value = "static_cast<%s>(%s::DecodeRaw(bytes))" % (returntype, signal)
+    elif var["type"] == "bool":
+        value = "%s::DecodeRaw(bytes) != 0" % signal
+    elif var["type"] == "int":
+        value = "static_cast<int>(%s::Decode(bytes))" % signal
+    else:
+        value = "%s::Decode(bytes)" % signal
+    return "\n  %s ret = %s;\n  return ret;\n" % (returntype, value)
+
+
+def gen_signal_encode_impl(var, protocol):
+    """
+        encode a var by its CanSignal in the signal tables
+    """
+    signal = get_signal(protocol, var)
+    impl = gen_control_bounded_value(var)
+    if var["type"] == "enum" or var["type"] == "bool":
+        impl = impl + "  %s::EncodeRaw(%s, data);\n" % (signal,
+                                                       var["name"].lower())
+    else:
+        impl = impl + "  %s::Encode(%s, data);\n" % (signal,
+                                                    var["name"].lower())
+    return impl
+
+
 def gen_control_header(car_type, protocol, output_dir, protocol_template_dir):
     """
         doc string:
@@ -256,9 +308,9 @@ def get_byte_info(var):
     return byte_info
 
 
-def gen_control_decode_offset_precision(var):
+def gen_control_bounded_value(var):
     """
-        doc string:
+        bound the value of a var by its physical range
     """
     impl = "\n"
     range_info = get_range_info(var)
@@ -272,6 +324,14 @@ def gen_control_decode_offset_precision(var):
         impl = impl + "  %s = ProtocolData::BoundedValue(%s, %s, %s);\n" %\
             (var["name"].lower(), range_info["low"],
              range_info["high"], var["name"].lower())
+    return impl
+
+
+def gen_control_decode_offset_precision(var):
+    """
+        doc string:
+    """
+    impl = gen_control_bounded_value(var)
     impl = impl + "  int x ="
     if var["offset"] != 0.0:
         impl = impl + " (%s - %f)" % (var["name"].lower(), var["offset"])
@@ -329,7 +389,8 @@ def gen_control_encode_value_impl(var, byte_info):
     return impl
 
 
-def gen_control_value_func_impl(classname, var, protocol):
+def gen_control_value_func_impl(classname, var, protocol,
+                                use_signal_tables=False):
     """
         doc string:
     """
@@ -360,6 +421,8 @@ void %(classname)s::set_p_%(var_name)s(uint8_t* data,
     fmt_val["var_type"] = returntype
     fmt_val["config"] = str(var)
     impl = impl + fmt % fmt_val
+    if use_signal_tables:
+        return impl + gen_signal_encode_impl(var, protocol) + "}\n"
     impl = impl + gen_control_decode_offset_precision(var)
 
     # get lsb to msb order
@@ -373,7 +436,8 @@ void %(classname)s::set_p_%(var_name)s(uint8_t* data,
     return impl + "}\n"
 
 
-def gen_control_cpp(car_type, protocol, output_dir, protocol_template_dir):
+def gen_control_cpp(car_type, protocol, output_dir, protocol_template_dir,
+                    use_signal_tables=False):
     """
         doc string:
     """
@@ -385,6 +449,8 @@ def gen_control_cpp(car_type, protocol, output_dir, protocol_template_dir):
         fmt_val["car_type_lower"] = car_type
         fmt_val["car_type_capitalize"] = car_type.capitalize()
         fmt_val["protocol_name_lower"] = protocol["name"]
+        fmt_val["signal_tables_include"] = gen_signal_tables_include(
+            car_type, use_signal_tables)
         protocol_id = int(protocol["id"].upper(), 16)
         if protocol_id > 2048:
             fmt_val["id_upper"] = gen_esd_can_extended(protocol["id"].upper())
@@ -399,7 +465,8 @@ def gen_control_cpp(car_type, protocol, output_dir, protocol_template_dir):
         set_parse_var_to_protocol_list = []
         set_parse_func_impl_list = []
         for var in protocol["vars"]:
-            func_impl = gen_control_value_func_impl(classname, var, protocol)
+            func_impl = gen_control_value_func_impl(classname, var, protocol,
+                                                    use_signal_tables)
             set_func_impl_list.append(func_impl)
             set_private_var = "  set_p_%s(data, %s_);" % (var["name"].lower(),
                                                           var["name"].lower())
@@ -435,10 +502,12 @@ def gen_control_cpp(car_type, protocol, output_dir, protocol_template_dir):
 %s %s::%s(const std::uint8_t* bytes, int32_t length) const {"""
             impl = fmt % (returntype, classname, var["name"])
 
-            byte_info = get_byte_info(var)
-            impl = impl + gen_parse_value_impl(var, byte_info)
-
-            impl = impl + gen_report_value_offset_precision(var, protocol)
+            if use_signal_tables:
+                impl = impl + gen_signal_decode_impl(var, protocol)
+            else:
+                byte_info = get_byte_info(var)
+                impl = impl + gen_parse_value_impl(var, byte_info)
+                impl = impl + gen_report_value_offset_precision(var, protocol)
             impl = impl + "}"
 
             set_parse_func_impl_list.append(impl)
@@ -475,7 +544,8 @@ def gen_build_file(car_type, work_dir, protocol_template_dir):
         build_fp.write(fmt % fmt_var)
 
 
-def gen_protocols(protocol_conf_file, protocol_dir, protocol_template_dir):
+def gen_protocols(protocol_conf_file, protocol_dir, protocol_template_dir,
+                  use_signal_tables=False):
     """
         doc string:
     """
@@ -493,10 +563,12 @@ def gen_protocols(protocol_conf_file, protocol_dir, protocol_template_dir):
 
             if protocol["protocol_type"] == "report":
                 gen_report_header(car_type, protocol, protocol_dir, protocol_template_dir)
-                gen_report_cpp(car_type, protocol, protocol_dir, protocol_template_dir)
+                gen_report_cpp(car_type, protocol, protocol_dir, protocol_template_dir,
+                               use_signal_tables)
             elif protocol["protocol_type"] == "control":
                 gen_control_header(car_type, protocol, protocol_dir, protocol_template_dir)
-                gen_control_cpp(car_type, protocol, protocol_dir, protocol_template_dir)
+                gen_control_cpp(car_type, protocol, protocol_dir, protocol_template_dir,
+                                use_signal_tables)
 
             else:
                 print("Unknown protocol_type:%s" % protocol["protocol_type"])
@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+
+###############################################################################
+# Copyright 2024 The Apollo Authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+###############################################################################
+
+# -*- coding:utf-8 -*-
+
+import os
+import sys
+from fractions import Fraction
+
+import yaml
+
+# the largest denominator of std::ratio
+MAX_RATIO_DENOMINATOR = 2**62
+
+
+def get_tpl_fmt(tpl_file):
+    """
+        get fmt from tpl_file
+    """
+    with open(tpl_file, 'r') as tpl:
+        fmt = tpl.readlines()
+    fmt = "".join(fmt)
+    return fmt
+
+
+def get_signal_tables_file(car_type):
+    """
+        the header of the signal tables in the protocol dir
+    """
+    return "%s_signals.h" % car_type.lower()
+
+
+def get_message_name(protocol):
+    """
+        the struct of a protocol in the signal tables, the protocol classname
+    """
+    return protocol["name"].replace('_', '').capitalize()
+
+
+def get_signal_name(var):
+    """
+        the CanSignal of a var in the signal tables, in camel case
+    """
+    return "".join([w.capitalize() for w in var["name"].lower().split('_')])
+
+
+def get_signal(protocol, var):
+    """
+        the qualified CanSignal of a var, used by the generated protocols
+    """
+    return "signals::%s::%s" % (get_message_name(protocol),
+                                get_signal_name(var))
+
+
+def gen_ratio(value):
+    """
+        the exact std::ratio of the decimal value of the dbc file
+    """
+    fraction = Fraction(repr(float(value)))
+    if fraction.denominator > MAX_RATIO_DENOMINATOR:
+        fraction = fraction.limit_denominator(MAX_RATIO_DENOMINATOR)
+    if fraction.denominator == 1:
+        return "std::ratio<%d>" % fraction.numerator
+    return "std::ratio<%d, %d>" % (fraction.numerator, fraction.denominator)
+
+
+def gen_signal_declare(var):
+    """
+        the CanSignal of a var: layout, sign and the scaling as ratios
+    """
+    fmt = """
+  // config detail: %s
+  using %s = CanSignal<
+      %d, %d, CanByteOrder::%s, %s,
+      %s, %s>;"""
+    return fmt % (str(var), get_signal_name(var), var["bit"], var["len"],
+                  var["order"].upper(),
+                  "true" if var["is_signed_var"] else "false",
+                  gen_ratio(var["precision"]), gen_ratio(var["offset"]))
+
+
+def gen_message_declare(protocol):
+    """
+        a struct of the id and the signals of a protocol
+    """
+    protocol_id = int(protocol["id"], 16)
+    signal_declare_list = [gen_signal_declare(var) for var in protocol["vars"]]
+    fmt = """
+// %s
+struct %s {
+  static constexpr int32_t ID = 0x%X;%s
+};
+"""
+    return fmt % (protocol["name"], get_message_name(protocol), protocol_id,
+                  "".join(signal_declare_list))
+
+
+def gen_signal_tables(protocol_conf_file, protocol_dir, protocol_template_dir):
+    """
+        generate the constexpr signal tables of all the protocols, which the
+        protocols generated with use_signal_tables decode and encode with
+    """
+    print("Generating signal tables")
+    if not os.path.exists(protocol_dir):
+        os.makedirs(protocol_dir)
+    with open(protocol_conf_file, 'r') as fp:
+        content = yaml.safe_load(fp)
+    protocols = content["protocols"]
+    car_type = content["car_type"]
+
+    FMT = get_tpl_fmt(protocol_template_dir + "signal_tables.h.tpl")
+    message_list = []
+    for p_name in sorted(protocols, key=lambda p: int(p, 16)):
+        message_list.append(gen_message_declare(protocols[p_name]))
+    fmt_val = {}
+    fmt_val["car_type_lower"] = car_type.lower()
+    fmt_val["message_list"] = "".join(message_list)
+    with open(protocol_dir + get_signal_tables_file(car_type), 'w') as h_fp:
+        h_fp.write(FMT % fmt_val)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        print("Usage:\npython %s some_config.yml" % sys.argv[0])
+        sys.exit(0)
+    with open(sys.argv[1], 'r') as fp:
+        conf = yaml.safe_load(fp)
+    protocol_dir = conf["output_dir"] + "/" + conf["car_type"].lower() + \
+        "/protocol/"
+    protocol_template_dir = sys.path[0] + "/template/"
+    gen_signal_tables(conf["protocol_conf"], protocol_dir,
+                      protocol_template_dir)
@@ -16,7 +16,7 @@
 
 #include "modules/canbus_vehicle/%(car_type_lower)s/protocol/%(protocol_name_lower)s.h"
 
-#include "modules/drivers/canbus/common/byte.h"
+#include "modules/drivers/canbus/common/byte.h"%(signal_tables_include)s
 
 namespace apollo {
 namespace canbus {
@@ -19,7 +19,7 @@
 #include "glog/logging.h"
 
 #include "modules/drivers/canbus/common/byte.h"
-#include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/canbus_consts.h"%(signal_tables_include)s
 
 namespace apollo {
 namespace canbus {